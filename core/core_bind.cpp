@@ -71,6 +71,22 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path) {
 	return res;
 }
 
+void ResourceLoader::load_threaded_cancel(const String &p_path) {
+	::ResourceLoader::load_threaded_cancel(p_path);
+}
+
+void ResourceLoader::set_threaded_load_priority(const String &p_path, int p_priority) {
+	::ResourceLoader::set_threaded_load_priority(p_path, p_priority);
+}
+
+void ResourceLoader::set_max_concurrent_threaded_loads(int p_max) {
+	::ResourceLoader::set_max_concurrent_threaded_loads(p_max);
+}
+
+int ResourceLoader::get_max_concurrent_threaded_loads() const {
+	return ::ResourceLoader::get_max_concurrent_threaded_loads();
+}
+
 Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hint, CacheMode p_cache_mode) {
 	Error err = OK;
 	Ref<Resource> ret = ::ResourceLoader::load(p_path, p_type_hint, ResourceFormatLoader::CacheMode(p_cache_mode), &err);
@@ -136,6 +152,10 @@ void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads", "cache_mode"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false), DEFVAL(CACHE_MODE_REUSE));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &ResourceLoader::load_threaded_get_status, DEFVAL_ARRAY);
 	ClassDB::bind_method(D_METHOD("load_threaded_get", "path"), &ResourceLoader::load_threaded_get);
+	ClassDB::bind_method(D_METHOD("load_threaded_cancel", "path"), &ResourceLoader::load_threaded_cancel);
+	ClassDB::bind_method(D_METHOD("set_threaded_load_priority", "path", "priority"), &ResourceLoader::set_threaded_load_priority);
+	ClassDB::bind_method(D_METHOD("set_max_concurrent_threaded_loads", "max"), &ResourceLoader::set_max_concurrent_threaded_loads);
+	ClassDB::bind_method(D_METHOD("get_max_concurrent_threaded_loads"), &ResourceLoader::get_max_concurrent_threaded_loads);
 
 	ClassDB::bind_method(D_METHOD("load", "path", "type_hint", "cache_mode"), &ResourceLoader::load, DEFVAL(""), DEFVAL(CACHE_MODE_REUSE));
 	ClassDB::bind_method(D_METHOD("get_recognized_extensions_for_type", "type"), &ResourceLoader::get_recognized_extensions_for_type);
@@ -150,6 +150,8 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const { return nullptr; } ///< get a read-only pointer to the next bytes without copying them and advance past them; nullptr when the data is not in memory or fewer bytes are left, use get_buffer() then.
+	virtual const uint8_t *map_read_only(uint64_t &r_length) { return nullptr; } ///< map the whole file read-only in memory, valid until the file is closed; nullptr when not supported.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -278,10 +278,56 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
 	}
 
+	_map_pack(p_path);
+
 	return true;
 }
 
+void PackedSourcePCK::_map_pack(const String &p_path) {
+	if (sizeof(void *) < 8) {
+		// Large packs would exhaust the address space, keep using regular reads.
+		return;
+	}
+
+	{
+		MutexLock lock(mapped_packs_mutex);
+		if (mapped_packs.has(p_path)) {
+			return;
+		}
+	}
+
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null()) {
+		return;
+	}
+
+	MappedPack mp;
+	mp.data = f->map_read_only(mp.length);
+	if (!mp.data) {
+		return;
+	}
+	mp.file = f;
+
+	MutexLock lock(mapped_packs_mutex);
+	if (!mapped_packs.has(p_path)) {
+		mapped_packs.insert(p_path, mp);
+	}
+}
+
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
+	if (!p_file->encrypted) {
+		MappedPack mp;
+		{
+			MutexLock lock(mapped_packs_mutex);
+			const MappedPack *found = mapped_packs.getptr(p_file->pack);
+			if (found) {
+				mp = *found;
+			}
+		}
+		if (mp.data && p_file->offset <= mp.length && p_file->size <= mp.length - p_file->offset) {
+			return memnew(FileAccessPack(p_path, *p_file, mp.file, mp.data));
+		}
+	}
 	return memnew(FileAccessPack(p_path, *p_file));
 }
 
@@ -293,7 +339,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -309,7 +357,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!mapped) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -343,21 +393,39 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
+	const uint64_t read_pos = pos;
 	pos += to_read;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+
+	if (mapped) {
+		memcpy(p_dst, mapped + off + read_pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	if (!mapped || eof || pos > pf.size || p_length > pf.size - pos) {
+		return nullptr;
+	}
+
+	const uint8_t *view = mapped + off + pos;
+	pos += p_length;
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (!mapped) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -381,6 +449,7 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped = nullptr;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
@@ -411,6 +480,15 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 	eof = false;
 }
 
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapped_file, const uint8_t *p_mapped_data) :
+		pf(p_file),
+		pos(0),
+		eof(false),
+		off(p_file.offset),
+		f(p_mapped_file),
+		mapped(p_mapped_data) {
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 // DIR ACCESS
 //////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*  file_read_batch.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_read_batch.h"
+
+uint32_t FileReadBatch::add_read(const Ref<FileAccess> &p_file, uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) {
+	ERR_FAIL_COND_V_MSG(submitted, UINT32_MAX, "Can't add reads to a batch that was already submitted.");
+	ERR_FAIL_COND_V(p_file.is_null(), UINT32_MAX);
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, UINT32_MAX);
+
+	uint32_t read_index = reads.size();
+	Read read;
+	read.offset = p_offset;
+	read.dst = p_dst;
+	read.length = p_length;
+	reads.push_back(read);
+
+	FileReads *file_reads = nullptr;
+	for (FileReads &E : files) {
+		if (E.file == p_file) {
+			file_reads = &E;
+			break;
+		}
+	}
+	if (!file_reads) {
+		files.push_back(FileReads());
+		file_reads = &files[files.size() - 1];
+		file_reads->file = p_file;
+	}
+
+	// Keep reads sorted by offset, so each file is read front to back.
+	uint32_t pos = file_reads->reads.size();
+	while (pos > 0 && reads[file_reads->reads[pos - 1]].offset > p_offset) {
+		pos--;
+	}
+	file_reads->reads.insert(pos, read_index);
+
+	return read_index;
+}
+
+void FileReadBatch::_read_file(FileReads *p_file_reads) {
+	for (uint32_t read_index : p_file_reads->reads) {
+		Read &read = reads[read_index];
+		p_file_reads->file->seek(read.offset);
+		read.read = p_file_reads->file->get_buffer(read.dst, read.length);
+	}
+}
+
+void FileReadBatch::submit() {
+	ERR_FAIL_COND_MSG(submitted, "File read batch was already submitted.");
+	submitted = true;
+
+	for (FileReads &file_reads : files) {
+		file_reads.task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &FileReadBatch::_read_file, &file_reads, true, SNAME("FileReadBatch"));
+	}
+}
+
+bool FileReadBatch::is_completed() const {
+	ERR_FAIL_COND_V_MSG(!submitted, false, "File read batch was not submitted.");
+	if (waited) {
+		return true;
+	}
+	for (const FileReads &file_reads : files) {
+		if (!WorkerThreadPool::get_singleton()->is_task_completed(file_reads.task_id)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void FileReadBatch::wait() {
+	ERR_FAIL_COND_MSG(!submitted, "File read batch was not submitted.");
+	if (waited) {
+		return;
+	}
+	// From a pool thread, this runs other tasks (possibly these reads) while waiting.
+	for (const FileReads &file_reads : files) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(file_reads.task_id);
+	}
+	waited = true;
+}
+
+uint64_t FileReadBatch::get_read_length(uint32_t p_read) const {
+	ERR_FAIL_UNSIGNED_INDEX_V(p_read, reads.size(), 0);
+	ERR_FAIL_COND_V_MSG(!waited, 0, "File read batch must be waited for before checking its results.");
+	return reads[p_read].read;
+}
+
+FileReadBatch::~FileReadBatch() {
+	if (submitted) {
+		wait();
+	}
+}
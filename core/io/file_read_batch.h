@@ -0,0 +1,76 @@
+/**************************************************************************/
+/*  file_read_batch.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FILE_READ_BATCH_H
+#define FILE_READ_BATCH_H
+
+#include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+
+// Reads a set of byte ranges, from one or more files, in the background.
+// Reads from the same file are done in offset order by a single task, so any FileAccess
+// can be used; different files are read in parallel. The files must not be used
+// elsewhere until the batch is completed, and their position is undefined afterwards.
+// Each file is read by a regular task rather than a group, so the batch can be waited for
+// from a pool thread (e.g. a threaded resource load) without holding it idle.
+class FileReadBatch {
+	struct Read {
+		uint64_t offset = 0;
+		uint8_t *dst = nullptr;
+		uint64_t length = 0;
+		uint64_t read = 0;
+	};
+
+	struct FileReads {
+		Ref<FileAccess> file;
+		LocalVector<uint32_t> reads; // Sorted by offset.
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	LocalVector<Read> reads;
+	LocalVector<FileReads> files;
+	bool submitted = false;
+	bool waited = false;
+
+	void _read_file(FileReads *p_file_reads);
+
+public:
+	uint32_t add_read(const Ref<FileAccess> &p_file, uint64_t p_offset, uint8_t *p_dst, uint64_t p_length);
+	void submit();
+	bool is_completed() const;
+	void wait();
+
+	uint64_t get_read_length(uint32_t p_read) const; // Bytes actually read, once completed.
+
+	~FileReadBatch();
+};
+
+#endif // FILE_READ_BATCH_H
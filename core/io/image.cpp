@@ -36,6 +36,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
@@ -43,6 +44,14 @@
 #include <stdio.h>
 #include <cmath>
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMAGE_SIMD_SSE2
+#include <emmintrin.h>
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define IMAGE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
 const char *Image::format_names[Image::FORMAT_MAX] = {
 	"Lum8", //luminance
 	"LumAlpha8", //luminance-alpha
@@ -777,8 +786,56 @@ static double _bicubic_interp_kernel(double x) {
 	return bc;
 }
 
+// Below this many destination pixels, handing the work to the WorkerThreadPool costs more than it saves.
+static constexpr uint64_t PARALLEL_MIN_PIXELS = 1 << 16;
+
+template <typename F>
+struct _ImageBands {
+	const F *func = nullptr;
+	uint32_t count = 0;
+	uint32_t bands = 0;
+
+	static void process(void *p_userdata, uint32_t p_band) {
+		const _ImageBands *ib = (const _ImageBands *)p_userdata;
+		uint32_t from = uint64_t(ib->count) * p_band / ib->bands;
+		uint32_t to = uint64_t(ib->count) * (p_band + 1) / ib->bands;
+		(*ib->func)(from, to);
+	}
+};
+
+// Calls p_func(from, to) over bands of [0, p_count), distributed over the WorkerThreadPool
+// if there are enough pixels to process. Bands must write to disjoint parts of the output.
+template <typename F>
+static void _process_in_bands(uint32_t p_count, uint64_t p_pixels, const F &p_func) {
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	uint32_t bands = 1;
+	if (wtp && p_pixels >= PARALLEL_MIN_PIXELS) {
+		// A few bands per thread, so the load stays balanced when some threads are busy with other tasks.
+		bands = MIN(p_count, uint32_t(wtp->get_thread_count()) * 4);
+	}
+
+	if (bands <= 1) {
+		p_func(0, p_count);
+		return;
+	}
+
+	_ImageBands<F> ib;
+	ib.func = &p_func;
+	ib.count = p_count;
+	ib.bands = bands;
+	WorkerThreadPool::GroupID group_task = wtp->add_native_group_task(&_ImageBands<F>::process, &ib, bands, -1, true, String("ImageProcessBands"));
+	wtp->wait_for_group_task_completion(group_task);
+}
+
+template <void (*scale_rows_func)(const uint8_t *, uint8_t *, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)>
+static void _scale_in_bands(const uint8_t *p_src, uint8_t *p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_process_in_bands(p_dst_height, uint64_t(p_dst_width) * p_dst_height, [&](uint32_t p_from, uint32_t p_to) {
+		scale_rows_func(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height, p_from, p_to);
+	});
+}
+
 template <int CC, typename T>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -793,7 +850,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_from_row; y < p_to_row; y++) {
 		// Y coordinates
 		oy = (double)y * yfac - 0.5f;
 		oy1 = (int)oy;
@@ -865,13 +922,18 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, typename T>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_scale_in_bands<_scale_cubic_rows<CC, T>>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
+template <int CC, typename T>
+static void _scale_bilinear_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
 	constexpr uint32_t FRAC_BITS = 8;
 	constexpr uint32_t FRAC_LEN = (1 << FRAC_BITS);
 	constexpr uint32_t FRAC_HALF = (FRAC_LEN >> 1);
 	constexpr uint32_t FRAC_MASK = FRAC_LEN - 1;
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	for (uint32_t i = p_from_row; i < p_to_row; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -953,26 +1015,36 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 }
 
 template <int CC, typename T>
-static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_scale_in_bands<_scale_bilinear_rows<CC, T>>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
+template <int CC, typename T>
+static void _scale_nearest_rows(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_from_row, uint32_t p_to_row) {
+	const T *__restrict src = ((const T *)p_src);
+	T *__restrict dst = ((T *)p_dst);
+
+	for (uint32_t i = p_from_row; i < p_to_row; i++) {
 		uint32_t src_yofs = i * p_src_height / p_dst_height;
-		uint32_t y_ofs = src_yofs * p_src_width * CC;
+		const T *__restrict src_row = src + src_yofs * p_src_width * CC;
+		T *__restrict dst_row = dst + i * p_dst_width * CC;
 
 		for (uint32_t j = 0; j < p_dst_width; j++) {
 			uint32_t src_xofs = j * p_src_width / p_dst_width;
 			src_xofs *= CC;
 
 			for (uint32_t l = 0; l < CC; l++) {
-				const T *src = ((const T *)p_src);
-				T *dst = ((T *)p_dst);
-
-				T p = src[y_ofs + src_xofs + l];
-				dst[i * p_dst_width * CC + j * CC + l] = p;
+				dst_row[j * CC + l] = src_row[src_xofs + l];
 			}
 		}
 	}
 }
 
+template <int CC, typename T>
+static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_scale_in_bands<_scale_nearest_rows<CC, T>>(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height);
+}
+
 #define LANCZOS_TYPE 3
 
 static float _lanczos(float p_x) {
@@ -989,8 +1061,8 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 	uint32_t buffer_size = src_height * dst_width * CC;
 	float *buffer = memnew_arr(float, buffer_size); // Store the first pass in a buffer
 
-	{ // FIRST PASS (horizontal)
-
+	// FIRST PASS (horizontal), in bands of buffer columns.
+	_process_in_bands(dst_width, uint64_t(dst_width) * src_height, [&](uint32_t p_from_x, uint32_t p_to_x) {
 		float x_scale = float(src_width) / float(dst_width);
 
 		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
@@ -998,7 +1070,7 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 
 		float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
+		for (int32_t buffer_x = p_from_x; buffer_x < int32_t(p_to_x); buffer_x++) {
 			// The corresponding point on the source image
 			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
 			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
@@ -1037,10 +1109,10 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		}
 
 		memdelete_arr(kernel);
-	} // End of first pass
-
-	{ // SECOND PASS (vertical + result)
+	}); // End of first pass
 
+	// SECOND PASS (vertical + result), in bands of destination rows.
+	_process_in_bands(dst_height, uint64_t(dst_width) * dst_height, [&](uint32_t p_from_y, uint32_t p_to_y) {
 		float y_scale = float(src_height) / float(dst_height);
 
 		float scale_factor = MAX(y_scale, 1);
@@ -1048,7 +1120,7 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 
 		float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
+		for (int32_t dst_y = p_from_y; dst_y < int32_t(p_to_y); dst_y++) {
 			float buffer_y = (dst_y + 0.5f) * y_scale;
 			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
 			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
@@ -1089,7 +1161,7 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		}
 
 		memdelete_arr(kernel);
-	} // End of second pass
+	}); // End of second pass
 
 	memdelete_arr(buffer);
 }
@@ -1761,40 +1833,135 @@ bool Image::_can_modify(Format p_format) const {
 	return !Image::is_format_compressed(p_format);
 }
 
+// Averages the 2x2 blocks of the start of a row with SIMD, returning how many destination
+// pixels were written. Only RGBA8 and RGBAF have kernels: they are bit-exact with the
+// scalar averages, and cover most textures. RGBAH would need F16C to convert halves,
+// which isn't part of the SSE2 baseline, so it's left to the compiler.
+template <typename Component, int CC>
+static _FORCE_INLINE_ uint32_t _generate_po2_mipmap_row_simd(const Component *p_up, const Component *p_down, Component *p_dst, uint32_t p_dst_w) {
+	return 0;
+}
+
+#if defined(IMAGE_SIMD_SSE2)
+template <>
+_FORCE_INLINE_ uint32_t _generate_po2_mipmap_row_simd<uint8_t, 4>(const uint8_t *p_up, const uint8_t *p_down, uint8_t *p_dst, uint32_t p_dst_w) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i two = _mm_set1_epi16(2);
+	uint32_t x = 0;
+	for (; x + 4 <= p_dst_w; x += 4) {
+		// Each half makes two destination pixels out of four source pixels per row, summed in 16 bits.
+		__m128i halves[2];
+		for (int h = 0; h < 2; h++) {
+			const __m128i up = _mm_loadu_si128((const __m128i *)(p_up + x * 8 + h * 16));
+			const __m128i down = _mm_loadu_si128((const __m128i *)(p_down + x * 8 + h * 16));
+			const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(up, zero), _mm_unpacklo_epi8(down, zero));
+			const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(up, zero), _mm_unpackhi_epi8(down, zero));
+			const __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+			halves[h] = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+		}
+		_mm_storeu_si128((__m128i *)(p_dst + x * 4), _mm_packus_epi16(halves[0], halves[1]));
+	}
+	return x;
+}
+
+template <>
+_FORCE_INLINE_ uint32_t _generate_po2_mipmap_row_simd<float, 4>(const float *p_up, const float *p_down, float *p_dst, uint32_t p_dst_w) {
+	const __m128 quarter = _mm_set1_ps(0.25f);
+	for (uint32_t x = 0; x < p_dst_w; x++) {
+		// Same order of additions as average_4_float(), so results are identical.
+		__m128 sum = _mm_add_ps(_mm_loadu_ps(p_up + x * 8), _mm_loadu_ps(p_up + x * 8 + 4));
+		sum = _mm_add_ps(sum, _mm_loadu_ps(p_down + x * 8));
+		sum = _mm_add_ps(sum, _mm_loadu_ps(p_down + x * 8 + 4));
+		_mm_storeu_ps(p_dst + x * 4, _mm_mul_ps(sum, quarter));
+	}
+	return p_dst_w;
+}
+#elif defined(IMAGE_SIMD_NEON)
+template <>
+_FORCE_INLINE_ uint32_t _generate_po2_mipmap_row_simd<uint8_t, 4>(const uint8_t *p_up, const uint8_t *p_down, uint8_t *p_dst, uint32_t p_dst_w) {
+	uint32_t x = 0;
+	for (; x + 4 <= p_dst_w; x += 4) {
+		// Deinterleave even and odd pixels, so the left and right pixels of each block line up.
+		const uint32x4x2_t up = vld2q_u32((const uint32_t *)(p_up + x * 8));
+		const uint32x4x2_t down = vld2q_u32((const uint32_t *)(p_down + x * 8));
+		const uint8x16_t up_left = vreinterpretq_u8_u32(up.val[0]);
+		const uint8x16_t up_right = vreinterpretq_u8_u32(up.val[1]);
+		const uint8x16_t down_left = vreinterpretq_u8_u32(down.val[0]);
+		const uint8x16_t down_right = vreinterpretq_u8_u32(down.val[1]);
+
+		uint16x8_t lo = vaddl_u8(vget_low_u8(up_left), vget_low_u8(up_right));
+		lo = vaddw_u8(lo, vget_low_u8(down_left));
+		lo = vaddw_u8(lo, vget_low_u8(down_right));
+		uint16x8_t hi = vaddl_u8(vget_high_u8(up_left), vget_high_u8(up_right));
+		hi = vaddw_u8(hi, vget_high_u8(down_left));
+		hi = vaddw_u8(hi, vget_high_u8(down_right));
+
+		// Rounding shift, (sum + 2) >> 2.
+		vst1q_u8(p_dst + x * 4, vcombine_u8(vrshrn_n_u16(lo, 2), vrshrn_n_u16(hi, 2)));
+	}
+	return x;
+}
+
+template <>
+_FORCE_INLINE_ uint32_t _generate_po2_mipmap_row_simd<float, 4>(const float *p_up, const float *p_down, float *p_dst, uint32_t p_dst_w) {
+	for (uint32_t x = 0; x < p_dst_w; x++) {
+		// Same order of additions as average_4_float(), so results are identical.
+		float32x4_t sum = vaddq_f32(vld1q_f32(p_up + x * 8), vld1q_f32(p_up + x * 8 + 4));
+		sum = vaddq_f32(sum, vld1q_f32(p_down + x * 8));
+		sum = vaddq_f32(sum, vld1q_f32(p_down + x * 8 + 4));
+		vst1q_f32(p_dst + x * 4, vmulq_n_f32(sum, 0.25f));
+	}
+	return p_dst_w;
+}
+#endif
+
 template <typename Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
-static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+static void _generate_po2_mipmap_rows(const Component *__restrict p_src, Component *__restrict p_dst, uint32_t p_width, uint32_t p_height, uint32_t p_from_row, uint32_t p_to_row) {
 	//fast power of 2 mipmap generation
 	uint32_t dst_w = MAX(p_width >> 1, 1u);
-	uint32_t dst_h = MAX(p_height >> 1, 1u);
 
-	int right_step = (p_width == 1) ? 0 : CC;
-	int down_step = (p_height == 1) ? 0 : (p_width * CC);
+	uint32_t right_step = (p_width == 1) ? 0 : CC;
+	uint32_t down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
-		const Component *rup_ptr = &p_src[i * 2 * down_step];
-		const Component *rdown_ptr = rup_ptr + down_step;
-		Component *dst_ptr = &p_dst[i * dst_w * CC];
-		uint32_t count = dst_w;
+	for (uint32_t i = p_from_row; i < p_to_row; i++) {
+		const Component *__restrict rup_ptr = &p_src[i * 2 * down_step];
+		const Component *__restrict rdown_ptr = rup_ptr + down_step;
+		Component *__restrict dst_ptr = &p_dst[i * dst_w * CC];
+
+		uint32_t from_x = 0;
+		if (!renormalize && right_step != 0 && down_step != 0) {
+			from_x = _generate_po2_mipmap_row_simd<Component, CC>(rup_ptr, rdown_ptr, dst_ptr, dst_w);
+		}
 
-		while (count) {
-			count--;
+		// Plain indexing over the rest of the row, so compilers can vectorize the loop.
+		for (uint32_t x = from_x; x < dst_w; x++) {
+			const uint32_t left = x * right_step * 2;
+			const uint32_t right = left + right_step;
 			for (int j = 0; j < CC; j++) {
-				average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
+				average_func(dst_ptr[x * CC + j], rup_ptr[left + j], rup_ptr[right + j], rdown_ptr[left + j], rdown_ptr[right + j]);
 			}
 
 			if (renormalize) {
-				renormalize_func(dst_ptr);
+				renormalize_func(&dst_ptr[x * CC]);
 			}
-
-			dst_ptr += CC;
-			rup_ptr += right_step * 2;
-			rdown_ptr += right_step * 2;
 		}
 	}
 }
 
+template <typename Component, int CC, bool renormalize,
+		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
+		void (*renormalize_func)(Component *)>
+static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+	uint32_t dst_w = MAX(p_width >> 1, 1u);
+	uint32_t dst_h = MAX(p_height >> 1, 1u);
+
+	_process_in_bands(dst_h, uint64_t(dst_w) * dst_h, [&](uint32_t p_from, uint32_t p_to) {
+		_generate_po2_mipmap_rows<Component, CC, renormalize, average_func, renormalize_func>(p_src, p_dst, p_width, p_height, p_from, p_to);
+	});
+}
+
 void Image::shrink_x2() {
 	ERR_FAIL_COND(data.is_empty());
 
@@ -438,6 +438,7 @@ public:
 	const uint8_t *ptr() const;
 	uint8_t *ptrw();
 	int64_t get_data_size() const;
+	virtual uint64_t get_memory_usage_estimate() const override { return data.size(); }
 
 	void adjust_bcs(float p_brightness, float p_contrast, float p_saturation);
 
@@ -32,6 +32,16 @@
 
 #include "core/config/engine.h"
 #include "core/string/print_string.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/variant_internal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define JSON_SIMD_SSE2
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (defined(__aarch64__) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define JSON_SIMD_NEON
+#endif
 
 const char *JSON::tk_name[TK_MAX] = {
 	"'{'",
@@ -46,38 +56,42 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-String JSON::_make_indent(const String &p_indent, int p_size) {
-	return p_indent.repeat(p_size);
+void JSON::_append_indent(String &r_result, const String &p_indent, int p_size) {
+	for (int i = 0; i < p_size; i++) {
+		r_result += p_indent;
+	}
 }
 
-String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
-	ERR_FAIL_COND_V_MSG(p_cur_indent > Variant::MAX_RECURSION_DEPTH, "...", "JSON structure is too deep. Bailing.");
-
-	String colon = ":";
-	String end_statement = "";
-
-	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
+void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
+		r_result += "...";
+		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
 	}
 
+	const char *colon = p_indent.is_empty() ? ":" : ": ";
+	const char *end_statement = p_indent.is_empty() ? "" : "\n";
+
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			r_result += "null";
+			return;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			r_result += p_var.operator bool() ? "true" : "false";
+			return;
 		case Variant::INT:
-			return itos(p_var);
+			r_result += itos(p_var);
+			return;
 		case Variant::FLOAT: {
 			double num = p_var;
 			if (p_full_precision) {
 				// Store unreliable digits (17) instead of just reliable
 				// digits (14) so that the value can be decoded exactly.
-				return String::num(num, 17 - (int)floor(log10(num)));
+				r_result += String::num(num, 17 - (int)floor(log10(num)));
 			} else {
 				// Store only reliable digits (14) by default.
-				return String::num(num, 14 - (int)floor(log10(num)));
+				r_result += String::num(num, 14 - (int)floor(log10(num)));
 			}
+			return;
 		}
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
@@ -87,36 +101,46 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 		case Variant::ARRAY: {
 			Array a = p_var;
 			if (a.is_empty()) {
-				return "[]";
+				r_result += "[]";
+				return;
+			}
+			if (p_markers.has(a.id())) {
+				r_result += "\"[...]\"";
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
 			}
-			String s = "[";
-			s += end_statement;
-
-			ERR_FAIL_COND_V_MSG(p_markers.has(a.id()), "\"[...]\"", "Converting circular structure to JSON.");
 			p_markers.insert(a.id());
 
+			r_result += "[";
+			r_result += end_statement;
+
 			bool first = true;
 			for (const Variant &var : a) {
 				if (first) {
 					first = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_result += ",";
+					r_result += end_statement;
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(var, p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_append_indent(r_result, p_indent, p_cur_indent + 1);
+				_stringify(r_result, var, p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
+			r_result += end_statement;
+			_append_indent(r_result, p_indent, p_cur_indent);
+			r_result += "]";
 			p_markers.erase(a.id());
-			return s;
+			return;
 		}
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
 			Dictionary d = p_var;
-
-			ERR_FAIL_COND_V_MSG(p_markers.has(d.id()), "\"{...}\"", "Converting circular structure to JSON.");
+			if (p_markers.has(d.id())) {
+				r_result += "\"{...}\"";
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(d.id());
 
+			r_result += "{";
+			r_result += end_statement;
+
 			List<Variant> keys;
 			d.get_key_list(&keys);
 
@@ -129,26 +153,163 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 				if (first_key) {
 					first_key = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					r_result += ",";
+					r_result += end_statement;
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
-				s += colon;
-				s += _stringify(d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_append_indent(r_result, p_indent, p_cur_indent + 1);
+				_stringify(r_result, String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				r_result += colon;
+				_stringify(r_result, d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
+			r_result += end_statement;
+			_append_indent(r_result, p_indent, p_cur_indent);
+			r_result += "}";
 			p_markers.erase(d.id());
-			return s;
+			return;
 		}
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			r_result += "\"";
+			r_result += String(p_var).json_escape();
+			r_result += "\"";
+			return;
+	}
+}
+
+// Strings are collected as code points when parsing a String, and as raw bytes
+// (decoded once at the end) when parsing UTF-8 input.
+static _FORCE_INLINE_ void _json_append_code_point(LocalVector<char32_t> &r_str, char32_t p_char) {
+	r_str.push_back(p_char);
+}
+
+static void _json_append_code_point(LocalVector<uint8_t> &r_str, char32_t p_char) {
+	if (p_char < 0x80) {
+		r_str.push_back(p_char);
+		return;
+	}
+	const CharString utf8 = String::chr(p_char).utf8();
+	for (int i = 0; i < utf8.length(); i++) {
+		r_str.push_back(utf8[i]);
 	}
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+static _FORCE_INLINE_ String _json_make_string(const LocalVector<char32_t> &p_str) {
+	return p_str.is_empty() ? String() : String(p_str.ptr(), p_str.size());
+}
+
+static _FORCE_INLINE_ String _json_make_string(const LocalVector<uint8_t> &p_str) {
+	String str;
+	if (!p_str.is_empty()) {
+		str.parse_utf8((const char *)p_str.ptr(), p_str.size());
+	}
+	return str;
+}
+
+// Finds where a run of characters inside a string ends: at a quote, a backslash, a newline or a null character.
+static _FORCE_INLINE_ bool _json_ends_string_run(char32_t p_char) {
+	return p_char == '"' || p_char == '\\' || p_char == '\n' || p_char == 0;
+}
+
+static _FORCE_INLINE_ int _json_find_string_run_end(const char32_t *p_str, int p_from, int p_len) {
+	int i = p_from;
+	while (i < p_len && !_json_ends_string_run(p_str[i])) {
+		i++;
+	}
+	return i;
+}
+
+static _FORCE_INLINE_ int _json_find_string_run_end(const uint8_t *p_str, int p_from, int p_len) {
+	int i = p_from;
+	// Long strings are most of the bytes of large documents, skip whole blocks without any of
+	// the four bytes ending a run, and find the exact position in the last one with scalar code.
+#if defined(JSON_SIMD_SSE2)
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+	const __m128i newline = _mm_set1_epi8('\n');
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= p_len; i += 16) {
+		const __m128i block = _mm_loadu_si128((const __m128i *)(p_str + i));
+		const __m128i found = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)), _mm_or_si128(_mm_cmpeq_epi8(block, newline), _mm_cmpeq_epi8(block, zero)));
+		if (_mm_movemask_epi8(found)) {
+			break;
+		}
+	}
+#elif defined(JSON_SIMD_NEON)
+	const uint8x16_t quote = vdupq_n_u8('"');
+	const uint8x16_t backslash = vdupq_n_u8('\\');
+	const uint8x16_t newline = vdupq_n_u8('\n');
+	for (; i + 16 <= p_len; i += 16) {
+		const uint8x16_t block = vld1q_u8(p_str + i);
+		const uint8x16_t found = vorrq_u8(vorrq_u8(vceqq_u8(block, quote), vceqq_u8(block, backslash)), vorrq_u8(vceqq_u8(block, newline), vceqzq_u8(block)));
+		if (vmaxvq_u8(found)) {
+			break;
+		}
+	}
+#endif
+	while (i < p_len && !_json_ends_string_run(p_str[i])) {
+		i++;
+	}
+	return i;
+}
+
+static _FORCE_INLINE_ double _json_parse_number(const char32_t *p_str, int &index, int p_len) {
+	const char32_t *rptr;
+	double number = String::to_float(&p_str[index], &rptr);
+	index += (rptr - &p_str[index]);
+	return number;
+}
+
+static double _json_parse_number(const uint8_t *p_str, int &index, int p_len) {
+	// Find the end the same way String::to_float() does, as byte input is not null-terminated.
+	int end = index;
+	if (end < p_len && p_str[end] == '-') {
+		end++;
+	}
+	bool decimal_point = false;
+	while (end < p_len && (is_digit(p_str[end]) || (p_str[end] == '.' && !decimal_point))) {
+		decimal_point = decimal_point || p_str[end] == '.';
+		end++;
+	}
+	if (end < p_len && (p_str[end] == 'e' || p_str[end] == 'E')) {
+		int exp_end = end + 1;
+		if (exp_end < p_len && (p_str[exp_end] == '-' || p_str[exp_end] == '+')) {
+			exp_end++;
+		}
+		if (exp_end < p_len && is_digit(p_str[exp_end])) {
+			while (exp_end < p_len && is_digit(p_str[exp_end])) {
+				exp_end++;
+			}
+			end = exp_end;
+		}
+	}
+
+	const int length = end - index;
+	double number;
+	char buffer[64];
+	if (length < (int)sizeof(buffer)) {
+		memcpy(buffer, &p_str[index], length);
+		buffer[length] = 0;
+		number = String::to_float(buffer);
+	} else {
+		CharString long_number;
+		long_number.resize(length + 1);
+		memcpy(long_number.ptrw(), &p_str[index], length);
+		long_number.ptrw()[length] = 0;
+		number = String::to_float(long_number.get_data());
+	}
+	index = end;
+	return number;
+}
+
+template <typename C>
+Error JSON::_get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+	// Reading past the end yields 0, like the terminator of a String.
+	auto char_at = [&](int p_index) -> char32_t {
+		return p_index < p_len ? (char32_t)p_str[p_index] : 0;
+	};
+
 	while (p_len > 0) {
-		switch (p_str[index]) {
+		switch (char_at(index)) {
 			case '\n': {
 				line++;
 				index++;
@@ -190,18 +351,27 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 			}
 			case '"': {
 				index++;
-				String str;
+				LocalVector<C> str;
 				while (true) {
-					if (p_str[index] == 0) {
+					// Copy runs of plain characters in one go.
+					const int run_end = _json_find_string_run_end(p_str, index, p_len);
+					if (run_end > index) {
+						const uint32_t from = str.size();
+						str.resize(from + (run_end - index));
+						memcpy(str.ptr() + from, &p_str[index], (run_end - index) * sizeof(C));
+						index = run_end;
+					}
+
+					if (char_at(index) == 0) {
 						r_err_str = "Unterminated String";
 						return ERR_PARSE_ERROR;
-					} else if (p_str[index] == '"') {
+					} else if (char_at(index) == '"') {
 						index++;
 						break;
-					} else if (p_str[index] == '\\') {
+					} else if (char_at(index) == '\\') {
 						//escaped characters...
 						index++;
-						char32_t next = p_str[index];
+						char32_t next = char_at(index);
 						if (next == 0) {
 							r_err_str = "Unterminated String";
 							return ERR_PARSE_ERROR;
@@ -227,7 +397,7 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 							case 'u': {
 								// hex number
 								for (int j = 0; j < 4; j++) {
-									char32_t c = p_str[index + j + 1];
+									char32_t c = char_at(index + j + 1);
 									if (c == 0) {
 										r_err_str = "Unterminated String";
 										return ERR_PARSE_ERROR;
@@ -256,14 +426,14 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 								index += 4; //will add at the end anyway
 
 								if ((res & 0xfffffc00) == 0xd800) {
-									if (p_str[index + 1] != '\\' || p_str[index + 2] != 'u') {
+									if (char_at(index + 1) != '\\' || char_at(index + 2) != 'u') {
 										r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
 										return ERR_PARSE_ERROR;
 									}
 									index += 2;
 									char32_t trail = 0;
 									for (int j = 0; j < 4; j++) {
-										char32_t c = p_str[index + j + 1];
+										char32_t c = char_at(index + j + 1);
 										if (c == 0) {
 											r_err_str = "Unterminated String";
 											return ERR_PARSE_ERROR;
@@ -313,42 +483,38 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 							}
 						}
 
-						str += res;
+						_json_append_code_point(str, res);
 
 					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
-						str += p_str[index];
+						// Newline.
+						line++;
+						str.push_back(p_str[index]);
 					}
 					index++;
 				}
 
 				r_token.type = TK_STRING;
-				r_token.value = str;
+				r_token.value = _json_make_string(str);
 				return OK;
 
 			} break;
 			default: {
-				if (p_str[index] <= 32) {
+				if (char_at(index) <= 32) {
 					index++;
 					break;
 				}
 
-				if (p_str[index] == '-' || is_digit(p_str[index])) {
+				if (char_at(index) == '-' || is_digit(char_at(index))) {
 					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
-					index += (rptr - &p_str[index]);
 					r_token.type = TK_NUMBER;
-					r_token.value = number;
+					r_token.value = _json_parse_number(p_str, index, p_len);
 					return OK;
 
-				} else if (is_ascii_alphabet_char(p_str[index])) {
+				} else if (is_ascii_alphabet_char(char_at(index))) {
 					String id;
 
-					while (is_ascii_alphabet_char(p_str[index])) {
-						id += p_str[index];
+					while (is_ascii_alphabet_char(char_at(index))) {
+						id += char_at(index);
 						index++;
 					}
 
@@ -366,51 +532,53 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C, typename H>
+Error JSON::_parse_value(H &r_handler, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep. Bailing.";
 		return ERR_OUT_OF_MEMORY;
 	}
 
+	Error err;
 	if (token.type == TK_CURLY_BRACKET_OPEN) {
-		Dictionary d;
-		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, r_err_str);
-		if (err) {
-			return err;
+		err = r_handler.begin_object();
+		if (err == OK) {
+			return _parse_object(r_handler, p_str, index, p_len, line, p_depth + 1, r_err_str);
 		}
-		value = d;
 	} else if (token.type == TK_BRACKET_OPEN) {
-		Array a;
-		Error err = _parse_array(a, p_str, index, p_len, line, p_depth + 1, r_err_str);
-		if (err) {
-			return err;
+		err = r_handler.begin_array();
+		if (err == OK) {
+			return _parse_array(r_handler, p_str, index, p_len, line, p_depth + 1, r_err_str);
 		}
-		value = a;
 	} else if (token.type == TK_IDENTIFIER) {
 		String id = token.value;
 		if (id == "true") {
-			value = true;
+			err = r_handler.value(true);
 		} else if (id == "false") {
-			value = false;
+			err = r_handler.value(false);
 		} else if (id == "null") {
-			value = Variant();
+			err = r_handler.value(Variant());
 		} else {
 			r_err_str = "Expected 'true','false' or 'null', got '" + id + "'.";
 			return ERR_PARSE_ERROR;
 		}
 	} else if (token.type == TK_NUMBER) {
-		value = token.value;
+		err = r_handler.value(token.value);
 	} else if (token.type == TK_STRING) {
-		value = token.value;
+		err = r_handler.value(token.value);
 	} else {
 		r_err_str = "Expected value, got " + String(tk_name[token.type]) + ".";
 		return ERR_PARSE_ERROR;
 	}
 
-	return OK;
+	if (err != OK) {
+		r_err_str = "Parsing stopped by the event handler.";
+	}
+	return err;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C, typename H>
+Error JSON::_parse_array(H &r_handler, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	Token token;
 	bool need_comma = false;
 
@@ -421,7 +589,11 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 		}
 
 		if (token.type == TK_BRACKET_CLOSE) {
-			return OK;
+			err = r_handler.end_array();
+			if (err != OK) {
+				r_err_str = "Parsing stopped by the event handler.";
+			}
+			return err;
 		}
 
 		if (need_comma) {
@@ -434,13 +606,11 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 			}
 		}
 
-		Variant v;
-		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+		err = _parse_value(r_handler, token, p_str, index, p_len, line, p_depth, r_err_str);
 		if (err) {
 			return err;
 		}
 
-		array.push_back(v);
 		need_comma = true;
 	}
 
@@ -448,7 +618,8 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C, typename H>
+Error JSON::_parse_object(H &r_handler, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
 	bool at_key = true;
 	String key;
 	Token token;
@@ -462,7 +633,11 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 			}
 
 			if (token.type == TK_CURLY_BRACKET_CLOSE) {
-				return OK;
+				err = r_handler.end_object();
+				if (err != OK) {
+					r_err_str = "Parsing stopped by the event handler.";
+				}
+				return err;
 			}
 
 			if (need_comma) {
@@ -489,6 +664,11 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 				r_err_str = "Expected ':'";
 				return ERR_PARSE_ERROR;
 			}
+			err = r_handler.key(key);
+			if (err != OK) {
+				r_err_str = "Parsing stopped by the event handler.";
+				return err;
+			}
 			at_key = false;
 		} else {
 			Error err = _get_token(p_str, index, p_len, token, line, r_err_str);
@@ -496,12 +676,10 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 				return err;
 			}
 
-			Variant v;
-			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+			err = _parse_value(r_handler, token, p_str, index, p_len, line, p_depth, r_err_str);
 			if (err) {
 				return err;
 			}
-			object[key] = v;
 			need_comma = true;
 			at_key = true;
 		}
@@ -516,30 +694,85 @@ void JSON::set_data(const Variant &p_data) {
 	text.clear();
 }
 
-Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
-	const char32_t *str = p_json.ptr();
+// Builds the Variant of a whole document from the parser events, for parse() and parse_utf8().
+class JSONVariantBuilder {
+	struct Level {
+		Variant container;
+		String key;
+	};
+
+	LocalVector<Level> levels;
+
+	_FORCE_INLINE_ void _add(const Variant &p_value) {
+		if (levels.is_empty()) {
+			result = p_value;
+			complete = true;
+			return;
+		}
+		Level &level = levels[levels.size() - 1];
+		if (level.container.get_type() == Variant::ARRAY) {
+			VariantInternal::get_array(&level.container)->push_back(p_value);
+		} else {
+			(*VariantInternal::get_dictionary(&level.container))[level.key] = p_value;
+		}
+	}
+
+	_FORCE_INLINE_ void _end() {
+		const Variant container = levels[levels.size() - 1].container;
+		levels.resize(levels.size() - 1);
+		_add(container);
+	}
+
+public:
+	Variant result;
+	bool complete = false; // The whole value was parsed, even if followed by something else.
+
+	_FORCE_INLINE_ Error begin_object() {
+		levels.push_back({ Dictionary(), String() });
+		return OK;
+	}
+	_FORCE_INLINE_ Error key(const String &p_key) {
+		levels[levels.size() - 1].key = p_key;
+		return OK;
+	}
+	_FORCE_INLINE_ Error end_object() {
+		_end();
+		return OK;
+	}
+	_FORCE_INLINE_ Error begin_array() {
+		levels.push_back({ Array(), String() });
+		return OK;
+	}
+	_FORCE_INLINE_ Error end_array() {
+		_end();
+		return OK;
+	}
+	_FORCE_INLINE_ Error value(const Variant &p_value) {
+		_add(p_value);
+		return OK;
+	}
+};
+
+template <typename C, typename H>
+Error JSON::_parse(const C *p_str, int p_len, H &r_handler, String &r_err_str, int &r_err_line) {
 	int idx = 0;
-	int len = p_json.length();
 	Token token;
 	r_err_line = 0;
-	String aux_key;
 
-	Error err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	Error err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 	if (err) {
 		return err;
 	}
 
-	err = _parse_value(r_ret, token, str, idx, len, r_err_line, 0, r_err_str);
+	err = _parse_value(r_handler, token, p_str, idx, p_len, r_err_line, 0, r_err_str);
 
 	// Check if EOF is reached
 	// or it's a type of the next token.
-	if (err == OK && idx < len) {
-		err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	if (err == OK && idx < p_len) {
+		err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 
 		if (err || token.type != TK_EOF) {
 			r_err_str = "Expected 'EOF'";
-			// Reset return value to empty `Variant`
-			r_ret = Variant();
 			return ERR_PARSE_ERROR;
 		}
 	}
@@ -547,6 +780,107 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 	return err;
 }
 
+template <typename C>
+Error JSON::_parse_variant(const C *p_str, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	JSONVariantBuilder builder;
+	Error err = _parse(p_str, p_len, builder, r_err_str, r_err_line);
+	if (err == OK) {
+		r_ret = builder.result;
+	} else if (builder.complete) {
+		// Reset return value to empty `Variant`
+		r_ret = Variant();
+	}
+	return err;
+}
+
+static _FORCE_INLINE_ void _json_skip_bom(const uint8_t *&r_json, int &r_len) {
+	// Skip the byte order mark, like String::parse_utf8() does.
+	if (r_len >= 3 && r_json[0] == 0xef && r_json[1] == 0xbb && r_json[2] == 0xbf) {
+		r_json += 3;
+		r_len -= 3;
+	}
+}
+
+Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	return _parse_variant(p_json.ptr(), p_json.length(), r_ret, r_err_str, r_err_line);
+}
+
+Error JSON::_parse_utf8(const uint8_t *p_json, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	_json_skip_bom(p_json, p_len);
+	return _parse_variant(p_json, p_len, r_ret, r_err_str, r_err_line);
+}
+
+Error JSON::parse_events(const String &p_json, EventHandler *p_handler, String *r_err_str, int *r_err_line) {
+	ERR_FAIL_NULL_V(p_handler, ERR_INVALID_PARAMETER);
+	String err_str;
+	int err_line = 0;
+	Error err = _parse(p_json.ptr(), p_json.length(), *p_handler, err_str, err_line);
+	if (r_err_str) {
+		*r_err_str = err == OK ? String() : err_str;
+	}
+	if (r_err_line) {
+		*r_err_line = err == OK ? 0 : err_line;
+	}
+	return err;
+}
+
+Error JSON::parse_utf8_events(const uint8_t *p_json, int p_len, EventHandler *p_handler, String *r_err_str, int *r_err_line) {
+	ERR_FAIL_NULL_V(p_handler, ERR_INVALID_PARAMETER);
+	_json_skip_bom(p_json, p_len);
+	String err_str;
+	int err_line = 0;
+	Error err = _parse(p_json, p_len, *p_handler, err_str, err_line);
+	if (r_err_str) {
+		*r_err_str = err == OK ? String() : err_str;
+	}
+	if (r_err_line) {
+		*r_err_line = err == OK ? 0 : err_line;
+	}
+	return err;
+}
+
+// Forwards the parser events to a script callback.
+class JSONCallableEventHandler : public JSON::EventHandler {
+	Callable callback;
+
+	Error _call(JSON::Event p_event, const Variant &p_value) {
+		const Variant event = p_event;
+		const Variant *args[2] = { &event, &p_value };
+		Variant ret;
+		Callable::CallError ce;
+		callback.callp(args, 2, ret, ce);
+		if (ce.error != Callable::CallError::CALL_OK) {
+			ERR_PRINT("Error calling the JSON event callback: " + Variant::get_callable_error_text(callback, args, 2, ce) + ".");
+			return ERR_INVALID_PARAMETER;
+		}
+		// Only an explicit `false` stops parsing, callbacks returning nothing continue.
+		return (ret.get_type() == Variant::BOOL && !bool(ret)) ? ERR_SKIP : OK;
+	}
+
+public:
+	virtual Error begin_object() override { return _call(JSON::EVENT_OBJECT_BEGIN, Variant()); }
+	virtual Error key(const String &p_key) override { return _call(JSON::EVENT_OBJECT_KEY, p_key); }
+	virtual Error end_object() override { return _call(JSON::EVENT_OBJECT_END, Variant()); }
+	virtual Error begin_array() override { return _call(JSON::EVENT_ARRAY_BEGIN, Variant()); }
+	virtual Error end_array() override { return _call(JSON::EVENT_ARRAY_END, Variant()); }
+	virtual Error value(const Variant &p_value) override { return _call(JSON::EVENT_VALUE, p_value); }
+
+	JSONCallableEventHandler(const Callable &p_callback) :
+			callback(p_callback) {}
+};
+
+Error JSON::_parse_utf8_events_bind(const PackedByteArray &p_json_utf8, const Callable &p_callback) {
+	ERR_FAIL_COND_V(!p_callback.is_valid(), ERR_INVALID_PARAMETER);
+	JSONCallableEventHandler handler(p_callback);
+	String err_str;
+	int err_line = 0;
+	Error err = parse_utf8_events(p_json_utf8.ptr(), p_json_utf8.size(), &handler, &err_str, &err_line);
+	if (err != OK && err != ERR_SKIP) {
+		ERR_PRINT(vformat("Parse JSON failed. Error at line %d: %s", err_line, err_str));
+	}
+	return err;
+}
+
 Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	Error err = _parse_string(p_json_string, data, err_str, err_line);
 	if (err == Error::OK) {
@@ -558,6 +892,18 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_utf8(const PackedByteArray &p_json_utf8, bool p_keep_text) {
+	Error err = _parse_utf8(p_json_utf8.ptr(), p_json_utf8.size(), data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	if (p_keep_text) {
+		text.clear();
+		text.parse_utf8((const char *)p_json_utf8.ptr(), p_json_utf8.size());
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
@@ -566,7 +912,9 @@ String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort
 	Ref<JSON> jason;
 	jason.instantiate();
 	HashSet<const void *> markers;
-	return jason->_stringify(p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	String result;
+	jason->_stringify(result, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	return result;
 }
 
 Variant JSON::parse_string(const String &p_json_string) {
@@ -581,6 +929,8 @@ void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_utf8", "json_utf8", "keep_text"), &JSON::parse_utf8, DEFVAL(false));
+	ClassDB::bind_static_method("JSON", D_METHOD("parse_utf8_events", "json_utf8", "callback"), &JSON::_parse_utf8_events_bind);
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -592,6 +942,13 @@ void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("from_native", "variant", "allow_classes", "allow_scripts"), &JSON::from_native, DEFVAL(false), DEFVAL(false));
 
 	ADD_PROPERTY(PropertyInfo(Variant::NIL, "data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_NIL_IS_VARIANT), "set_data", "get_data"); // Ensures that it can be serialized as binary.
+
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_KEY);
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_END);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_END);
+	BIND_ENUM_CONSTANT(EVENT_VALUE);
 }
 
 #define GDTYPE "__gdtype"
@@ -1354,7 +1711,7 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err = json->parse_utf8(FileAccess::get_file_as_bytes(p_path), Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
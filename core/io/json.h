@@ -72,19 +72,60 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static String _make_indent(const String &p_indent, int p_size);
-	static String _stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	static void _append_indent(String &r_result, const String &p_indent, int p_size);
+	static void _stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
+
+	// The parser runs either on a String (C = char32_t) or directly on UTF-8 bytes (C = uint8_t),
+	// and reports what it finds to H, an EventHandler or the builder of the parsed Variant.
+	template <typename C>
+	static Error _get_token(const C *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
+	template <typename C, typename H>
+	static Error _parse_value(H &r_handler, Token &token, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C, typename H>
+	static Error _parse_array(H &r_handler, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C, typename H>
+	static Error _parse_object(H &r_handler, const C *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C, typename H>
+	static Error _parse(const C *p_str, int p_len, H &r_handler, String &r_err_str, int &r_err_line);
+	template <typename C>
+	static Error _parse_variant(const C *p_str, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line);
 	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static Error _parse_utf8(const uint8_t *p_json, int p_len, Variant &r_ret, String &r_err_str, int &r_err_line);
+
+	static Error _parse_utf8_events_bind(const PackedByteArray &p_json_utf8, const Callable &p_callback);
 
 protected:
 	static void _bind_methods();
 
 public:
+	enum Event {
+		EVENT_OBJECT_BEGIN,
+		EVENT_OBJECT_KEY,
+		EVENT_OBJECT_END,
+		EVENT_ARRAY_BEGIN,
+		EVENT_ARRAY_END,
+		EVENT_VALUE,
+	};
+
+	// Receives the contents of a document while it's parsed, for streaming large documents
+	// without building the Variants of their objects and arrays. Returning an error from any
+	// of the methods stops parsing, which then fails with that error.
+	class EventHandler {
+	public:
+		virtual Error begin_object() = 0;
+		virtual Error key(const String &p_key) = 0;
+		virtual Error end_object() = 0;
+		virtual Error begin_array() = 0;
+		virtual Error end_array() = 0;
+		virtual Error value(const Variant &p_value) = 0; // Strings, numbers, booleans and null.
+		virtual ~EventHandler() {}
+	};
+
+	static Error parse_events(const String &p_json, EventHandler *p_handler, String *r_err_str = nullptr, int *r_err_line = nullptr);
+	static Error parse_utf8_events(const uint8_t *p_json, int p_len, EventHandler *p_handler, String *r_err_str = nullptr, int *r_err_line = nullptr);
+
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_utf8(const PackedByteArray &p_json_utf8, bool p_keep_text = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
@@ -99,6 +140,8 @@ public:
 	static Variant to_native(const Variant &p_json, bool p_allow_classes = false, bool p_allow_scripts = false);
 };
 
+VARIANT_ENUM_CAST(JSON::Event);
+
 class ResourceFormatLoaderJSON : public ResourceFormatLoader {
 public:
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
@@ -35,6 +35,7 @@
 #include "core/object/script_language.h"
 #include "core/os/keyboard.h"
 #include "core/string/print_string.h"
+#include "core/variant/variant_internal.h"
 
 #include <limits.h>
 #include <stdio.h>
@@ -2056,6 +2057,509 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+// Schema-based encoding.
+//
+// The schema is a value with the same shape as the data, known to both ends in advance, so no
+// type headers need to be written:
+// - NIL accepts any value and writes it with encode_variant().
+// - Integers are zigzag varints, floats are doubles, strings are a varint length and UTF-8 bytes.
+// - Math types and packed arrays are written as raw little-endian scalars, with real_t precision.
+// - An untyped Dictionary is a record: its keys are written implicitly, in schema order, and its
+//   values are the schemas of the fields.
+// - A typed Dictionary is a map whose keys and values are written with their builtin types.
+// - A typed Array holds values of its builtin type. An untyped Array with one element uses that
+//   element as the schema of every item, and an empty untyped Array accepts any items.
+
+static void _encode_varint(uint64_t p_value, uint8_t *&buf, int &r_len) {
+	do {
+		uint8_t byte = p_value & 0x7F;
+		p_value >>= 7;
+		if (p_value) {
+			byte |= 0x80;
+		}
+		if (buf) {
+			*buf = byte;
+			buf++;
+		}
+		r_len++;
+	} while (p_value);
+}
+
+static Error _decode_varint(const uint8_t *&buf, int &len, uint64_t &r_value) {
+	r_value = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		ERR_FAIL_COND_V(len < 1, ERR_INVALID_DATA);
+		const uint8_t byte = *buf;
+		buf++;
+		len--;
+		r_value |= uint64_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			return OK;
+		}
+	}
+	ERR_FAIL_V(ERR_INVALID_DATA);
+}
+
+static void _encode_components(const void *p_src, int64_t p_count, int p_size, uint8_t *&buf, int &r_len) {
+	const int64_t bytes = p_count * p_size;
+	if (buf) {
+#ifdef BIG_ENDIAN_ENABLED
+		const uint8_t *src = (const uint8_t *)p_src;
+		for (int64_t i = 0; i < p_count; i++) {
+			for (int j = 0; j < p_size; j++) {
+				buf[i * p_size + j] = src[i * p_size + p_size - 1 - j];
+			}
+		}
+#else
+		memcpy(buf, p_src, bytes);
+#endif
+		buf += bytes;
+	}
+	r_len += bytes;
+}
+
+static Error _decode_components(void *r_dst, int64_t p_count, int p_size, const uint8_t *&buf, int &len) {
+	ERR_FAIL_COND_V(p_count > len / p_size, ERR_INVALID_DATA);
+	const int64_t bytes = p_count * p_size;
+#ifdef BIG_ENDIAN_ENABLED
+	uint8_t *dst = (uint8_t *)r_dst;
+	for (int64_t i = 0; i < p_count; i++) {
+		for (int j = 0; j < p_size; j++) {
+			dst[i * p_size + j] = buf[i * p_size + p_size - 1 - j];
+		}
+	}
+#else
+	memcpy(r_dst, buf, bytes);
+#endif
+	buf += bytes;
+	len -= bytes;
+	return OK;
+}
+
+static bool _get_flat_layout(Variant::Type p_type, int &r_count, int &r_size) {
+	switch (p_type) {
+		case Variant::VECTOR2:
+			r_count = sizeof(Vector2) / sizeof(real_t);
+			break;
+		case Variant::RECT2:
+			r_count = sizeof(Rect2) / sizeof(real_t);
+			break;
+		case Variant::VECTOR3:
+			r_count = sizeof(Vector3) / sizeof(real_t);
+			break;
+		case Variant::TRANSFORM2D:
+			r_count = sizeof(Transform2D) / sizeof(real_t);
+			break;
+		case Variant::VECTOR4:
+			r_count = sizeof(Vector4) / sizeof(real_t);
+			break;
+		case Variant::PLANE:
+			r_count = sizeof(Plane) / sizeof(real_t);
+			break;
+		case Variant::QUATERNION:
+			r_count = sizeof(Quaternion) / sizeof(real_t);
+			break;
+		case Variant::AABB:
+			r_count = sizeof(AABB) / sizeof(real_t);
+			break;
+		case Variant::BASIS:
+			r_count = sizeof(Basis) / sizeof(real_t);
+			break;
+		case Variant::TRANSFORM3D:
+			r_count = sizeof(Transform3D) / sizeof(real_t);
+			break;
+		case Variant::PROJECTION:
+			r_count = sizeof(Projection) / sizeof(real_t);
+			break;
+		case Variant::VECTOR2I:
+			r_count = sizeof(Vector2i) / sizeof(int32_t);
+			r_size = sizeof(int32_t);
+			return true;
+		case Variant::RECT2I:
+			r_count = sizeof(Rect2i) / sizeof(int32_t);
+			r_size = sizeof(int32_t);
+			return true;
+		case Variant::VECTOR3I:
+			r_count = sizeof(Vector3i) / sizeof(int32_t);
+			r_size = sizeof(int32_t);
+			return true;
+		case Variant::VECTOR4I:
+			r_count = sizeof(Vector4i) / sizeof(int32_t);
+			r_size = sizeof(int32_t);
+			return true;
+		case Variant::COLOR:
+			r_count = sizeof(Color) / sizeof(float);
+			r_size = sizeof(float);
+			return true;
+		default:
+			return false;
+	}
+	r_size = sizeof(real_t);
+	return true;
+}
+
+static Variant _make_schema_for_type(uint32_t p_type) {
+	if (p_type == Variant::NIL || p_type == Variant::OBJECT) {
+		return Variant();
+	}
+	Variant schema;
+	Callable::CallError ce;
+	Variant::construct(Variant::Type(p_type), schema, nullptr, 0, ce);
+	return schema;
+}
+
+template <typename T>
+static void _encode_packed_array(const Vector<T> &p_array, int p_component_size, uint8_t *&buf, int &r_len) {
+	_encode_varint(p_array.size(), buf, r_len);
+	_encode_components(p_array.ptr(), int64_t(p_array.size()) * (sizeof(T) / p_component_size), p_component_size, buf, r_len);
+}
+
+template <typename T>
+static Error _decode_packed_array(Variant &r_variant, int p_component_size, const uint8_t *&buf, int &len) {
+	uint64_t count = 0;
+	Error err = _decode_varint(buf, len, count);
+	ERR_FAIL_COND_V(err, err);
+	ERR_FAIL_COND_V(count > uint64_t(len) / sizeof(T), ERR_INVALID_DATA);
+
+	Vector<T> array;
+	if (count) {
+		array.resize(count);
+		err = _decode_components(array.ptrw(), count * (sizeof(T) / p_component_size), p_component_size, buf, len);
+		ERR_FAIL_COND_V(err, err);
+	}
+	r_variant = array;
+	return OK;
+}
+
+static void _encode_schema_string(const String &p_string, uint8_t *&buf, int &r_len) {
+	const CharString utf8 = p_string.utf8();
+	_encode_varint(utf8.length(), buf, r_len);
+	_encode_components(utf8.get_data(), utf8.length(), 1, buf, r_len);
+}
+
+static Error _decode_schema_string(const uint8_t *&buf, int &len, String &r_string) {
+	uint64_t length = 0;
+	Error err = _decode_varint(buf, len, length);
+	ERR_FAIL_COND_V(err, err);
+	ERR_FAIL_COND_V(length > uint64_t(len), ERR_INVALID_DATA);
+	r_string.clear();
+	if (length) {
+		ERR_FAIL_COND_V(r_string.parse_utf8((const char *)buf, length) != OK, ERR_INVALID_DATA);
+	}
+	buf += length;
+	len -= length;
+	return OK;
+}
+
+static Error _encode_with_schema(const Variant &p_variant, const Variant &p_schema, uint8_t *&buf, int &r_len, bool p_full_objects, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+
+	const Variant::Type type = p_schema.get_type();
+	if (type == Variant::NIL || type == Variant::OBJECT) {
+		int len = 0;
+		Error err = encode_variant(p_variant, buf, len, p_full_objects, p_depth + 1);
+		ERR_FAIL_COND_V(err, err);
+		if (buf) {
+			buf += len;
+		}
+		r_len += len;
+		return OK;
+	}
+
+	ERR_FAIL_COND_V_MSG(p_variant.get_type() != type, ERR_INVALID_PARAMETER, vformat("Value of type %s doesn't match schema type %s.", Variant::get_type_name(p_variant.get_type()), Variant::get_type_name(type)));
+
+	int flat_count = 0;
+	int flat_size = 0;
+	if (_get_flat_layout(type, flat_count, flat_size)) {
+		_encode_components(VariantInternal::get_opaque_pointer(&p_variant), flat_count, flat_size, buf, r_len);
+		return OK;
+	}
+
+	switch (type) {
+		case Variant::BOOL: {
+			if (buf) {
+				*buf = p_variant.operator bool() ? 1 : 0;
+				buf++;
+			}
+			r_len++;
+		} break;
+		case Variant::INT: {
+			const int64_t value = p_variant;
+			_encode_varint((uint64_t(value) << 1) ^ uint64_t(value >> 63), buf, r_len);
+		} break;
+		case Variant::FLOAT: {
+			const double value = p_variant;
+			_encode_components(&value, 1, sizeof(double), buf, r_len);
+		} break;
+		case Variant::STRING:
+		case Variant::STRING_NAME: {
+			_encode_schema_string(p_variant, buf, r_len);
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary schema = p_schema;
+			const Dictionary dict = p_variant;
+
+			if (!schema.is_typed()) {
+				ERR_FAIL_COND_V_MSG(dict.size() != schema.size(), ERR_INVALID_PARAMETER, "Dictionary doesn't have the fields of its schema.");
+				const Variant *key = nullptr;
+				while ((key = schema.next(key))) {
+					const Variant *value = dict.getptr(*key);
+					ERR_FAIL_NULL_V_MSG(value, ERR_INVALID_PARAMETER, vformat("Dictionary is missing the field \"%s\" of its schema.", *key));
+					Error err = _encode_with_schema(*value, schema[*key], buf, r_len, p_full_objects, p_depth + 1);
+					ERR_FAIL_COND_V(err, err);
+				}
+				break;
+			}
+
+			const Variant key_schema = _make_schema_for_type(schema.get_typed_key_builtin());
+			const Variant value_schema = _make_schema_for_type(schema.get_typed_value_builtin());
+			_encode_varint(dict.size(), buf, r_len);
+			const Variant *key = nullptr;
+			while ((key = dict.next(key))) {
+				Error err = _encode_with_schema(*key, key_schema, buf, r_len, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+				err = _encode_with_schema(dict[*key], value_schema, buf, r_len, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+			}
+		} break;
+		case Variant::ARRAY: {
+			const Array schema = p_schema;
+			const Array array = p_variant;
+
+			Variant item_schema;
+			if (schema.is_typed()) {
+				item_schema = _make_schema_for_type(schema.get_typed_builtin());
+			} else if (schema.size() == 1) {
+				item_schema = schema[0];
+			}
+
+			_encode_varint(array.size(), buf, r_len);
+			for (const Variant &item : array) {
+				Error err = _encode_with_schema(item, item_schema, buf, r_len, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+			}
+		} break;
+		case Variant::PACKED_BYTE_ARRAY: {
+			_encode_packed_array<uint8_t>(p_variant, sizeof(uint8_t), buf, r_len);
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			_encode_packed_array<int32_t>(p_variant, sizeof(int32_t), buf, r_len);
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			_encode_packed_array<int64_t>(p_variant, sizeof(int64_t), buf, r_len);
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			_encode_packed_array<float>(p_variant, sizeof(float), buf, r_len);
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			_encode_packed_array<double>(p_variant, sizeof(double), buf, r_len);
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			_encode_packed_array<Vector2>(p_variant, sizeof(real_t), buf, r_len);
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			_encode_packed_array<Vector3>(p_variant, sizeof(real_t), buf, r_len);
+		} break;
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			_encode_packed_array<Vector4>(p_variant, sizeof(real_t), buf, r_len);
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			_encode_packed_array<Color>(p_variant, sizeof(float), buf, r_len);
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			const PackedStringArray array = p_variant;
+			_encode_varint(array.size(), buf, r_len);
+			for (const String &string : array) {
+				_encode_schema_string(string, buf, r_len);
+			}
+		} break;
+		default: {
+			// No compact form, keep the type header.
+			int len = 0;
+			Error err = encode_variant(p_variant, buf, len, p_full_objects, p_depth + 1);
+			ERR_FAIL_COND_V(err, err);
+			if (buf) {
+				buf += len;
+			}
+			r_len += len;
+		} break;
+	}
+
+	return OK;
+}
+
+static Error _decode_with_schema(Variant &r_variant, const Variant &p_schema, const uint8_t *&buf, int &len, bool p_allow_objects, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+
+	const Variant::Type type = p_schema.get_type();
+
+	int flat_count = 0;
+	int flat_size = 0;
+	if (_get_flat_layout(type, flat_count, flat_size)) {
+		r_variant = p_schema;
+		return _decode_components(VariantInternal::get_opaque_pointer(&r_variant), flat_count, flat_size, buf, len);
+	}
+
+	switch (type) {
+		case Variant::BOOL: {
+			ERR_FAIL_COND_V(len < 1, ERR_INVALID_DATA);
+			r_variant = *buf != 0;
+			buf++;
+			len--;
+		} break;
+		case Variant::INT: {
+			uint64_t value = 0;
+			Error err = _decode_varint(buf, len, value);
+			ERR_FAIL_COND_V(err, err);
+			r_variant = int64_t(value >> 1) ^ -int64_t(value & 1);
+		} break;
+		case Variant::FLOAT: {
+			double value = 0;
+			Error err = _decode_components(&value, 1, sizeof(double), buf, len);
+			ERR_FAIL_COND_V(err, err);
+			r_variant = value;
+		} break;
+		case Variant::STRING: {
+			String string;
+			Error err = _decode_schema_string(buf, len, string);
+			ERR_FAIL_COND_V(err, err);
+			r_variant = string;
+		} break;
+		case Variant::STRING_NAME: {
+			String string;
+			Error err = _decode_schema_string(buf, len, string);
+			ERR_FAIL_COND_V(err, err);
+			r_variant = StringName(string);
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary schema = p_schema;
+			Dictionary dict;
+
+			if (!schema.is_typed()) {
+				const Variant *key = nullptr;
+				while ((key = schema.next(key))) {
+					Variant value;
+					Error err = _decode_with_schema(value, schema[*key], buf, len, p_allow_objects, p_depth + 1);
+					ERR_FAIL_COND_V(err, err);
+					dict[*key] = value;
+				}
+				r_variant = dict;
+				break;
+			}
+
+			dict.set_typed(schema.get_typed_key_builtin(), schema.get_typed_key_class_name(), schema.get_typed_key_script(), schema.get_typed_value_builtin(), schema.get_typed_value_class_name(), schema.get_typed_value_script());
+			const Variant key_schema = _make_schema_for_type(schema.get_typed_key_builtin());
+			const Variant value_schema = _make_schema_for_type(schema.get_typed_value_builtin());
+			uint64_t count = 0;
+			Error err = _decode_varint(buf, len, count);
+			ERR_FAIL_COND_V(err, err);
+			ERR_FAIL_COND_V(count > uint64_t(len), ERR_INVALID_DATA);
+			for (uint64_t i = 0; i < count; i++) {
+				Variant key;
+				err = _decode_with_schema(key, key_schema, buf, len, p_allow_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+				Variant value;
+				err = _decode_with_schema(value, value_schema, buf, len, p_allow_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+				dict[key] = value;
+			}
+			r_variant = dict;
+		} break;
+		case Variant::ARRAY: {
+			const Array schema = p_schema;
+			Array array;
+
+			Variant item_schema;
+			if (schema.is_typed()) {
+				array.set_typed(schema.get_typed_builtin(), schema.get_typed_class_name(), schema.get_typed_script());
+				item_schema = _make_schema_for_type(schema.get_typed_builtin());
+			} else if (schema.size() == 1) {
+				item_schema = schema[0];
+			}
+
+			uint64_t count = 0;
+			Error err = _decode_varint(buf, len, count);
+			ERR_FAIL_COND_V(err, err);
+			ERR_FAIL_COND_V(count > uint64_t(len), ERR_INVALID_DATA);
+			array.resize(count);
+			for (uint64_t i = 0; i < count; i++) {
+				Variant item;
+				err = _decode_with_schema(item, item_schema, buf, len, p_allow_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+				array[i] = item;
+			}
+			r_variant = array;
+		} break;
+		case Variant::PACKED_BYTE_ARRAY: {
+			return _decode_packed_array<uint8_t>(r_variant, sizeof(uint8_t), buf, len);
+		}
+		case Variant::PACKED_INT32_ARRAY: {
+			return _decode_packed_array<int32_t>(r_variant, sizeof(int32_t), buf, len);
+		}
+		case Variant::PACKED_INT64_ARRAY: {
+			return _decode_packed_array<int64_t>(r_variant, sizeof(int64_t), buf, len);
+		}
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			return _decode_packed_array<float>(r_variant, sizeof(float), buf, len);
+		}
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			return _decode_packed_array<double>(r_variant, sizeof(double), buf, len);
+		}
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			return _decode_packed_array<Vector2>(r_variant, sizeof(real_t), buf, len);
+		}
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			return _decode_packed_array<Vector3>(r_variant, sizeof(real_t), buf, len);
+		}
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			return _decode_packed_array<Vector4>(r_variant, sizeof(real_t), buf, len);
+		}
+		case Variant::PACKED_COLOR_ARRAY: {
+			return _decode_packed_array<Color>(r_variant, sizeof(float), buf, len);
+		}
+		case Variant::PACKED_STRING_ARRAY: {
+			uint64_t count = 0;
+			Error err = _decode_varint(buf, len, count);
+			ERR_FAIL_COND_V(err, err);
+			ERR_FAIL_COND_V(count > uint64_t(len), ERR_INVALID_DATA);
+			PackedStringArray array;
+			array.resize(count);
+			String *w = array.ptrw();
+			for (uint64_t i = 0; i < count; i++) {
+				err = _decode_schema_string(buf, len, w[i]);
+				ERR_FAIL_COND_V(err, err);
+			}
+			r_variant = array;
+		} break;
+		default: {
+			// NIL, OBJECT and types without a compact form carry their type header.
+			int used = 0;
+			Error err = decode_variant(r_variant, buf, len, &used, p_allow_objects, p_depth + 1);
+			ERR_FAIL_COND_V(err, err);
+			buf += used;
+			len -= used;
+		} break;
+	}
+
+	return OK;
+}
+
+Error encode_variant_with_schema(const Variant &p_variant, const Variant &p_schema, uint8_t *r_buffer, int &r_len, bool p_full_objects) {
+	uint8_t *buf = r_buffer;
+	r_len = 0;
+	return _encode_with_schema(p_variant, p_schema, buf, r_len, p_full_objects, 0);
+}
+
+Error decode_variant_with_schema(Variant &r_variant, const Variant &p_schema, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects) {
+	const uint8_t *buf = p_buffer;
+	int len = p_len;
+	Error err = _decode_with_schema(r_variant, p_schema, buf, len, p_allow_objects, 0);
+	if (err == OK && r_len) {
+		*r_len = p_len - len;
+	}
+	return err;
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't memcpy.
 	// We also don't consider returning a pointer to the passed vectors when sizeof(real_t) == 4.
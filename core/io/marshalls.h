@@ -215,6 +215,10 @@ public:
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
 
+// Compact encoding for values whose layout is known to both ends, see marshalls.cpp for the schema format.
+Error encode_variant_with_schema(const Variant &p_variant, const Variant &p_schema, uint8_t *r_buffer, int &r_len, bool p_full_objects = false);
+Error decode_variant_with_schema(Variant &r_variant, const Variant &p_schema, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false);
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
 
 #endif // MARSHALLS_H
@@ -113,6 +113,50 @@ Error PacketPeer::put_var(const Variant &p_packet, bool p_full_objects) {
 	return put_packet(w, len);
 }
 
+Error PacketPeer::get_var_with_schema(Variant &r_variant, const Variant &p_schema, bool p_allow_objects) {
+	const uint8_t *buffer;
+	int buffer_size;
+	Error err = get_packet(&buffer, buffer_size);
+	if (err) {
+		return err;
+	}
+
+	return decode_variant_with_schema(r_variant, p_schema, buffer, buffer_size, nullptr, p_allow_objects);
+}
+
+Error PacketPeer::put_var_with_schema(const Variant &p_packet, const Variant &p_schema, bool p_full_objects) {
+	int len;
+	Error err = encode_variant_with_schema(p_packet, p_schema, nullptr, len, p_full_objects); // compute len first
+	if (err) {
+		return err;
+	}
+
+	if (len == 0) {
+		return OK;
+	}
+
+	ERR_FAIL_COND_V_MSG(len > encode_buffer_max_size, ERR_OUT_OF_MEMORY, "Failed to encode variant, encode size is bigger then encode_buffer_max_size. Consider raising it via 'set_encode_buffer_max_size'.");
+
+	if (unlikely(encode_buffer.size() < len)) {
+		encode_buffer.resize(0); // Avoid realloc
+		encode_buffer.resize(next_power_of_2(len));
+	}
+
+	uint8_t *w = encode_buffer.ptrw();
+	err = encode_variant_with_schema(p_packet, p_schema, w, len, p_full_objects);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to encode Variant.");
+
+	return put_packet(w, len);
+}
+
+Variant PacketPeer::_bnd_get_var_with_schema(const Variant &p_schema, bool p_allow_objects) {
+	Variant var;
+	Error err = get_var_with_schema(var, p_schema, p_allow_objects);
+
+	ERR_FAIL_COND_V(err != OK, Variant());
+	return var;
+}
+
 Variant PacketPeer::_bnd_get_var(bool p_allow_objects) {
 	Variant var;
 	Error err = get_var(var, p_allow_objects);
@@ -138,6 +182,8 @@ Error PacketPeer::_get_packet_error() const {
 void PacketPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_var", "allow_objects"), &PacketPeer::_bnd_get_var, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("put_var", "var", "full_objects"), &PacketPeer::put_var, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_var_with_schema", "schema", "allow_objects"), &PacketPeer::_bnd_get_var_with_schema, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("put_var_with_schema", "var", "schema", "full_objects"), &PacketPeer::put_var_with_schema, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_packet"), &PacketPeer::_get_packet);
 	ClassDB::bind_method(D_METHOD("put_packet", "buffer"), &PacketPeer::_put_packet);
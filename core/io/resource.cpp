@@ -34,7 +34,9 @@
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
 #include "core/object/script_language.h"
+#include "core/os/condition_variable.h"
 #include "core/os/os.h"
+#include "core/os/thread.h"
 #include "scene/main/node.h" //only so casting works
 
 #include <stdio.h>
@@ -259,12 +261,14 @@ void Resource::_dupe_sub_resources(Variant &r_variant, Node *p_for_scene, HashMa
 					// Replace in dictionary key.
 					Ref<Resource> sr = k;
 					if (sr.is_valid() && sr->is_local_to_scene()) {
+						// Copied first, inserting the new key can move the existing values.
+						const Variant value = d[k];
 						if (p_remap_cache.has(sr)) {
-							d[p_remap_cache[sr]] = d[k];
+							d[p_remap_cache[sr]] = value;
 							d.erase(k);
 						} else {
 							Ref<Resource> dupe = sr->duplicate_for_local_scene(p_for_scene, p_remap_cache);
-							d[dupe] = d[k];
+							d[dupe] = value;
 							d.erase(k);
 							p_remap_cache[sr] = dupe;
 						}
@@ -440,6 +444,85 @@ RID Resource::get_rid() const {
 	return ret;
 }
 
+struct Resource::LazyPayload::LoadState {
+	BinaryMutex mutex;
+	ConditionVariable loaded_cond;
+	Thread::ID loading_thread = Thread::UNASSIGNED_ID;
+	bool loaded = false;
+	Error error = OK;
+};
+
+Resource::LazyPayload::LazyPayload() {
+	load_state = memnew(LoadState);
+}
+
+Resource::LazyPayload::~LazyPayload() {
+	memdelete(load_state);
+}
+
+void Resource::_discard_lazy_payload() {
+	if (lazy_payload_pending.is_set()) {
+		lazy_payloads_pending_count.decrement();
+		lazy_payloads_pending_size.sub(lazy_payload->get_size());
+		lazy_payload_pending.clear();
+	}
+	memdelete(lazy_payload);
+	lazy_payload = nullptr;
+}
+
+void Resource::set_lazy_payload(LazyPayload *p_payload) {
+	ERR_FAIL_NULL(p_payload);
+	ERR_FAIL_COND_MSG(!is_lazy_loadable(), "Resource of type '" + get_class() + "' doesn't support lazy loading.");
+
+	// Only loaders set payloads, before the resource is used anywhere else.
+	if (lazy_payload) {
+		_discard_lazy_payload();
+	}
+	lazy_payload = p_payload;
+	lazy_payload_pending.set();
+	lazy_payloads_pending_count.increment();
+	lazy_payloads_pending_size.add(p_payload->get_size());
+}
+
+Error Resource::load_lazy_payload() {
+	if (!lazy_payload_pending.is_set()) {
+		return OK;
+	}
+
+	LazyPayload::LoadState *state = lazy_payload->load_state;
+	{
+		MutexLock lock(state->mutex);
+		while (!state->loaded) {
+			if (state->loading_thread == Thread::UNASSIGNED_ID) {
+				state->loading_thread = Thread::get_caller_id();
+				break;
+			}
+			if (state->loading_thread == Thread::get_caller_id()) {
+				return OK; // Called back while the loaded properties are being set.
+			}
+			state->loaded_cond.wait(lock);
+		}
+		if (state->loaded) {
+			return state->error;
+		}
+	}
+
+	// The file is read with no lock held, other threads using this resource wait above meanwhile.
+	Error err = lazy_payload->load(this);
+
+	lazy_payloads_pending_count.decrement();
+	lazy_payloads_pending_size.sub(lazy_payload->get_size());
+	{
+		MutexLock lock(state->mutex);
+		state->error = err;
+		state->loaded = true;
+		lazy_payload_pending.clear();
+	}
+	state->loaded_cond.notify_all();
+
+	return err;
+}
+
 #ifdef TOOLS_ENABLED
 
 uint32_t Resource::hash_edited_version_for_preview() const {
@@ -493,6 +576,8 @@ void Resource::reset_local_to_scene() {
 
 Node *(*Resource::_get_local_scene_func)() = nullptr;
 void (*Resource::_update_configuration_warning)() = nullptr;
+SafeNumeric<uint32_t> Resource::lazy_payloads_pending_count;
+SafeNumeric<uint64_t> Resource::lazy_payloads_pending_size;
 
 void Resource::set_as_translation_remapped(bool p_remapped) {
 	if (remapped_list.in_list() == p_remapped) {
@@ -584,6 +669,10 @@ Resource::Resource() :
 		remapped_list(this) {}
 
 Resource::~Resource() {
+	if (unlikely(lazy_payload)) {
+		_discard_lazy_payload();
+	}
+
 	if (unlikely(path_cache.is_empty())) {
 		return;
 	}
@@ -598,6 +687,9 @@ Resource::~Resource() {
 }
 
 HashMap<String, Resource *> ResourceCache::resources;
+HashMap<StringName, ResourceCache::RetentionPool> ResourceCache::retention_pools;
+HashMap<Resource *, List<ResourceCache::RetainedResource>::Element *> ResourceCache::retained_resources;
+ResourceCache::RetentionStats ResourceCache::retention_stats;
 #ifdef TOOLS_ENABLED
 HashMap<String, HashMap<String, String>> ResourceCache::resource_path_cache;
 #endif
@@ -608,6 +700,8 @@ RWLock ResourceCache::path_cache_lock;
 #endif
 
 void ResourceCache::clear() {
+	clear_retained();
+
 	if (!resources.is_empty()) {
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			ERR_PRINT(vformat("%d resources still in use at exit.", resources.size()));
@@ -693,3 +787,177 @@ int ResourceCache::get_cached_resource_count() {
 	MutexLock mutex_lock(lock);
 	return resources.size();
 }
+
+ResourceCache::RetentionPool *ResourceCache::_find_retention_pool(const StringName &p_class) {
+	StringName class_name = p_class;
+	while (class_name != StringName()) {
+		RetentionPool *pool = retention_pools.getptr(class_name);
+		if (pool) {
+			return pool;
+		}
+		class_name = ClassDB::get_parent_class_nocheck(class_name);
+	}
+	return nullptr;
+}
+
+void ResourceCache::_untrack(List<RetainedResource>::Element *p_element, LocalVector<Ref<Resource>> &r_released) {
+	RetainedResource &retained = p_element->get();
+	if (retained.released) {
+		retained.pool->size -= retained.size;
+		retention_stats.retained_size -= retained.size;
+		retention_stats.retained_count--;
+	}
+	retained_resources.erase(retained.resource.ptr());
+	// Released by the caller, outside of the lock.
+	r_released.push_back(retained.resource);
+	retained.pool->lru.erase(p_element);
+}
+
+void ResourceCache::_update_retention(RetentionPool *p_pool, LocalVector<Ref<Resource>> &r_evicted) {
+	for (RetainedResource &retained : p_pool->lru) {
+		const bool released = retained.resource->get_reference_count() == 1;
+		if (released == retained.released) {
+			continue;
+		}
+		retained.released = released;
+		if (released) {
+			p_pool->size += retained.size;
+			retention_stats.retained_size += retained.size;
+			retention_stats.retained_count++;
+		} else {
+			p_pool->size -= retained.size;
+			retention_stats.retained_size -= retained.size;
+			retention_stats.retained_count--;
+		}
+	}
+
+	// Resources still in use elsewhere are skipped, releasing them wouldn't free anything.
+	List<RetainedResource>::Element *E = p_pool->lru.back();
+	while (E && p_pool->size > p_pool->budget) {
+		List<RetainedResource>::Element *prev = E->prev();
+		if (E->get().released) {
+			retention_stats.evictions++;
+			_untrack(E, r_evicted);
+		}
+		E = prev;
+	}
+}
+
+void ResourceCache::set_retention_budget(const StringName &p_type, uint64_t p_bytes) {
+	LocalVector<Ref<Resource>> evicted;
+	{
+		MutexLock mutex_lock(lock);
+		RetentionPool *pool = retention_pools.getptr(p_type);
+		if (!pool) {
+			if (p_bytes == 0) {
+				return;
+			}
+			pool = &retention_pools.insert(p_type, RetentionPool())->value;
+		}
+
+		if (p_bytes == 0) {
+			while (pool->lru.front()) {
+				_untrack(pool->lru.front(), evicted);
+			}
+			retention_pools.erase(p_type);
+		} else {
+			pool->budget = p_bytes;
+			_update_retention(pool, evicted);
+		}
+	}
+}
+
+uint64_t ResourceCache::get_retention_budget(const StringName &p_type) {
+	MutexLock mutex_lock(lock);
+	const RetentionPool *pool = retention_pools.getptr(p_type);
+	return pool ? pool->budget : 0;
+}
+
+void ResourceCache::retain(const Ref<Resource> &p_resource, bool p_from_cache) {
+	ERR_FAIL_COND(p_resource.is_null());
+
+	{
+		MutexLock mutex_lock(lock);
+		if (retention_pools.is_empty()) {
+			return;
+		}
+		if (!_find_retention_pool(p_resource->get_class_name())) {
+			return;
+		}
+
+		if (p_from_cache) {
+			retention_stats.hits++;
+		} else {
+			retention_stats.misses++;
+		}
+
+		List<RetainedResource>::Element **E = retained_resources.getptr(p_resource.ptr());
+		if (E) {
+			// Referenced by the caller now, so no longer charged once updated.
+			(*E)->get().pool->lru.move_to_front(*E);
+			return;
+		}
+	}
+
+	// Estimating can be costly (and call into scripts or extensions), so it's done unlocked,
+	// and the budgets and retained resources are checked again after.
+	const uint64_t size = MAX(p_resource->get_memory_usage_estimate(), (uint64_t)sizeof(Resource));
+
+	LocalVector<Ref<Resource>> evicted;
+	{
+		MutexLock mutex_lock(lock);
+		RetentionPool *pool = _find_retention_pool(p_resource->get_class_name());
+		if (!pool) {
+			return;
+		}
+
+		List<RetainedResource>::Element **E = retained_resources.getptr(p_resource.ptr());
+		if (E) {
+			(*E)->get().pool->lru.move_to_front(*E);
+			return;
+		}
+
+		RetainedResource retained;
+		retained.resource = p_resource;
+		retained.pool = pool;
+		retained.size = size;
+		retained_resources.insert(p_resource.ptr(), pool->lru.push_front(retained));
+
+		// Resources loaded before may have been released since, this is only checked when
+		// loading from disk, so hitting the cache stays cheap.
+		_update_retention(pool, evicted);
+	}
+}
+
+void ResourceCache::clear_retained() {
+	LocalVector<Ref<Resource>> released;
+	{
+		MutexLock mutex_lock(lock);
+		for (KeyValue<StringName, RetentionPool> &E : retention_pools) {
+			for (const RetainedResource &retained : E.value.lru) {
+				released.push_back(retained.resource);
+			}
+			E.value.lru.clear();
+			E.value.size = 0;
+		}
+		retained_resources.clear();
+		retention_stats.retained_count = 0;
+		retention_stats.retained_size = 0;
+	}
+}
+
+ResourceCache::RetentionStats ResourceCache::get_retention_stats() {
+	LocalVector<Ref<Resource>> evicted;
+	MutexLock mutex_lock(lock);
+	for (KeyValue<StringName, RetentionPool> &E : retention_pools) {
+		_update_retention(&E.value, evicted);
+	}
+	return retention_stats;
+}
+
+void ResourceCache::reset_retention_stats() {
+	MutexLock mutex_lock(lock);
+	retention_stats.hits = 0;
+	retention_stats.misses = 0;
+	retention_stats.evictions = 0;
+}
@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 
@@ -74,6 +75,32 @@ private:
 
 	SelfList<Resource> remapped_list;
 
+public:
+	// Properties of a resource whose reading was deferred by its loader until first use.
+	class LazyPayload {
+		friend class Resource;
+
+		// Lets other threads wait for the one loading the payload, with no lock held while it reads.
+		struct LoadState;
+		LoadState *load_state = nullptr;
+
+	public:
+		virtual Error load(Resource *p_resource) = 0; // Called once, by the first thread using the resource.
+		virtual uint64_t get_size() const = 0; // Approximate memory needed once loaded, for accounting.
+
+		LazyPayload();
+		virtual ~LazyPayload();
+	};
+
+private:
+	LazyPayload *lazy_payload = nullptr; // Kept until destruction, once set by the loader.
+	SafeFlag lazy_payload_pending;
+
+	static SafeNumeric<uint32_t> lazy_payloads_pending_count;
+	static SafeNumeric<uint64_t> lazy_payloads_pending_size;
+
+	void _discard_lazy_payload();
+
 	void _dupe_sub_resources(Variant &r_variant, Node *p_for_scene, HashMap<Ref<Resource>, Ref<Resource>> &p_remap_cache);
 	void _find_sub_resources(const Variant &p_variant, HashSet<Ref<Resource>> &p_resources_found);
 
@@ -92,6 +119,13 @@ protected:
 	GDVIRTUAL1C(_set_path_cache, String);
 	GDVIRTUAL0(_reset_state);
 
+	// Classes supporting lazy loading call this before accessing their loaded state.
+	_FORCE_INLINE_ void _load_lazy_payload_if_needed() const {
+		if (unlikely(lazy_payload_pending.is_set())) {
+			const_cast<Resource *>(this)->load_lazy_payload();
+		}
+	}
+
 public:
 	static Node *(*_get_local_scene_func)(); //used by editor
 	static void (*_update_configuration_warning)(); //used by editor
@@ -147,6 +181,14 @@ public:
 	void set_as_translation_remapped(bool p_remapped);
 
 	virtual RID get_rid() const; // some resources may offer conversion to RID
+	virtual uint64_t get_memory_usage_estimate() const { return 0; } // Approximate memory held by this resource, for cache budgets.
+
+	virtual bool is_lazy_loadable() const { return false; } // Whether loaders may defer reading the properties until first use.
+	void set_lazy_payload(LazyPayload *p_payload); // Takes ownership.
+	_FORCE_INLINE_ bool has_lazy_payload() const { return lazy_payload_pending.is_set(); }
+	Error load_lazy_payload();
+	static uint32_t get_lazy_payloads_pending_count() { return lazy_payloads_pending_count.get(); }
+	static uint64_t get_lazy_payloads_pending_size() { return lazy_payloads_pending_size.get(); } // Memory the deferred payloads will need once loaded.
 
 	//helps keep IDs same number when loading/saving scenes. -1 clears ID and it Returns -1 when no id stored
 	void set_id_for_path(const String &p_path, const String &p_id);
@@ -169,11 +211,56 @@ class ResourceCache {
 	static void clear();
 	friend void register_core_types();
 
+	// Optional tier keeping recently loaded resources alive after they are released, within a
+	// memory budget per type. Loaded resources are tracked with a reference, and only count
+	// against the budget (and can be evicted) once that reference is the last one.
+	struct RetentionPool;
+
+	struct RetainedResource {
+		Ref<Resource> resource;
+		RetentionPool *pool = nullptr;
+		uint64_t size = 0;
+		bool released = false; // Only referenced by the cache, so charged to the budget.
+	};
+
+	struct RetentionPool {
+		uint64_t budget = 0;
+		uint64_t size = 0; // Of the released resources.
+		List<RetainedResource> lru; // Most recently used first.
+	};
+
+	static HashMap<StringName, RetentionPool> retention_pools;
+	static HashMap<Resource *, List<RetainedResource>::Element *> retained_resources;
+
+public:
+	struct RetentionStats {
+		uint64_t hits = 0; // Loads of a budgeted type served from the cache.
+		uint64_t misses = 0; // Loads of a budgeted type read from disk.
+		uint64_t evictions = 0;
+		uint64_t retained_count = 0; // Released resources kept alive by the cache.
+		uint64_t retained_size = 0;
+	};
+
+private:
+	static RetentionStats retention_stats;
+
+	static RetentionPool *_find_retention_pool(const StringName &p_class);
+	static void _update_retention(RetentionPool *p_pool, LocalVector<Ref<Resource>> &r_evicted);
+	static void _untrack(List<RetainedResource>::Element *p_element, LocalVector<Ref<Resource>> &r_released);
+
 public:
 	static bool has(const String &p_path);
 	static Ref<Resource> get_ref(const String &p_path);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+
+	// A budget of 0 disables retention for the type. Budgets apply to derived types too.
+	static void set_retention_budget(const StringName &p_type, uint64_t p_bytes);
+	static uint64_t get_retention_budget(const StringName &p_type);
+	static void retain(const Ref<Resource> &p_resource, bool p_from_cache);
+	static void clear_retained();
+	static RetentionStats get_retention_stats(); // Releases resources over budget first.
+	static void reset_retention_stats();
 };
 
 #endif // RESOURCE_H
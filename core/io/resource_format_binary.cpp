@@ -33,6 +33,8 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
+#include "core/io/file_read_batch.h"
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
@@ -42,6 +44,13 @@
 //#define print_bl(m_what) print_line(m_what)
 #define print_bl(m_what) (void)(m_what)
 
+// Files up to this size are read whole in the background while external resources load.
+static const uint64_t BACKGROUND_READ_MAX_SIZE = 64 * 1024 * 1024;
+// Files in memory with at least this many internal resources decode them in parallel.
+static const int PARALLEL_LOAD_MIN_RESOURCES = 32;
+// Sub-resources with at least this many bytes of properties can have them read lazily.
+static const uint64_t LAZY_PAYLOAD_MIN_SIZE = 64 * 1024;
+
 enum {
 	//numbering must be different from variant, in case new variant types are added (variant must be always contiguous for jumptable optimization)
 	VARIANT_NIL = 1,
@@ -157,12 +166,18 @@ StringName ResourceLoaderBinary::_get_string() {
 	uint32_t id = f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
-		if ((int)len > str_buf.size()) {
-			str_buf.resize(len);
-		}
 		if (len == 0) {
 			return StringName();
 		}
+		const uint8_t *view = f->get_buffer_view(len);
+		if (view) {
+			String s;
+			s.parse_utf8((const char *)view, len);
+			return s;
+		}
+		if ((int)len > str_buf.size()) {
+			str_buf.resize(len);
+		}
 		f->get_buffer((uint8_t *)&str_buf[0], len);
 		String s;
 		s.parse_utf8(&str_buf[0]);
@@ -404,11 +419,28 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 
 					if (using_named_scene_ids) { // New format.
 						ERR_FAIL_INDEX_V((int)index, internal_resources.size(), ERR_PARSE_ERROR);
+						if (internal_resources[index].resource.is_valid()) {
+							r_v = internal_resources[index].resource;
+							break;
+						}
 						path = internal_resources[index].path;
 					} else {
 						path += res_path + "::" + itos(index);
 					}
 
+					if (resolve_internal_from_cache && !internal_index_cache.has(path)) {
+						// Lazy payloads don't keep the other resources of the file alive, find them in the cache.
+						if (path.begins_with("local://")) {
+							path = res_path + "::" + path.replace_first("local://", "");
+						}
+						Ref<Resource> res = ResourceCache::get_ref(path);
+						if (res.is_null()) {
+							ERR_PRINT("Can't find resource '" + path + "' while lazily loading a resource from '" + local_path + "'; it was freed before being used.");
+						}
+						r_v = res;
+						break;
+					}
+
 					//always use internal cache for loading internal resources
 					if (!internal_index_cache.has(path)) {
 						WARN_PRINT(String("Couldn't load resource (no cache): " + path).utf8().get_data());
@@ -447,6 +479,15 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					if (erindex < 0 || erindex >= external_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
+					} else if (resolve_internal_from_cache) {
+						// Lazy payloads don't keep the dependencies of the file alive either, they are
+						// usually still cached, and loaded again otherwise.
+						const ExtResource &er = external_resources[erindex];
+						Ref<Resource> res = ResourceLoader::load(er.path, er.type, cache_mode_for_external);
+						if (res.is_null()) {
+							ResourceLoader::notify_dependency_error(local_path, er.path, er.type);
+						}
+						r_v = res;
 					} else {
 						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
@@ -680,222 +721,502 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
-	}
+Error ResourceLoaderBinary::_create_internal_resource(int p_index, InternalResourceLoad &r_load) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+	//maybe it is loaded already
+	String path;
+	String id;
 
-		if (remaps.has(path)) {
-			path = remaps[path];
-		}
+	if (!main) {
+		path = internal_resources[p_index].path;
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
 		}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (!external_resources[i].load_token.is_valid()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				internal_resources.write[p_index].resource = cached;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	uint64_t offset = internal_resources[p_index].offset;
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	f->seek(offset);
 
-		if (!main) {
-			path = internal_resources[i].path;
+	String t = get_unicode_string();
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	Ref<Resource> res;
+	Resource *r = nullptr;
 
-				internal_resources.write[i].path = path; // Update path.
+	MissingResource *missing_resource = nullptr;
+
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
 			}
+		}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					missing_resource = memnew(MissingResource);
+					missing_resource->set_original_class(t);
+					missing_resource->set_recording_properties(true);
+					obj = missing_resource;
+				} else {
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
 				}
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				error = ERR_FILE_CORRUPT;
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
 			}
+
+			res = Ref<Resource>(r);
 		}
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	if (r) {
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
+			}
+		}
+		r->set_scene_unique_id(id);
+	}
 
-		f->seek(offset);
+	if (!main) {
+		internal_index_cache[path] = res;
+		internal_resources.write[p_index].resource = res;
+	}
 
-		String t = get_unicode_string();
+	r_load.res = res;
+	r_load.missing_resource = missing_resource;
+	r_load.properties_offset = f->get_position();
+
+	return OK;
+}
 
-		Ref<Resource> res;
-		Resource *r = nullptr;
+Error ResourceLoaderBinary::_parse_internal_resource_properties(InternalResourceLoad &r_load) {
+	int pc = f->get_32();
 
-		MissingResource *missing_resource = nullptr;
+	for (int j = 0; j < pc; j++) {
+		StringName name = _get_string();
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
 		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
-			}
 
-			if (res.is_null()) {
-				//did not replace
+		Variant value;
 
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource;
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
-					}
-				}
+		error = parse_variant(value);
+		if (error) {
+			return error;
+		}
 
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
-					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
-				}
+		r_load.properties.push_back(Pair<StringName, Variant>(name, value));
+	}
+
+	return OK;
+}
 
-				res = Ref<Resource>(r);
+void ResourceLoaderBinary::_parse_internal_resources_task(ParallelDecode *p_decode) {
+	uint32_t index;
+	while ((index = p_decode->next.postincrement()) < p_decode->count) {
+		_parse_internal_resource_in_memory(p_decode->loads[index]);
+	}
+}
+
+void ResourceLoaderBinary::_parse_internal_resource_in_memory(InternalResourceLoad &r_load) {
+	if (r_load.res.is_null() || r_load.deferred) {
+		return; // Reused from the cache, or read on first use.
+	}
+
+	// Each task decodes with its own reading state, from the file in memory.
+	ResourceLoaderBinary decoder;
+	decoder.local_path = local_path;
+	decoder.res_path = res_path;
+	decoder.ver_format = ver_format;
+	decoder.using_named_scene_ids = using_named_scene_ids;
+	decoder.string_map = string_map;
+	decoder.internal_resources = internal_resources;
+	decoder.external_resources = external_resources;
+	decoder.remaps = remaps;
+	decoder.cache_mode_for_external = cache_mode_for_external;
+
+	Ref<FileAccessMemory> fm;
+	fm.instantiate();
+	fm->open_custom(file_memory, file_memory_size);
+	fm->set_big_endian(f->is_big_endian());
+	fm->seek(r_load.properties_offset);
+	decoder.f = fm;
+
+	r_load.error = decoder._parse_internal_resource_properties(r_load);
+}
+
+void ResourceLoaderBinary::_set_internal_resource_properties(int p_index, InternalResourceLoad &r_load) {
+	Ref<Resource> &res = r_load.res;
+	MissingResource *missing_resource = r_load.missing_resource;
+
+	Dictionary missing_resource_properties;
+
+	for (Pair<StringName, Variant> &property : r_load.properties) {
+		const StringName &name = property.first;
+		Variant &value = property.second;
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
 		}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
-				} else {
-					r->set_path_cache(path);
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
 				}
 			}
-			r->set_scene_unique_id(id);
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		if (value.get_type() == Variant::DICTIONARY) {
+			Dictionary set_dict = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+				Dictionary get_dict = get_value;
+				if (!set_dict.is_same_typed(get_dict)) {
+					value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+							get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
+				}
+			}
 		}
 
-		int pc = f->get_32();
+		if (set_valid) {
+			res->set(name, value);
+		}
+	}
+	r_load.properties.clear();
 
-		//set properties
+	if (missing_resource) {
+		missing_resource->set_recording_properties(false);
+	}
 
-		Dictionary missing_resource_properties;
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+#ifdef TOOLS_ENABLED
+	res->set_edited(false);
+#endif
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+	if (progress) {
+		*progress = (p_index + 1) / float(internal_resources.size());
+	}
 
-			Variant value;
+	resource_cache.push_back(res);
+}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+class ResourceLoaderBinaryLazyPayload : public Resource::LazyPayload {
+	ResourceLoaderBinary::LazyState *state = nullptr;
+	uint64_t offset = 0;
+	uint64_t size = 0;
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+	void _release_state() {
+		if (state && state->refcount.unref()) {
+			memdelete(state);
+		}
+		state = nullptr;
+	}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+	Error _load(Resource *p_resource) {
+		Error err;
+		Ref<FileAccess> f = FileAccess::open(state->file_path, FileAccess::READ, &err);
+		ERR_FAIL_COND_V_MSG(f.is_null(), err, "Can't open '" + state->file_path + "' to read the properties of a lazily loaded resource.");
+
+		uint8_t header[4];
+		f->get_buffer(header, 4);
+		if (header[0] == 'R' && header[1] == 'S' && header[2] == 'C' && header[3] == 'C') {
+			Ref<FileAccessCompressed> fac;
+			fac.instantiate();
+			err = fac->open_after_magic(f);
+			ERR_FAIL_COND_V_MSG(err != OK, err, "Can't open '" + state->file_path + "' to read the properties of a lazily loaded resource.");
+			f = fac;
+		}
+		f->set_big_endian(state->big_endian);
+		f->seek(offset);
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
+		ResourceLoaderBinary decoder;
+		decoder.local_path = state->local_path;
+		decoder.res_path = state->res_path;
+		decoder.ver_format = state->ver_format;
+		decoder.using_named_scene_ids = true;
+		decoder.string_map = state->string_map;
+		decoder.internal_resources = state->internal_resources;
+		decoder.external_resources = state->external_resources;
+		decoder.remaps = state->remaps;
+		decoder.cache_mode_for_external = state->cache_mode_for_external;
+		decoder.resolve_internal_from_cache = true;
+		decoder.f = f;
 
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
-				}
+		ResourceLoaderBinary::InternalResourceLoad load;
+		load.res = Ref<Resource>(p_resource);
+		err = decoder._parse_internal_resource_properties(load);
+		ERR_FAIL_COND_V_MSG(err != OK, err, "Can't read the properties of lazily loaded resource '" + p_resource->get_path() + "'.");
+		decoder._set_internal_resource_properties(0, load);
+
+		return OK;
+	}
+
+public:
+	virtual Error load(Resource *p_resource) override {
+		Error err = _load(p_resource);
+		// Only loaded once, the rest of the file doesn't need to be kept for it anymore.
+		_release_state();
+		return err;
+	}
+
+	virtual uint64_t get_size() const override {
+		return size;
+	}
+
+	ResourceLoaderBinaryLazyPayload(ResourceLoaderBinary::LazyState *p_state, uint64_t p_offset, uint64_t p_size) :
+			state(p_state), offset(p_offset), size(p_size) {
+		state->refcount.ref();
+	}
+
+	~ResourceLoaderBinaryLazyPayload() {
+		_release_state();
+	}
+};
+
+void ResourceLoaderBinary::_defer_internal_resource(int p_index, InternalResourceLoad &r_load) {
+	if (!_is_lazy_load()) {
+		return;
+	}
+	// The main resource is always loaded, and so are the resources it can't be sure about.
+	if (p_index >= internal_resources.size() - 1 || r_load.res.is_null() || r_load.missing_resource || !r_load.res->is_lazy_loadable()) {
+		return;
+	}
+
+	uint64_t next_offset = internal_resources[p_index + 1].offset;
+	if (next_offset <= r_load.properties_offset || next_offset - r_load.properties_offset < LAZY_PAYLOAD_MIN_SIZE) {
+		return;
+	}
+
+	if (!lazy_state) {
+		lazy_state = memnew(LazyState);
+		lazy_state->refcount.init();
+		lazy_state->file_path = file_path;
+		lazy_state->local_path = local_path;
+		lazy_state->res_path = res_path;
+		lazy_state->ver_format = ver_format;
+		lazy_state->big_endian = f->is_big_endian();
+		lazy_state->string_map = string_map;
+		lazy_state->internal_resources = internal_resources;
+		for (int i = 0; i < lazy_state->internal_resources.size(); i++) {
+			lazy_state->internal_resources.write[i].resource.unref();
+		}
+		lazy_state->external_resources = external_resources;
+		for (int i = 0; i < lazy_state->external_resources.size(); i++) {
+			lazy_state->external_resources.write[i].load_token.unref();
+		}
+		lazy_state->remaps = remaps;
+		lazy_state->cache_mode_for_external = cache_mode_for_external;
+	}
+
+	r_load.res->set_lazy_payload(memnew(ResourceLoaderBinaryLazyPayload(lazy_state, r_load.properties_offset, next_offset - r_load.properties_offset)));
+	r_load.deferred = true;
+}
+
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
+
+	// Read the whole file in the background while external resources are being requested,
+	// so internal resources are then parsed from memory instead of through many small reads.
+	// Only worth it when there are requests to overlap with, and never for lazy loads, which
+	// read most of the file only when (and if) it is used.
+	FileReadBatch file_read;
+	bool reading_file = false;
+	const uint64_t resume_pos = f->get_position();
+	const uint64_t file_length = f->get_length();
+	if (file_length > 0) {
+		f->seek(0);
+		file_memory = f->get_buffer_view(file_length);
+		file_memory_size = file_memory ? file_length : 0;
+		f->seek(resume_pos);
+
+		if (!file_memory && file_length <= BACKGROUND_READ_MAX_SIZE && !external_resources.is_empty() && !_is_lazy_load()) {
+			file_data.resize(file_length);
+			file_read.add_read(f, 0, file_data.ptrw(), file_length);
+			file_read.submit();
+			reading_file = true;
+		}
+	}
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
+
+		if (remaps.has(path)) {
+			path = remaps[path];
+		}
+
+		if (!path.contains("://") && path.is_relative_path()) {
+			// path is relative to file being loaded, so convert to a resource path
+			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		}
+
+		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+		if (!external_resources[i].load_token.is_valid()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
 			}
+		}
+	}
 
-			if (set_valid) {
-				res->set(name, value);
+	if (reading_file) {
+		file_read.wait();
+		if (file_read.get_read_length(0) == file_length) {
+			Ref<FileAccessMemory> fm;
+			fm.instantiate();
+			fm->open_custom(file_data.ptr(), file_length);
+			fm->set_big_endian(f->is_big_endian());
+			f = fm;
+			file_memory = file_data.ptr();
+			file_memory_size = file_length;
+		} else {
+			file_data.clear();
+		}
+		f->seek(resume_pos);
+	}
+
+	LocalVector<InternalResourceLoad> loads;
+	loads.resize(internal_resources.size());
+
+	// Big files in memory have their internal resources decoded in parallel. Resources are all
+	// created first, so references between them resolve, then decoded on worker threads, and
+	// finally have their properties set in file order below.
+	const bool parallel = file_memory && using_named_scene_ids && internal_resources.size() >= PARALLEL_LOAD_MIN_RESOURCES;
+	if (parallel) {
+		for (int i = 0; i < internal_resources.size(); i++) {
+			Error err = _create_internal_resource(i, loads[i]);
+			if (err) {
+				return err;
 			}
+			_defer_internal_resource(i, loads[i]);
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		// Wait for dependencies here, so decoding tasks don't block on them.
+		for (const ExtResource &er : external_resources) {
+			if (er.load_token.is_valid()) {
+				Error err;
+				ResourceLoader::_load_complete(*er.load_token.ptr(), &err);
+			}
 		}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+		// Loads usually run on pool threads themselves, so this doesn't wait on a group, which
+		// would hold the thread idle. Tasks and this thread claim resources from a shared counter,
+		// and waiting on a task from a pool thread runs other tasks meanwhile.
+		ParallelDecode decode;
+		decode.loads = loads.ptr();
+		decode.count = loads.size();
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		tasks.resize(MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), decode.count - 1));
+		for (WorkerThreadPool::TaskID &task_id : tasks) {
+			task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &ResourceLoaderBinary::_parse_internal_resources_task, &decode, false, SNAME("ResourceLoaderBinaryDecode"));
 		}
+		_parse_internal_resources_task(&decode);
+		for (WorkerThreadPool::TaskID task_id : tasks) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+		}
+	}
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
+	for (int i = 0; i < internal_resources.size(); i++) {
+		InternalResourceLoad &load = loads[i];
+
+		if (parallel) {
+			if (load.error) {
+				error = load.error;
+				return error;
+			}
+		} else {
+			Error err = _create_internal_resource(i, load);
+			if (err) {
+				return err;
+			}
+			_defer_internal_resource(i, load);
+			if (load.res.is_valid() && !load.deferred) {
+				err = _parse_internal_resource_properties(load);
+				if (err) {
+					return err;
+				}
+			}
+		}
 
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+		if (load.res.is_null()) {
+			continue; // Already loaded, reused from the cache.
 		}
 
-		resource_cache.push_back(res);
+		_set_internal_resource_properties(i, load);
 
-		if (main) {
+		if (i == internal_resources.size() - 1) {
 			f.unref();
-			resource = res;
+			file_memory = nullptr;
+			file_memory_size = 0;
+			file_data.clear();
+			resource = load.res;
 			resource->set_as_translation_remapped(translation_remapped);
 			error = OK;
 			return OK;
@@ -927,12 +1248,18 @@ static String get_ustring(Ref<FileAccess> f) {
 
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
+	if (len <= 0) {
+		return String();
+	}
+	const uint8_t *view = f->get_buffer_view(len);
+	if (view) {
+		String s;
+		s.parse_utf8((const char *)view, len);
+		return s;
+	}
 	if (len > str_buf.size()) {
 		str_buf.resize(len);
 	}
-	if (len == 0) {
-		return String();
-	}
 	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
 	s.parse_utf8(&str_buf[0]);
@@ -1216,6 +1543,14 @@ String ResourceLoaderBinary::recognize_script_class(Ref<FileAccess> p_f) {
 	}
 }
 
+ResourceLoaderBinary::~ResourceLoaderBinary() {
+	if (lazy_state && lazy_state->refcount.unref()) {
+		memdelete(lazy_state);
+	}
+}
+
+bool ResourceFormatLoaderBinary::lazy_sub_resources = false;
+
 Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
 	if (r_error) {
 		*r_error = ERR_FILE_CANT_OPEN;
@@ -1245,6 +1580,8 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	}
 	loader.use_sub_threads = p_use_sub_threads;
 	loader.progress = r_progress;
+	loader.file_path = p_path;
+	loader.lazy_sub_resources = lazy_sub_resources;
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
@@ -34,6 +34,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -44,6 +48,9 @@ class ResourceLoaderBinary {
 	uint32_t ver_format = 0;
 
 	Ref<FileAccess> f;
+	Vector<uint8_t> file_data; // Whole file, when it was read in the background by load().
+	const uint8_t *file_memory = nullptr; // Whole file, when it's in memory while loading.
+	uint64_t file_memory_size = 0;
 
 	uint64_t importmd_ofs = 0;
 
@@ -73,11 +80,42 @@ class ResourceLoaderBinary {
 	struct IntResource {
 		String path;
 		uint64_t offset;
+		Ref<Resource> resource; // Set once created while loading.
+	};
+
+	struct InternalResourceLoad {
+		Ref<Resource> res; // Null if reused from the cache.
+		MissingResource *missing_resource = nullptr;
+		uint64_t properties_offset = 0;
+		LocalVector<Pair<StringName, Variant>> properties;
+		Error error = OK;
+		bool deferred = false; // Properties are read on first use, see Resource::LazyPayload.
 	};
 
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	// What the lazy payloads of a file need to decode their properties later on.
+	// Shared by all of them, it doesn't keep the resources of the file alive.
+	struct LazyState {
+		SafeRefCount refcount;
+		String file_path;
+		String local_path;
+		String res_path;
+		uint32_t ver_format = 0;
+		bool big_endian = false;
+		Vector<StringName> string_map;
+		Vector<IntResource> internal_resources;
+		Vector<ExtResource> external_resources; // Without load tokens, which would keep the loads alive.
+		HashMap<String, String> remaps;
+		ResourceFormatLoader::CacheMode cache_mode_for_external = ResourceFormatLoader::CACHE_MODE_REUSE;
+	};
+
+	String file_path; // File actually being read, which may differ from local_path.
+	bool lazy_sub_resources = false;
+	LazyState *lazy_state = nullptr;
+	bool resolve_internal_from_cache = false; // When decoding a lazy payload.
+
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
 
@@ -88,9 +126,23 @@ class ResourceLoaderBinary {
 	ResourceFormatLoader::CacheMode cache_mode_for_external = ResourceFormatLoader::CACHE_MODE_REUSE;
 
 	friend class ResourceFormatLoaderBinary;
+	friend class ResourceLoaderBinaryLazyPayload;
 
 	Error parse_variant(Variant &r_v);
 
+	Error _create_internal_resource(int p_index, InternalResourceLoad &r_load);
+	Error _parse_internal_resource_properties(InternalResourceLoad &r_load);
+	struct ParallelDecode {
+		InternalResourceLoad *loads = nullptr;
+		uint32_t count = 0;
+		SafeNumeric<uint32_t> next;
+	};
+	void _parse_internal_resources_task(ParallelDecode *p_decode);
+	void _parse_internal_resource_in_memory(InternalResourceLoad &r_load);
+	bool _is_lazy_load() const { return lazy_sub_resources && using_named_scene_ids && cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !file_path.is_empty(); }
+	void _set_internal_resource_properties(int p_index, InternalResourceLoad &r_load);
+	void _defer_internal_resource(int p_index, InternalResourceLoad &r_load);
+
 	HashMap<String, Ref<Resource>> dependency_cache;
 
 public:
@@ -106,10 +158,18 @@ public:
 	void get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes);
 
 	ResourceLoaderBinary() {}
+	~ResourceLoaderBinary();
 };
 
 class ResourceFormatLoaderBinary : public ResourceFormatLoader {
+	static bool lazy_sub_resources;
+
 public:
+	// When enabled, sub-resources supporting it (see Resource::is_lazy_loadable()) with large
+	// enough data are left empty by loads, and read from the file when first used.
+	static void set_lazy_sub_resources(bool p_enable) { lazy_sub_resources = p_enable; }
+	static bool is_lazy_sub_resources_enabled() { return lazy_sub_resources; }
+
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const override;
 	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
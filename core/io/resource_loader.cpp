@@ -319,10 +319,17 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 void ResourceLoader::_run_load_task(void *p_userdata) {
 	ThreadLoadTask &load_task = *(ThreadLoadTask *)p_userdata;
 
+	bool counts_toward_cap = false;
 	{
 		MutexLock thread_load_lock(thread_load_mutex);
+		// Claim the slot here so a re-entrant run doesn't give it back twice.
+		counts_toward_cap = load_task.counts_toward_cap;
+		load_task.counts_toward_cap = false;
 		if (cleaning_tasks) {
 			load_task.status = THREAD_LOAD_FAILED;
+			if (counts_toward_cap) {
+				active_threaded_loads--;
+			}
 			return;
 		}
 	}
@@ -410,6 +417,7 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 			if (pending_unlock) {
 				ResourceCache::lock.unlock();
 			}
+			ResourceCache::retain(load_task.resource, false);
 		} else {
 			load_task.resource->set_path_cache(load_task.local_path);
 		}
@@ -453,6 +461,12 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 		thread_load_mutex.unlock();
 	}
 
+	if (counts_toward_cap) {
+		MutexLock thread_load_lock(thread_load_mutex);
+		active_threaded_loads--;
+		_submit_queued_load_tasks();
+	}
+
 	if (load_nesting == 0) {
 		if (own_mq_override) {
 			MessageQueue::set_thread_singleton_override(nullptr);
@@ -480,6 +494,140 @@ Error ResourceLoader::load_threaded_request(const String &p_path, const String &
 	return token.is_valid() ? OK : FAILED;
 }
 
+void ResourceLoader::load_threaded_cancel(const String &p_path) {
+	MutexLock thread_load_lock(thread_load_mutex);
+
+	_release_abandoned_user_tokens();
+
+	HashMap<String, LoadToken *>::Iterator E = user_load_tokens.find(p_path);
+	if (!E) {
+		print_verbose("load_threaded_cancel(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+		return;
+	}
+
+	LoadToken *load_token = E->value;
+	DEV_ASSERT(load_token->user_rc >= 1);
+	load_token->user_rc--;
+	if (load_token->user_rc > 0) {
+		// Other requests for the same path still want the resource.
+		return;
+	}
+	load_token->user_path.clear();
+	user_load_tokens.remove(E);
+
+	ThreadLoadTask *load_task = nullptr;
+	if (load_token->task_if_unregistered) {
+		load_task = load_token->task_if_unregistered;
+	} else if (!load_token->local_path.is_empty()) {
+		load_task = thread_load_tasks.getptr(load_token->local_path);
+	}
+
+	if (load_task && load_task->status == THREAD_LOAD_IN_PROGRESS) {
+		// The extra references are the user one and the one the load task run would release.
+		if (load_task->queued && load_token->get_reference_count() == 2) {
+			// Nobody else is interested and it never started, so it can be dropped right away.
+			queued_load_tasks.erase(load_task);
+			load_task->queued = false;
+			load_task->status = THREAD_LOAD_FAILED;
+			load_task->error = ERR_SKIP;
+			load_task->need_wait = false;
+			load_token->unreference();
+		} else {
+			// A running load can't be interrupted. Its result will be dropped once it's done;
+			// until then the token is kept so releasing it doesn't block on the task here.
+			abandoned_user_tokens.push_back(load_token);
+			return;
+		}
+	}
+
+	if (load_token->unreference()) {
+		memdelete(load_token);
+	}
+}
+
+void ResourceLoader::set_threaded_load_priority(const String &p_path, int p_priority) {
+	MutexLock thread_load_lock(thread_load_mutex);
+
+	HashMap<String, LoadToken *>::Iterator E = user_load_tokens.find(p_path);
+	if (!E) {
+		print_verbose("set_threaded_load_priority(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+		return;
+	}
+
+	LoadToken *load_token = E->value;
+	ThreadLoadTask *load_task = load_token->task_if_unregistered ? load_token->task_if_unregistered : thread_load_tasks.getptr(load_token->local_path);
+	if (load_task) {
+		// Only matters while the task is held back; the next free slot goes to the highest priority.
+		load_task->priority = p_priority;
+	}
+}
+
+void ResourceLoader::set_max_concurrent_threaded_loads(int p_max) {
+	ERR_FAIL_COND_MSG(p_max < 0, "The maximum number of concurrent threaded loads can't be negative.");
+	MutexLock thread_load_lock(thread_load_mutex);
+	max_concurrent_threaded_loads = p_max;
+	_submit_queued_load_tasks();
+}
+
+int ResourceLoader::get_max_concurrent_threaded_loads() {
+	MutexLock thread_load_lock(thread_load_mutex);
+	return max_concurrent_threaded_loads;
+}
+
+void ResourceLoader::_submit_load_task(ThreadLoadTask *p_load_task, bool p_counts_toward_cap) {
+	p_load_task->counts_toward_cap = p_counts_toward_cap;
+	if (p_counts_toward_cap) {
+		active_threaded_loads++;
+	}
+	p_load_task->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_task, p_load_task);
+}
+
+void ResourceLoader::_submit_queued_load_tasks() {
+	while (!queued_load_tasks.is_empty() && (max_concurrent_threaded_loads == 0 || active_threaded_loads < max_concurrent_threaded_loads)) {
+		// Highest priority first; among equals, in request order.
+		uint32_t next = 0;
+		for (uint32_t i = 1; i < queued_load_tasks.size(); i++) {
+			if (queued_load_tasks[i]->priority > queued_load_tasks[next]->priority) {
+				next = i;
+			}
+		}
+		ThreadLoadTask *load_task = queued_load_tasks[next];
+		queued_load_tasks.remove_at(next);
+		load_task->queued = false;
+		_submit_load_task(load_task, true);
+	}
+}
+
+// Someone needs a held back load right now, so it's run on the calling thread
+// instead of waiting for a slot. It's then tracked as a load on a user thread.
+void ResourceLoader::_run_queued_load_task_now(ThreadLoadTask &p_load_task, MutexLock<SafeBinaryMutex<BINARY_MUTEX_TAG>> &p_thread_load_lock) {
+	queued_load_tasks.erase(&p_load_task);
+	p_load_task.queued = false;
+	p_load_task.thread_id = Thread::get_caller_id();
+
+	p_thread_load_lock.temp_unlock();
+	_run_load_task(&p_load_task);
+	p_thread_load_lock.temp_relock();
+}
+
+void ResourceLoader::_release_abandoned_user_tokens() {
+	for (uint32_t i = 0; i < abandoned_user_tokens.size();) {
+		LoadToken *load_token = abandoned_user_tokens[i];
+		const ThreadLoadTask *load_task = load_token->task_if_unregistered;
+		if (!load_task && !load_token->local_path.is_empty()) {
+			load_task = thread_load_tasks.getptr(load_token->local_path);
+		}
+		if (load_task && load_task->status == THREAD_LOAD_IN_PROGRESS) {
+			i++;
+			continue;
+		}
+		abandoned_user_tokens.remove_at_unordered(i);
+		if (load_token->unreference()) {
+			memdelete(load_token);
+		}
+	}
+}
+
 ResourceLoader::LoadToken *ResourceLoader::_load_threaded_request_reuse_user_token(const String &p_path) {
 	HashMap<String, LoadToken *>::Iterator E = user_load_tokens.find(p_path);
 	if (E) {
@@ -537,6 +685,8 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 		MutexLock thread_load_lock(thread_load_mutex);
 
 		if (p_for_user) {
+			_release_abandoned_user_tokens();
+
 			LoadToken *existing_token = _load_threaded_request_reuse_user_token(p_path);
 			if (existing_token) {
 				return Ref<LoadToken>(existing_token);
@@ -577,6 +727,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
+					ResourceCache::retain(existing, true);
 					//referencing is fine
 					load_task.resource = existing;
 					load_task.status = THREAD_LOAD_LOADED;
@@ -612,8 +763,17 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			} else {
 				load_task_ptr->thread_id = Thread::get_caller_id();
 			}
+		} else if (p_for_user && !must_not_register) {
+			// User requests are subject to the concurrency cap, so urgent ones aren't stuck behind prefetches.
+			// Loads started by the engine itself, including dependencies, are never held back.
+			if (max_concurrent_threaded_loads > 0 && active_threaded_loads >= max_concurrent_threaded_loads) {
+				load_task_ptr->queued = true;
+				queued_load_tasks.push_back(load_task_ptr);
+			} else {
+				_submit_load_task(load_task_ptr, true);
+			}
 		} else {
-			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_task, load_task_ptr);
+			_submit_load_task(load_task_ptr, false);
 		}
 	} // MutexLock(thread_load_mutex).
 
@@ -705,9 +865,10 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 		DEV_ASSERT(load_token->user_rc >= 1);
 
 		// Support userland requesting on the main thread before the load is reported to be complete.
+		// A held back load is run right away by _load_complete_inner() instead.
 		if (Thread::is_main_thread() && !load_token->local_path.is_empty()) {
 			const ThreadLoadTask &load_task = thread_load_tasks[load_token->local_path];
-			while (load_task.status == THREAD_LOAD_IN_PROGRESS) {
+			while (load_task.status == THREAD_LOAD_IN_PROGRESS && !load_task.queued) {
 				thread_load_lock.temp_unlock();
 				bool exit = !_ensure_load_progress();
 				OS::get_singleton()->delay_usec(1000);
@@ -759,6 +920,10 @@ Ref<Resource> ResourceLoader::_load_complete_inner(LoadToken &p_load_token, Erro
 
 		ThreadLoadTask &load_task = thread_load_tasks[p_load_token.local_path];
 
+		if (load_task.queued) {
+			_run_queued_load_task_now(load_task, p_thread_load_lock);
+		}
+
 		if (load_task.status == THREAD_LOAD_IN_PROGRESS) {
 			DEV_ASSERT((load_task.task_id == 0) != (load_task.thread_id == 0));
 
@@ -1306,6 +1471,14 @@ void ResourceLoader::clear_thread_load_tasks() {
 	MutexLock thread_load_lock(thread_load_mutex);
 	cleaning_tasks = true;
 
+	// Held back tasks will never run, so they have to be finished here.
+	for (ThreadLoadTask *load_task : queued_load_tasks) {
+		load_task->queued = false;
+		load_task->status = THREAD_LOAD_FAILED;
+		load_task->load_token->unreference();
+	}
+	queued_load_tasks.clear();
+
 	while (true) {
 		bool none_running = true;
 		if (thread_load_tasks.size()) {
@@ -1336,6 +1509,11 @@ void ResourceLoader::clear_thread_load_tasks() {
 		user_token->unreference();
 	}
 
+	for (LoadToken *abandoned_token : abandoned_user_tokens) {
+		abandoned_token->unreference();
+	}
+	abandoned_user_tokens.clear();
+
 	thread_load_tasks.clear();
 
 	cleaning_tasks = false;
@@ -1467,6 +1645,11 @@ bool ResourceLoader::cleaning_tasks = false;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
+int ResourceLoader::max_concurrent_threaded_loads = 0;
+int ResourceLoader::active_threaded_loads = 0;
+LocalVector<ResourceLoader::ThreadLoadTask *> ResourceLoader::queued_load_tasks;
+LocalVector<ResourceLoader::LoadToken *> ResourceLoader::abandoned_user_tokens;
+
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
 HashMap<String, String> ResourceLoader::path_remaps;
@@ -189,6 +189,9 @@ private:
 		Ref<Resource> resource;
 		bool use_sub_threads = false;
 		HashSet<String> sub_tasks;
+		int priority = 0; // Among held back tasks, higher goes first.
+		bool queued = false; // Held back by the concurrency cap, not in the pool yet.
+		bool counts_toward_cap = false; // Occupies one of the concurrent user load slots until it's done.
 
 		struct ResourceChangedConnection {
 			Resource *source = nullptr;
@@ -213,6 +216,16 @@ private:
 
 	static HashMap<String, LoadToken *> user_load_tokens;
 
+	static int max_concurrent_threaded_loads;
+	static int active_threaded_loads;
+	static LocalVector<ThreadLoadTask *> queued_load_tasks;
+	static LocalVector<LoadToken *> abandoned_user_tokens; // Cancelled while the load was in progress.
+
+	static void _submit_load_task(ThreadLoadTask *p_load_task, bool p_counts_toward_cap);
+	static void _submit_queued_load_tasks();
+	static void _run_queued_load_task_now(ThreadLoadTask &p_load_task, MutexLock<SafeBinaryMutex<BINARY_MUTEX_TAG>> &p_thread_load_lock);
+	static void _release_abandoned_user_tokens();
+
 	static float _dependency_get_progress(const String &p_path);
 
 	static bool _ensure_load_progress();
@@ -221,6 +234,11 @@ public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static void load_threaded_cancel(const String &p_path);
+	static void set_threaded_load_priority(const String &p_path, int p_priority);
+
+	static void set_max_concurrent_threaded_loads(int p_max);
+	static int get_max_concurrent_threaded_loads();
 
 	static bool is_within_load() { return load_nesting > 0; };
 
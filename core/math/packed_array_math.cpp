@@ -0,0 +1,203 @@
+/**************************************************************************/
+/*  packed_array_math.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "packed_array_math.h"
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define PACKED_ARRAY_MATH_SIMD
+
+typedef __m128 Float4;
+
+static _FORCE_INLINE_ Float4 _load(const float *p_src) { return _mm_loadu_ps(p_src); }
+static _FORCE_INLINE_ void _store(float *r_dst, Float4 p_value) { _mm_storeu_ps(r_dst, p_value); }
+static _FORCE_INLINE_ Float4 _splat(float p_value) { return _mm_set1_ps(p_value); }
+static _FORCE_INLINE_ Float4 _add(Float4 p_a, Float4 p_b) { return _mm_add_ps(p_a, p_b); }
+static _FORCE_INLINE_ Float4 _sub(Float4 p_a, Float4 p_b) { return _mm_sub_ps(p_a, p_b); }
+static _FORCE_INLINE_ Float4 _mul(Float4 p_a, Float4 p_b) { return _mm_mul_ps(p_a, p_b); }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define PACKED_ARRAY_MATH_SIMD
+
+typedef float32x4_t Float4;
+
+static _FORCE_INLINE_ Float4 _load(const float *p_src) { return vld1q_f32(p_src); }
+static _FORCE_INLINE_ void _store(float *r_dst, Float4 p_value) { vst1q_f32(r_dst, p_value); }
+static _FORCE_INLINE_ Float4 _splat(float p_value) { return vdupq_n_f32(p_value); }
+static _FORCE_INLINE_ Float4 _add(Float4 p_a, Float4 p_b) { return vaddq_f32(p_a, p_b); }
+static _FORCE_INLINE_ Float4 _sub(Float4 p_a, Float4 p_b) { return vsubq_f32(p_a, p_b); }
+static _FORCE_INLINE_ Float4 _mul(Float4 p_a, Float4 p_b) { return vmulq_f32(p_a, p_b); }
+#endif
+
+// Scalar versions, used for doubles and for the elements left after the last full SIMD block.
+
+template <typename T>
+static _FORCE_INLINE_ void _add_scalar(T *r_dst, const T *p_src, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] += p_src[i];
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _multiply_scalar(T *r_dst, const T *p_src, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] *= p_src[i];
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _scale_scalar(T *r_dst, T p_factor, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] *= p_factor;
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _add_scaled_scalar(T *r_dst, const T *p_src, T p_factor, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] += p_src[i] * p_factor;
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _lerp_scalar(T *r_dst, const T *p_to, T p_weight, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_dst[i] += (p_to[i] - r_dst[i]) * p_weight;
+	}
+}
+
+template <typename T>
+static _FORCE_INLINE_ void _dot3_scalar(const T *p_a, const T *p_b, float *r_dst, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		const T *a = p_a + i * 3;
+		const T *b = p_b + i * 3;
+		r_dst[i] = a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+	}
+}
+
+void PackedArrayMath::add(float *r_dst, const float *p_src, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_ARRAY_MATH_SIMD
+	for (; i + 4 <= p_count; i += 4) {
+		_store(r_dst + i, _add(_load(r_dst + i), _load(p_src + i)));
+	}
+#endif
+	_add_scalar(r_dst, p_src, i, p_count);
+}
+
+void PackedArrayMath::add(double *r_dst, const double *p_src, int64_t p_count) {
+	_add_scalar(r_dst, p_src, 0, p_count);
+}
+
+void PackedArrayMath::multiply(float *r_dst, const float *p_src, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_ARRAY_MATH_SIMD
+	for (; i + 4 <= p_count; i += 4) {
+		_store(r_dst + i, _mul(_load(r_dst + i), _load(p_src + i)));
+	}
+#endif
+	_multiply_scalar(r_dst, p_src, i, p_count);
+}
+
+void PackedArrayMath::multiply(double *r_dst, const double *p_src, int64_t p_count) {
+	_multiply_scalar(r_dst, p_src, 0, p_count);
+}
+
+void PackedArrayMath::scale(float *r_dst, float p_factor, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_ARRAY_MATH_SIMD
+	const Float4 factor = _splat(p_factor);
+	for (; i + 4 <= p_count; i += 4) {
+		_store(r_dst + i, _mul(_load(r_dst + i), factor));
+	}
+#endif
+	_scale_scalar(r_dst, p_factor, i, p_count);
+}
+
+void PackedArrayMath::scale(double *r_dst, double p_factor, int64_t p_count) {
+	_scale_scalar(r_dst, p_factor, 0, p_count);
+}
+
+void PackedArrayMath::add_scaled(float *r_dst, const float *p_src, float p_factor, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_ARRAY_MATH_SIMD
+	const Float4 factor = _splat(p_factor);
+	for (; i + 4 <= p_count; i += 4) {
+		_store(r_dst + i, _add(_load(r_dst + i), _mul(_load(p_src + i), factor)));
+	}
+#endif
+	_add_scaled_scalar(r_dst, p_src, p_factor, i, p_count);
+}
+
+void PackedArrayMath::add_scaled(double *r_dst, const double *p_src, double p_factor, int64_t p_count) {
+	_add_scaled_scalar(r_dst, p_src, p_factor, 0, p_count);
+}
+
+void PackedArrayMath::lerp(float *r_dst, const float *p_to, float p_weight, int64_t p_count) {
+	int64_t i = 0;
+#ifdef PACKED_ARRAY_MATH_SIMD
+	const Float4 weight = _splat(p_weight);
+	for (; i + 4 <= p_count; i += 4) {
+		const Float4 from = _load(r_dst + i);
+		_store(r_dst + i, _add(from, _mul(_sub(_load(p_to + i), from), weight)));
+	}
+#endif
+	_lerp_scalar(r_dst, p_to, p_weight, i, p_count);
+}
+
+void PackedArrayMath::lerp(double *r_dst, const double *p_to, double p_weight, int64_t p_count) {
+	_lerp_scalar(r_dst, p_to, p_weight, 0, p_count);
+}
+
+double PackedArrayMath::dot(const float *p_a, const float *p_b, int64_t p_count) {
+	// Element `i` is always accumulated in float lane `i % 4`, and only the four lanes are
+	// summed in double, so the SIMD and scalar paths round the same way on every platform.
+	float lanes[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	int64_t i = 0;
+#ifdef PACKED_ARRAY_MATH_SIMD
+	Float4 simd_lanes = _splat(0.0f);
+	for (; i + 4 <= p_count; i += 4) {
+		simd_lanes = _add(simd_lanes, _mul(_load(p_a + i), _load(p_b + i)));
+	}
+	_store(lanes, simd_lanes);
+#endif
+	for (; i < p_count; i++) {
+		lanes[i & 3] += p_a[i] * p_b[i];
+	}
+	return (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+void PackedArrayMath::dot3(const float *p_a, const float *p_b, float *r_dst, int64_t p_count) {
+	_dot3_scalar(p_a, p_b, r_dst, p_count);
+}
+
+void PackedArrayMath::dot3(const double *p_a, const double *p_b, float *r_dst, int64_t p_count) {
+	_dot3_scalar(p_a, p_b, r_dst, p_count);
+}
@@ -0,0 +1,71 @@
+/**************************************************************************/
+/*  packed_array_math.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PACKED_ARRAY_MATH_H
+#define PACKED_ARRAY_MATH_H
+
+#include "core/typedefs.h"
+
+// Element-wise arithmetic over contiguous arrays of floats, used by the bulk methods of
+// packed arrays. Arrays of vectors are passed as flat arrays of their components.
+// The single-precision versions use SSE or NEON when the target supports them.
+class PackedArrayMath {
+public:
+	// `r_dst[i] += p_src[i]`
+	static void add(float *r_dst, const float *p_src, int64_t p_count);
+	static void add(double *r_dst, const double *p_src, int64_t p_count);
+
+	// `r_dst[i] *= p_src[i]`
+	static void multiply(float *r_dst, const float *p_src, int64_t p_count);
+	static void multiply(double *r_dst, const double *p_src, int64_t p_count);
+
+	// `r_dst[i] *= p_factor`
+	static void scale(float *r_dst, float p_factor, int64_t p_count);
+	static void scale(double *r_dst, double p_factor, int64_t p_count);
+
+	// `r_dst[i] += p_src[i] * p_factor`
+	static void add_scaled(float *r_dst, const float *p_src, float p_factor, int64_t p_count);
+	static void add_scaled(double *r_dst, const double *p_src, double p_factor, int64_t p_count);
+
+	// `r_dst[i] += (p_to[i] - r_dst[i]) * p_weight`
+	static void lerp(float *r_dst, const float *p_to, float p_weight, int64_t p_count);
+	static void lerp(double *r_dst, const double *p_to, double p_weight, int64_t p_count);
+
+	// Sum of `p_a[i] * p_b[i]`, accumulated in single precision in four interleaved
+	// partial sums, which are added in double precision. The rounding is the same with
+	// or without SIMD, but the result differs slightly from an exact double-precision sum.
+	static double dot(const float *p_a, const float *p_b, int64_t p_count);
+
+	// Dot products of `p_count` pairs of 3D vectors, stored as consecutive components.
+	static void dot3(const float *p_a, const float *p_b, float *r_dst, int64_t p_count);
+	static void dot3(const double *p_a, const double *p_b, float *r_dst, int64_t p_count);
+};
+
+#endif // PACKED_ARRAY_MATH_H
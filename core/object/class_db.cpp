@@ -827,6 +827,7 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
 	ti.name = name;
 	ti.inherits = p_inherits;
 	ti.api = current_api;
+	methods_version.increment();
 
 	if (ti.inherits) {
 		ERR_FAIL_COND(!classes.has(ti.inherits)); //it MUST be registered.
@@ -1014,19 +1015,49 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 	return false;
 }
 
+void ClassDB::_build_flat_method_map(ClassInfo *p_class_info, uint64_t p_version) {
+	MutexLock flat_lock(flat_method_map_mutex);
+	if (p_class_info->flat_method_map.version.get() == p_version) {
+		return; // Another thread built it in the meantime.
+	}
+
+	AHashMap<StringName, MethodBind *> &methods = p_class_info->flat_method_map.methods;
+	methods.clear();
+
+	// Methods registered closer to the class take precedence over inherited ones.
+	for (ClassInfo *type = p_class_info; type; type = type->inherits_ptr) {
+		for (const KeyValue<StringName, MethodBind *> &E : type->method_map) {
+			if (E.value && !methods.has(E.key)) {
+				methods.insert_new(E.key, E.value);
+			}
+		}
+	}
+
+	p_class_info->flat_method_map.version.set(p_version);
+}
+
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
+	if (!type) {
+		return nullptr;
+	}
 
-	while (type) {
-		MethodBind **method = type->method_map.getptr(p_name);
-		if (method && *method) {
-			return *method;
-		}
-		type = type->inherits_ptr;
+	// Registration only happens under the write lock, so the flat map can't go stale while it's read here.
+	const uint64_t version = methods_version.get();
+	if (unlikely(type->flat_method_map.version.get() != version)) {
+		_build_flat_method_map(type, version);
 	}
-	return nullptr;
+
+	MethodBind *const *method = type->flat_method_map.methods.getptr(p_name);
+	return method ? *method : nullptr;
+}
+
+MethodBind *ClassDB::get_method_cached(const StringName &p_class, const StringName &p_name) {
+	static constexpr uint32_t CACHE_SIZE = 64;
+	static thread_local MethodCache caches[CACHE_SIZE];
+	return get_method_cached(p_class, p_name, caches[(p_class.hash() ^ p_name.hash()) & (CACHE_SIZE - 1)]);
 }
 
 Vector<uint32_t> ClassDB::get_method_compatibility_hashes(const StringName &p_class, const StringName &p_name) {
@@ -1865,6 +1896,7 @@ void ClassDB::_bind_method_custom(const StringName &p_class, MethodBind *p_metho
 #endif
 
 	type->method_map[p_method->get_name()] = p_method;
+	methods_version.increment();
 }
 
 MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p_name, const Vector<Variant> &p_default_args, bool p_compatibility) {
@@ -1891,6 +1923,7 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 		ERR_FAIL_V_MSG(nullptr, "Method already bound: " + instance_type + "::" + p_name + ".");
 	}
 	type->method_map[p_name] = bind;
+	methods_version.increment();
 #ifdef DEBUG_METHODS_ENABLED
 	// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
 	//bind->set_return_type("Variant");
@@ -1949,6 +1982,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 		_bind_compatibility(type, p_bind);
 	} else {
 		type->method_map[mdname] = p_bind;
+		methods_version.increment();
 	}
 
 	Vector<Variant> defvals;
@@ -2235,6 +2269,7 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 #endif
 
 	classes[p_extension->class_name] = c;
+	methods_version.increment();
 }
 
 void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_method_binds) {
@@ -2246,6 +2281,7 @@ void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_
 		}
 	}
 	classes.erase(p_class);
+	methods_version.increment();
 	default_values_cached.erase(p_class);
 	default_values.erase(p_class);
 #ifdef TOOLS_ENABLED
@@ -2278,6 +2314,8 @@ uint64_t ClassDB::get_native_struct_size(const StringName &p_name) {
 }
 
 RWLock ClassDB::lock;
+SafeNumeric<uint64_t> ClassDB::methods_version(1);
+BinaryMutex ClassDB::flat_method_map_mutex;
 
 void ClassDB::cleanup_defaults() {
 	default_values.clear();
@@ -2301,6 +2339,7 @@ void ClassDB::cleanup() {
 	}
 
 	classes.clear();
+	methods_version.increment();
 	resource_base_extensions.clear();
 	compat_classes.clear();
 	native_structs.clear();
@@ -38,6 +38,7 @@
 // Makes callable_mp readily available in all classes connecting signals.
 // Needs to come after method_bind and object have been included.
 #include "core/object/callable_method_pointer.h"
+#include "core/templates/a_hash_map.h"
 #include "core/templates/hash_set.h"
 
 #include <type_traits>
@@ -98,6 +99,18 @@ public:
 		Variant::Type type;
 	};
 
+	// Methods of a class and all of its ancestors, flattened into a single table.
+	// It is built on the first lookup and rebuilt whenever methods or classes are
+	// (un)registered, so it is never copied along with its ClassInfo.
+	struct FlatMethodMap {
+		AHashMap<StringName, MethodBind *> methods;
+		SafeNumeric<uint64_t> version;
+
+		FlatMethodMap() {}
+		FlatMethodMap(const FlatMethodMap &p_other) {}
+		void operator=(const FlatMethodMap &p_other) {}
+	};
+
 	struct ClassInfo {
 		APIType api = API_NONE;
 		ClassInfo *inherits_ptr = nullptr;
@@ -105,8 +118,9 @@ public:
 
 		ObjectGDExtension *gdextension = nullptr;
 
-		HashMap<StringName, MethodBind *> method_map;
+		AHashMap<StringName, MethodBind *> method_map;
 		HashMap<StringName, LocalVector<MethodBind *>> method_map_compatibility;
+		FlatMethodMap flat_method_map;
 		HashMap<StringName, int64_t> constant_map;
 		struct EnumInfo {
 			List<StringName> constants;
@@ -154,6 +168,9 @@ public:
 
 	static RWLock lock;
 	static HashMap<StringName, ClassInfo> classes;
+	// Bumped whenever methods or classes are (un)registered, invalidating flat method maps and method caches.
+	static SafeNumeric<uint64_t> methods_version;
+	static BinaryMutex flat_method_map_mutex;
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
@@ -192,6 +209,7 @@ private:
 	static void _bind_compatibility(ClassInfo *type, MethodBind *p_method);
 	static MethodBind *_bind_vararg_method(MethodBind *p_bind, const StringName &p_name, const Vector<Variant> &p_default_args, bool p_compatibility);
 	static void _bind_method_custom(const StringName &p_class, MethodBind *p_method, bool p_compatibility);
+	static void _build_flat_method_map(ClassInfo *p_class_info, uint64_t p_version);
 
 	static Object *_instantiate_internal(const StringName &p_class, bool p_require_real_class = false, bool p_notify_postinitialize = true);
 
@@ -448,6 +466,35 @@ public:
 	static bool get_method_info(const StringName &p_class, const StringName &p_method, MethodInfo *r_info, bool p_no_inheritance = false, bool p_exclude_from_properties = false);
 	static int get_method_argument_count(const StringName &p_class, const StringName &p_method, bool *r_is_valid = nullptr, bool p_no_inheritance = false);
 	static MethodBind *get_method(const StringName &p_class, const StringName &p_name);
+
+	// Remembers the result of a successful method lookup, so call sites resolving the same method
+	// repeatedly can skip the lookup for as long as no methods or classes are (un)registered.
+	// Names are compared by their interned data: ClassDB keeps the names of registered methods
+	// alive until the version changes, so only lookups that found a method are cached.
+	struct MethodCache {
+		const void *class_name = nullptr;
+		const void *method_name = nullptr;
+		MethodBind *method = nullptr;
+		uint64_t version = 0;
+	};
+
+	_FORCE_INLINE_ static MethodBind *get_method_cached(const StringName &p_class, const StringName &p_name, MethodCache &r_cache) {
+		const uint64_t version = methods_version.get();
+		if (likely(r_cache.version == version && r_cache.class_name == p_class.data_unique_pointer() && r_cache.method_name == p_name.data_unique_pointer())) {
+			return r_cache.method;
+		}
+		MethodBind *method = get_method(p_class, p_name);
+		if (method) {
+			r_cache.class_name = p_class.data_unique_pointer();
+			r_cache.method_name = p_name.data_unique_pointer();
+			r_cache.method = method;
+			r_cache.version = version;
+		}
+		return method;
+	}
+
+	// Same as get_method(), through a small per-thread cache. Used by dynamic calls by name.
+	static MethodBind *get_method_cached(const StringName &p_class, const StringName &p_name);
 	static MethodBind *get_method_with_compatibility(const StringName &p_class, const StringName &p_name, uint64_t p_hash, bool *r_method_exists = nullptr, bool *r_is_deprecated = nullptr);
 	static Vector<uint32_t> get_method_compatibility_hashes(const StringName &p_class, const StringName &p_name);
 
@@ -807,7 +807,7 @@ Variant Object::callp(const StringName &p_method, const Variant **p_args, int p_
 
 	//extension does not need this, because all methods are registered in MethodBind
 
-	MethodBind *method = ClassDB::get_method(get_class_name(), p_method);
+	MethodBind *method = ClassDB::get_method_cached(get_class_name(), p_method);
 
 	if (method) {
 		ret = method->call(this, p_args, p_argcount, r_error);
@@ -851,7 +851,7 @@ Variant Object::call_const(const StringName &p_method, const Variant **p_args, i
 
 	//extension does not need this, because all methods are registered in MethodBind
 
-	MethodBind *method = ClassDB::get_method(get_class_name(), p_method);
+	MethodBind *method = ClassDB::get_method_cached(get_class_name(), p_method);
 
 	if (method) {
 		if (!method->is_const()) {
@@ -1076,6 +1076,7 @@ void Object::add_user_signal(const MethodInfo &p_signal) {
 	SignalData s;
 	s.user = p_signal;
 	signal_map[p_signal.name] = s;
+	signal_map_version++;
 }
 
 bool Object::_has_user_signal(const StringName &p_name) const {
@@ -1097,6 +1098,7 @@ void Object::_remove_user_signal(const StringName &p_name) {
 	}
 
 	signal_map.erase(p_name);
+	signal_map_version++;
 }
 
 Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
@@ -1127,6 +1129,73 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+Object::SignalData::Snapshot *Object::_pin_signal_snapshot(SignalData *p_signal) {
+	signal_snapshot_lock.lock();
+	SignalData::Snapshot *snapshot = p_signal->snapshot;
+	if (snapshot) {
+		snapshot->refcount.ref();
+		signal_snapshot_lock.unlock();
+		return snapshot;
+	}
+	const uint32_t version = p_signal->snapshot_version;
+	signal_snapshot_lock.unlock();
+
+	// Build outside the lock; if another emission published one meanwhile, use that instead.
+	// If the connections changed meanwhile, use it for this emission only and don't publish it.
+	SignalData::Snapshot *built = memnew(SignalData::Snapshot);
+	built->refcount.init();
+	built->callables.resize(p_signal->slot_map.size());
+	built->flags.resize(p_signal->slot_map.size());
+	uint32_t slot_index = 0;
+	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : p_signal->slot_map) {
+		built->callables[slot_index] = slot_kv.value.conn.callable;
+		built->flags[slot_index] = slot_kv.value.conn.flags;
+		++slot_index;
+	}
+
+	signal_snapshot_lock.lock();
+	snapshot = p_signal->snapshot;
+	if (!snapshot && version == p_signal->snapshot_version) {
+		p_signal->snapshot = built;
+		built->refcount.ref();
+		signal_snapshot_lock.unlock();
+		return built;
+	}
+	if (snapshot) {
+		snapshot->refcount.ref();
+	}
+	signal_snapshot_lock.unlock();
+
+	if (snapshot) {
+		memdelete(built);
+		return snapshot;
+	}
+	return built; // Unpublished; its only reference is the caller's.
+}
+
+void Object::_clear_signal_snapshot(SignalData *p_signal) {
+	signal_snapshot_lock.lock();
+	SignalData::Snapshot *snapshot = p_signal->snapshot;
+	p_signal->snapshot = nullptr;
+	p_signal->snapshot_version++;
+	signal_snapshot_lock.unlock();
+
+	// Emissions still using it hold their own reference.
+	if (snapshot && snapshot->refcount.unref()) {
+		memdelete(snapshot);
+	}
+}
+
+Error Object::_emit_missing_signal(const StringName &p_name) const {
+#ifdef DEBUG_ENABLED
+	bool signal_is_valid = ClassDB::has_signal(get_class_name(), p_name);
+	//check in script
+	ERR_FAIL_COND_V_MSG(!signal_is_valid && !script.is_null() && !Ref<Script>(script)->has_script_signal(p_name), ERR_UNAVAILABLE, "Can't emit non-existing signal " + String("\"") + p_name + "\".");
+#endif
+	//not connected? just return
+	return ERR_UNAVAILABLE;
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
@@ -1134,32 +1203,41 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	SignalData *s = signal_map.getptr(p_name);
 	if (!s) {
-#ifdef DEBUG_ENABLED
-		bool signal_is_valid = ClassDB::has_signal(get_class_name(), p_name);
-		//check in script
-		ERR_FAIL_COND_V_MSG(!signal_is_valid && !script.is_null() && !Ref<Script>(script)->has_script_signal(p_name), ERR_UNAVAILABLE, "Can't emit non-existing signal " + String("\"") + p_name + "\".");
-#endif
-		//not connected? just return
-		return ERR_UNAVAILABLE;
+		return _emit_missing_signal(p_name);
+	}
+	return _emit_signal_data(p_name, s, p_args, p_argcount);
+}
+
+Error Object::emit_signal_handlep(SignalHandle &r_handle, const Variant **p_args, int p_argcount) {
+	if (_block_signals) {
+		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
+	}
+
+	// Entries of signal_map don't move until they are erased, so the pointer stays valid
+	// as long as the version is unchanged.
+	if (r_handle.object != _instance_id || r_handle.signal_map_version != signal_map_version) {
+		r_handle.object = _instance_id;
+		r_handle.signal_map_version = signal_map_version;
+		r_handle.signal = signal_map.getptr(r_handle.name);
 	}
+	if (!r_handle.signal) {
+		return _emit_missing_signal(r_handle.name);
+	}
+	return _emit_signal_data(r_handle.name, r_handle.signal, p_args, p_argcount);
+}
 
+Error Object::_emit_signal_data(const StringName &p_name, SignalData *p_signal, const Variant **p_args, int p_argcount) {
 	// If this is a ref-counted object, prevent it from being destroyed during signal emission,
 	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
-	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
+	// Pin the connection snapshot, so that disconnecting the signal or even deleting
+	// the object will not affect the signal calling.
+	SignalData::Snapshot *snapshot = _pin_signal_snapshot(p_signal);
 
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
-	}
-
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	const Callable *slot_callables = snapshot->callables.ptr();
+	const uint32_t *slot_flags = snapshot->flags.ptr();
+	const uint32_t slot_count = snapshot->callables.size();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
 	for (uint32_t i = 0; i < slot_count; ++i) {
@@ -1217,8 +1295,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
+	if (snapshot->refcount.unref()) {
+		memdelete(snapshot);
 	}
 
 	return err;
@@ -1404,6 +1482,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 		signal_map[p_signal] = SignalData();
 		s = &signal_map[p_signal];
+		signal_map_version++;
 	}
 
 	//compare with the base callable, so binds can be ignored
@@ -1434,6 +1513,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	_clear_signal_snapshot(s);
 
 	return OK;
 }
@@ -1509,10 +1589,12 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	_clear_signal_snapshot(s);
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
 		signal_map.erase(p_signal);
+		signal_map_version++;
 	}
 
 	return true;
@@ -2145,6 +2227,7 @@ Object::~Object() {
 		}
 
 		signal_map.erase(E.key);
+		signal_map_version++;
 	}
 
 	// Disconnect signals that connect to this object.
@@ -39,6 +39,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/callable_bind.h"
@@ -604,12 +605,71 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Immutable copy of the connections, built on first emission and dropped whenever
+		// a connection is added or removed. Emissions in progress keep it alive through its
+		// reference count, so they are unaffected by disconnections or by the object being freed.
+		// Only accessed under `signal_snapshot_lock`, see _pin_signal_snapshot().
+		struct Snapshot {
+			SafeRefCount refcount;
+			LocalVector<Callable> callables;
+			LocalVector<uint32_t> flags;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		Snapshot *snapshot = nullptr;
+		uint32_t snapshot_version = 0; // Bumped whenever the snapshot is dropped.
 		bool removable = false;
+
+		_FORCE_INLINE_ void clear_snapshot() {
+			if (snapshot && snapshot->refcount.unref()) {
+				memdelete(snapshot);
+			}
+			snapshot = nullptr;
+		}
+
+		SignalData() {}
+		SignalData(const SignalData &p_other) :
+				user(p_other.user), slot_map(p_other.slot_map), removable(p_other.removable) {}
+		SignalData &operator=(const SignalData &p_other) {
+			if (this != &p_other) {
+				clear_snapshot();
+				user = p_other.user;
+				slot_map = p_other.slot_map;
+				removable = p_other.removable;
+			}
+			return *this;
+		}
+		~SignalData() { clear_snapshot(); }
 	};
 
 	HashMap<StringName, SignalData> signal_map;
+	// Guards the `snapshot` pointers of signal_map, which emissions on any thread may create and pin.
+	mutable SpinLock signal_snapshot_lock;
+	// Bumped whenever a signal is added to or removed from signal_map, see SignalHandle.
+	uint32_t signal_map_version = 0;
+
+public:
+	// Caches what a signal name resolves to on an object, for code that emits the same signal
+	// many times. The handle can be used with any object. It resolves the name again when used
+	// with another object, or after the object added or removed signals.
+	class SignalHandle {
+		friend class Object;
+
+		StringName name;
+		ObjectID object;
+		uint32_t signal_map_version = 0;
+		SignalData *signal = nullptr;
+
+	public:
+		_FORCE_INLINE_ const StringName &get_name() const { return name; }
+
+		SignalHandle() {}
+		explicit SignalHandle(const StringName &p_name) :
+				name(p_name) {}
+	};
+
+private:
 	List<Connection> connections;
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
@@ -754,6 +814,10 @@ protected:
 	friend class PlaceholderExtensionInstance;
 
 	bool _disconnect(const StringName &p_signal, const Callable &p_callable, bool p_force = false);
+	Error _emit_signal_data(const StringName &p_name, SignalData *p_signal, const Variant **p_args, int p_argcount);
+	Error _emit_missing_signal(const StringName &p_name) const;
+	SignalData::Snapshot *_pin_signal_snapshot(SignalData *p_signal);
+	void _clear_signal_snapshot(SignalData *p_signal);
 
 #ifdef TOOLS_ENABLED
 	struct VirtualMethodTracker {
@@ -920,7 +984,18 @@ public:
 		return emit_signalp(p_name, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
 	}
 
+	template <typename... VarArgs>
+	Error emit_signal(SignalHandle &r_handle, VarArgs... p_args) {
+		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
+		const Variant *argptrs[sizeof...(p_args) + 1];
+		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
+			argptrs[i] = &args[i];
+		}
+		return emit_signal_handlep(r_handle, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+	}
+
 	MTVIRTUAL Error emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount);
+	MTVIRTUAL Error emit_signal_handlep(SignalHandle &r_handle, const Variant **p_args, int p_argcount);
 	MTVIRTUAL bool has_signal(const StringName &p_name) const;
 	MTVIRTUAL void get_signal_list(List<MethodInfo> *p_signals) const;
 	MTVIRTUAL void get_signal_connection_list(const StringName &p_signal, List<Connection> *p_connections) const;
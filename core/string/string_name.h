@@ -48,7 +48,12 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// Buckets are guarded by a fixed set of striped mutexes, so threads
+		// interning unrelated names don't contend on a single global lock.
+		STRING_TABLE_MUTEX_BITS = 6,
+		STRING_TABLE_MUTEX_COUNT = 1 << STRING_TABLE_MUTEX_BITS,
+		STRING_TABLE_MUTEX_MASK = STRING_TABLE_MUTEX_COUNT - 1,
 	};
 
 	struct _Data {
@@ -80,7 +85,9 @@ class StringName {
 	friend void register_core_types();
 	friend void unregister_core_types();
 	friend class Main;
-	static inline Mutex mutex;
+	static inline Mutex mutex; // Only guards static unique class name assignment and cleanup.
+	static inline Mutex table_mutexes[STRING_TABLE_MUTEX_COUNT];
+	_FORCE_INLINE_ static Mutex &_get_table_mutex(uint32_t p_idx) { return table_mutexes[p_idx & STRING_TABLE_MUTEX_MASK]; }
 	static void setup();
 	static void cleanup();
 	static uint32_t get_empty_hash();
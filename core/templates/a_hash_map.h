@@ -0,0 +1,586 @@
+/**************************************************************************/
+/*  a_hash_map.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef A_HASH_MAP_H
+#define A_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+/**
+ * An array-based HashMap implementation ("AHashMap") that stores keys and
+ * values inline in a single dense array, indexed by a separate open addressing
+ * table that uses Robin Hood hashing with backward shift deletion.
+ *
+ * Each slot of the index table holds the cached hash of the key together with
+ * the position of its element in the dense array, so most lookups only touch
+ * one metadata cache line and one element, and inserting never allocates
+ * unless the map needs to grow. Iteration is a linear walk over the elements.
+ *
+ * Elements are kept in insertion order as long as nothing is erased. Erasing
+ * moves the last element into the freed position, so this map should be used
+ * where iteration order does not matter. Iterators and pointers to values are
+ * invalidated by any insertion or erase.
+ *
+ * The assignment operator copies the pairs from one map to the other.
+ */
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class AHashMap {
+public:
+	// Must be a power of two.
+	static constexpr uint32_t INITIAL_CAPACITY = 16;
+	static constexpr uint32_t EMPTY_HASH = 0;
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	struct Metadata {
+		uint32_t hash = EMPTY_HASH;
+		uint32_t element = 0;
+	};
+
+	MapKeyValue *elements = nullptr;
+	Metadata *metadata = nullptr;
+
+	// Capacity of the index table, always a power of two once allocated.
+	uint32_t capacity = 0;
+	uint32_t num_elements = 0;
+
+	_FORCE_INLINE_ uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	// Maximum occupancy is 75% of the index table, the dense array is sized to match.
+	static _FORCE_INLINE_ uint32_t _get_max_elements(uint32_t p_capacity) {
+		return p_capacity - (p_capacity >> 2);
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_pos, uint32_t p_hash, uint32_t p_mask) {
+		return (p_pos - (p_hash & p_mask)) & p_mask;
+	}
+
+	bool _lookup_pos_with_hash(const TKey &p_key, uint32_t p_hash, uint32_t &r_pos) const {
+		if (num_elements == 0) {
+			return false; // Failed lookups, no elements.
+		}
+
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = p_hash & mask;
+		uint32_t distance = 0;
+
+		while (true) {
+			const Metadata &meta = metadata[pos];
+			if (meta.hash == EMPTY_HASH) {
+				return false;
+			}
+
+			if (meta.hash == p_hash && Comparator::compare(elements[meta.element].key, p_key)) {
+				r_pos = pos;
+				return true;
+			}
+
+			if (distance > _get_probe_length(pos, meta.hash, mask)) {
+				return false;
+			}
+
+			pos = (pos + 1) & mask;
+			distance++;
+		}
+	}
+
+	_FORCE_INLINE_ bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (num_elements == 0) {
+			return false; // Failed lookups, no elements.
+		}
+		return _lookup_pos_with_hash(p_key, _hash(p_key), r_pos);
+	}
+
+	// Finds the index table slot that points to the given element.
+	uint32_t _find_element_pos(uint32_t p_hash, uint32_t p_element) const {
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = p_hash & mask;
+
+		while (metadata[pos].element != p_element || metadata[pos].hash != p_hash) {
+			pos = (pos + 1) & mask;
+		}
+
+		return pos;
+	}
+
+	void _insert_metadata(uint32_t p_hash, uint32_t p_element) {
+		const uint32_t mask = capacity - 1;
+		Metadata value;
+		value.hash = p_hash;
+		value.element = p_element;
+		uint32_t distance = 0;
+		uint32_t pos = p_hash & mask;
+
+		while (true) {
+			if (metadata[pos].hash == EMPTY_HASH) {
+				metadata[pos] = value;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(pos, metadata[pos].hash, mask);
+			if (existing_probe_len < distance) {
+				SWAP(value, metadata[pos]);
+				distance = existing_probe_len;
+			}
+
+			pos = (pos + 1) & mask;
+			distance++;
+		}
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		const uint32_t old_capacity = capacity;
+		Metadata *old_metadata = metadata;
+
+		capacity = MAX(p_new_capacity, INITIAL_CAPACITY);
+
+		elements = reinterpret_cast<MapKeyValue *>(Memory::realloc_static(elements, sizeof(MapKeyValue) * _get_max_elements(capacity)));
+		metadata = reinterpret_cast<Metadata *>(Memory::alloc_static(sizeof(Metadata) * capacity));
+		memset((void *)metadata, 0, sizeof(Metadata) * capacity);
+
+		if (old_metadata == nullptr) {
+			return;
+		}
+
+		// Reuse the cached hashes, keys never need to be hashed again.
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (old_metadata[i].hash == EMPTY_HASH) {
+				continue;
+			}
+			_insert_metadata(old_metadata[i].hash, old_metadata[i].element);
+		}
+
+		Memory::free_static(old_metadata);
+	}
+
+	_FORCE_INLINE_ MapKeyValue *_insert_new(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(num_elements == _get_max_elements(capacity))) {
+			ERR_FAIL_COND_V_MSG(capacity > (UINT32_MAX >> 1), nullptr, "Hash table maximum capacity reached, aborting insertion.");
+			_resize_and_rehash(capacity == 0 ? INITIAL_CAPACITY : capacity * 2);
+		}
+
+		MapKeyValue *elem = &elements[num_elements];
+		memnew_placement(elem, MapKeyValue(p_key, p_value));
+		_insert_metadata(p_hash, num_elements);
+		num_elements++;
+		return elem;
+	}
+
+	_FORCE_INLINE_ MapKeyValue *_insert(const TKey &p_key, const TValue &p_value) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t pos = 0;
+		if (_lookup_pos_with_hash(p_key, hash, pos)) {
+			MapKeyValue *elem = &elements[metadata[pos].element];
+			elem->value = p_value;
+			return elem;
+		}
+		return _insert_new(p_key, p_value, hash);
+	}
+
+	void _erase_at(uint32_t p_pos) {
+		const uint32_t mask = capacity - 1;
+		const uint32_t element = metadata[p_pos].element;
+
+		uint32_t pos = p_pos;
+		uint32_t next_pos = (pos + 1) & mask;
+		while (metadata[next_pos].hash != EMPTY_HASH && _get_probe_length(next_pos, metadata[next_pos].hash, mask) != 0) {
+			SWAP(metadata[next_pos], metadata[pos]);
+			pos = next_pos;
+			next_pos = (pos + 1) & mask;
+		}
+
+		metadata[pos].hash = EMPTY_HASH;
+		metadata[pos].element = 0;
+
+		elements[element].~MapKeyValue();
+		num_elements--;
+
+		if (element != num_elements) {
+			// Keep the element array dense by moving the last element into the hole.
+			const uint32_t last_pos = _find_element_pos(_hash(elements[num_elements].key), num_elements);
+			memcpy((void *)&elements[element], (const void *)&elements[num_elements], sizeof(MapKeyValue));
+			metadata[last_pos].element = element;
+		}
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (elements == nullptr || num_elements == 0) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < num_elements; i++) {
+			elements[i].~MapKeyValue();
+		}
+		memset((void *)metadata, 0, sizeof(Metadata) * capacity);
+		num_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "AHashMap key not found.");
+		return elements[metadata[pos].element].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "AHashMap key not found.");
+		return elements[metadata[pos].element].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &elements[metadata[pos].element].value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &elements[metadata[pos].element].value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return false;
+		}
+
+		_erase_at(pos);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		ERR_FAIL_COND_MSG(p_new_capacity > (UINT32_MAX >> 2), "Hash table maximum capacity reached.");
+		uint32_t new_capacity = next_power_of_2(p_new_capacity + (p_new_capacity / 3) + 1);
+		if (new_capacity <= capacity) {
+			return;
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	// Direct access to the dense element array, in iteration order.
+	_FORCE_INLINE_ KeyValue<TKey, TValue> &get_by_index(uint32_t p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, num_elements);
+		return elements[p_index];
+	}
+
+	_FORCE_INLINE_ const KeyValue<TKey, TValue> &get_by_index(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, num_elements);
+		return elements[p_index];
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return *E;
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return E; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			E++;
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			E--;
+			if (E < begin) {
+				E = end;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return E != end;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const MapKeyValue *p_E, const MapKeyValue *p_begin, const MapKeyValue *p_end) {
+			E = p_E;
+			begin = p_begin;
+			end = p_end;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			E = p_it.E;
+			begin = p_it.begin;
+			end = p_it.end;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			E = p_it.E;
+			begin = p_it.begin;
+			end = p_it.end;
+		}
+
+	private:
+		const MapKeyValue *E = nullptr;
+		const MapKeyValue *begin = nullptr;
+		const MapKeyValue *end = nullptr;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return *E;
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return E; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			E++;
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			E--;
+			if (E < begin) {
+				E = end;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return E != end;
+		}
+
+		_FORCE_INLINE_ Iterator(MapKeyValue *p_E, MapKeyValue *p_begin, MapKeyValue *p_end) {
+			E = p_E;
+			begin = p_begin;
+			end = p_end;
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			E = p_it.E;
+			begin = p_it.begin;
+			end = p_it.end;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			E = p_it.E;
+			begin = p_it.begin;
+			end = p_it.end;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(E, begin, end);
+		}
+
+	private:
+		MapKeyValue *E = nullptr;
+		MapKeyValue *begin = nullptr;
+		MapKeyValue *end = nullptr;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(elements, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(elements + num_elements, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		if (num_elements == 0) {
+			return end();
+		}
+		return Iterator(elements + num_elements - 1, elements, elements + num_elements);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return Iterator(elements + metadata[pos].element, elements, elements + num_elements);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(elements, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(elements + num_elements, elements, elements + num_elements);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		if (num_elements == 0) {
+			return end();
+		}
+		return ConstIterator(elements + num_elements - 1, elements, elements + num_elements);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return ConstIterator(elements + metadata[pos].element, elements, elements + num_elements);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return elements[metadata[pos].element].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t pos = 0;
+		if (_lookup_pos_with_hash(p_key, hash, pos)) {
+			return elements[metadata[pos].element].value;
+		}
+		return _insert_new(p_key, TValue(), hash)->value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		MapKeyValue *elem = _insert(p_key, p_value);
+		return Iterator(elem, elements, elements + num_elements);
+	}
+
+	// Inserts a key that is known not to be in the map yet, skipping the lookup.
+	Iterator insert_new(const TKey &p_key, const TValue &p_value) {
+		DEV_ASSERT(!has(p_key));
+		MapKeyValue *elem = _insert_new(p_key, p_value, _hash(p_key));
+		return Iterator(elem, elements, elements + num_elements);
+	}
+
+	/* Constructors */
+
+	AHashMap(const AHashMap &p_other) {
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		_resize_and_rehash(p_other.capacity);
+		for (uint32_t i = 0; i < p_other.num_elements; i++) {
+			memnew_placement(&elements[i], MapKeyValue(p_other.elements[i]));
+		}
+		memcpy((void *)metadata, (const void *)p_other.metadata, sizeof(Metadata) * capacity);
+		num_elements = p_other.num_elements;
+	}
+
+	AHashMap(AHashMap &&p_other) {
+		elements = p_other.elements;
+		metadata = p_other.metadata;
+		capacity = p_other.capacity;
+		num_elements = p_other.num_elements;
+
+		p_other.elements = nullptr;
+		p_other.metadata = nullptr;
+		p_other.capacity = 0;
+		p_other.num_elements = 0;
+	}
+
+	void operator=(const AHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		clear();
+
+		if (p_other.num_elements == 0) {
+			return; // Nothing to copy.
+		}
+
+		if (capacity != p_other.capacity) {
+			if (metadata != nullptr) {
+				Memory::free_static(metadata);
+				metadata = nullptr;
+			}
+			capacity = 0;
+			_resize_and_rehash(p_other.capacity);
+		}
+
+		for (uint32_t i = 0; i < p_other.num_elements; i++) {
+			memnew_placement(&elements[i], MapKeyValue(p_other.elements[i]));
+		}
+		memcpy((void *)metadata, (const void *)p_other.metadata, sizeof(Metadata) * capacity);
+		num_elements = p_other.num_elements;
+	}
+
+	AHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	AHashMap() {}
+
+	~AHashMap() {
+		clear();
+
+		if (elements != nullptr) {
+			Memory::free_static(elements);
+			Memory::free_static(metadata);
+		}
+	}
+};
+
+#endif // A_HASH_MAP_H
@@ -0,0 +1,658 @@
+/**************************************************************************/
+/*  ordered_hash_map.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ORDERED_HASH_MAP_H
+#define ORDERED_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+#include "core/templates/sort_array.h"
+
+/**
+ * A compact, insertion-ordered HashMap implementation.
+ *
+ * Keys and values are stored inline, in insertion order, in a single dense
+ * array. A separate open addressing index (Robin Hood hashing with backward
+ * shift deletion, caching the hash of each key) maps hashes to positions in
+ * that array.
+ *
+ * Erasing leaves a tombstone in the array so the order of the remaining
+ * entries is preserved. Tombstones at the end of the array are dropped right
+ * away. Once they outnumber the live entries, the array is compacted, and the
+ * storage shrinks if it is mostly unused.
+ *
+ * Compared to HashMap, this avoids one heap allocation and two list pointers
+ * per element, iteration is a linear walk over contiguous memory, and indexed
+ * access is constant time.
+ *
+ * As with AHashMap, iterators and pointers to keys and values are invalidated
+ * by insertions that grow the array, by erasing and by sorting.
+ */
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class OrderedHashMap {
+public:
+	static constexpr uint32_t EMPTY_HASH = 0;
+	// Must be a power of two.
+	static constexpr uint32_t MIN_INDEX_CAPACITY = 8;
+
+private:
+	static constexpr uint32_t MIN_ENTRY_CAPACITY = 4;
+
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	struct Entry {
+		MapKeyValue data;
+		uint32_t hash = EMPTY_HASH; // EMPTY_HASH marks an erased entry.
+
+		Entry(const TKey &p_key, const TValue &p_value, uint32_t p_hash) :
+				data(p_key, p_value),
+				hash(p_hash) {}
+	};
+
+	struct Metadata {
+		uint32_t hash = EMPTY_HASH;
+		uint32_t entry = 0;
+	};
+
+	template <typename Less>
+	struct EntryLess {
+		const Entry *entries = nullptr;
+		Less less;
+
+		_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+			return less(entries[p_a].data.key, entries[p_b].data.key);
+		}
+	};
+
+	Entry *entries = nullptr;
+	uint32_t entry_capacity = 0;
+
+	Metadata *metadata = nullptr;
+	uint32_t index_capacity = 0;
+
+	uint32_t used = 0; // Entries in use, including tombstones.
+	uint32_t num_elements = 0;
+
+	_FORCE_INLINE_ uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_pos, uint32_t p_hash, uint32_t p_mask) {
+		return (p_pos - (p_hash & p_mask)) & p_mask;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_index_capacity(uint32_t p_elements) {
+		// Keeps the load factor at 75% or less.
+		return MAX(next_power_of_2(p_elements + (p_elements / 3) + 1), MIN_INDEX_CAPACITY);
+	}
+
+	bool _lookup_pos_with_hash(const TKey &p_key, uint32_t p_hash, uint32_t &r_pos) const {
+		if (num_elements == 0) {
+			return false; // Failed lookups, no elements.
+		}
+
+		const uint32_t mask = index_capacity - 1;
+		uint32_t pos = p_hash & mask;
+		uint32_t distance = 0;
+
+		while (true) {
+			const Metadata &meta = metadata[pos];
+			if (meta.hash == EMPTY_HASH) {
+				return false;
+			}
+
+			if (meta.hash == p_hash && Comparator::compare(entries[meta.entry].data.key, p_key)) {
+				r_pos = pos;
+				return true;
+			}
+
+			if (distance > _get_probe_length(pos, meta.hash, mask)) {
+				return false;
+			}
+
+			pos = (pos + 1) & mask;
+			distance++;
+		}
+	}
+
+	_FORCE_INLINE_ bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (num_elements == 0) {
+			return false; // Failed lookups, no elements.
+		}
+		return _lookup_pos_with_hash(p_key, _hash(p_key), r_pos);
+	}
+
+	void _insert_metadata(uint32_t p_hash, uint32_t p_entry) {
+		const uint32_t mask = index_capacity - 1;
+		Metadata value;
+		value.hash = p_hash;
+		value.entry = p_entry;
+		uint32_t distance = 0;
+		uint32_t pos = p_hash & mask;
+
+		while (true) {
+			if (metadata[pos].hash == EMPTY_HASH) {
+				metadata[pos] = value;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(pos, metadata[pos].hash, mask);
+			if (existing_probe_len < distance) {
+				SWAP(value, metadata[pos]);
+				distance = existing_probe_len;
+			}
+
+			pos = (pos + 1) & mask;
+			distance++;
+		}
+	}
+
+	void _rebuild_index(uint32_t p_index_capacity) {
+		if (p_index_capacity != index_capacity) {
+			if (metadata != nullptr) {
+				Memory::free_static(metadata);
+			}
+			index_capacity = p_index_capacity;
+			metadata = reinterpret_cast<Metadata *>(Memory::alloc_static(sizeof(Metadata) * index_capacity));
+		}
+		memset((void *)metadata, 0, sizeof(Metadata) * index_capacity);
+
+		for (uint32_t i = 0; i < used; i++) {
+			if (entries[i].hash != EMPTY_HASH) {
+				_insert_metadata(entries[i].hash, i);
+			}
+		}
+	}
+
+	void _resize_entries(uint32_t p_capacity) {
+		// Entries are relocated with their memory, like every Godot type allows.
+		entries = reinterpret_cast<Entry *>(Memory::realloc_static(entries, sizeof(Entry) * p_capacity));
+		entry_capacity = p_capacity;
+	}
+
+	// Moves the live entries to the front of the array, preserving their order.
+	// When shrinking, also releases the storage that is no longer needed.
+	void _compact(bool p_shrink) {
+		uint32_t dst = 0;
+		for (uint32_t src = 0; src < used; src++) {
+			if (entries[src].hash == EMPTY_HASH) {
+				continue;
+			}
+			if (src != dst) {
+				memcpy((void *)&entries[dst], (const void *)&entries[src], sizeof(Entry));
+			}
+			dst++;
+		}
+		used = dst;
+
+		uint32_t new_index_capacity = index_capacity;
+		if (p_shrink) {
+			if (entry_capacity > MIN_ENTRY_CAPACITY && used < entry_capacity / 4) {
+				_resize_entries(MAX(used * 2, MIN_ENTRY_CAPACITY));
+			}
+			if (_get_index_capacity(num_elements) * 4 <= index_capacity) {
+				new_index_capacity = _get_index_capacity(num_elements) * 2;
+			}
+		}
+		_rebuild_index(new_index_capacity);
+	}
+
+	// Drops the tombstones at the end of the array, and compacts it once tombstones outnumber live entries.
+	void _reclaim_tombstones() {
+		while (used > 0 && entries[used - 1].hash == EMPTY_HASH) {
+			used--;
+		}
+		const uint32_t tombstones = used - num_elements;
+		if (tombstones >= MIN_ENTRY_CAPACITY && tombstones > num_elements) {
+			_compact(true);
+		}
+	}
+
+	_FORCE_INLINE_ Entry *_insert_new(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(index_capacity == 0 || num_elements + 1 > index_capacity - (index_capacity >> 2))) {
+			ERR_FAIL_COND_V_MSG(index_capacity > (UINT32_MAX >> 2), nullptr, "Hash table maximum capacity reached, aborting insertion.");
+			_rebuild_index(index_capacity == 0 ? MIN_INDEX_CAPACITY : index_capacity * 2);
+		}
+
+		if (unlikely(used == entry_capacity)) {
+			if (used != num_elements) {
+				// Reclaim the tombstones before growing.
+				_compact(false);
+			}
+			if (used == entry_capacity) {
+				ERR_FAIL_COND_V_MSG(entry_capacity > (UINT32_MAX >> 2), nullptr, "Hash table maximum capacity reached, aborting insertion.");
+				_resize_entries(MAX(entry_capacity * 2, MIN_ENTRY_CAPACITY));
+			}
+		}
+
+		Entry *entry = memnew_placement(&entries[used], Entry(p_key, p_value, p_hash));
+		_insert_metadata(p_hash, used);
+		used++;
+		num_elements++;
+		return entry;
+	}
+
+	_FORCE_INLINE_ Entry *_insert(const TKey &p_key, const TValue &p_value, uint32_t &r_entry) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t pos = 0;
+		if (_lookup_pos_with_hash(p_key, hash, pos)) {
+			r_entry = metadata[pos].entry;
+			Entry *entry = &entries[r_entry];
+			entry->data.value = p_value;
+			return entry;
+		}
+		Entry *entry = _insert_new(p_key, p_value, hash);
+		r_entry = used - 1;
+		return entry;
+	}
+
+	_FORCE_INLINE_ uint32_t _next_live(uint32_t p_entry) const {
+		while (p_entry < used && entries[p_entry].hash == EMPTY_HASH) {
+			p_entry++;
+		}
+		return MIN(p_entry, used);
+	}
+
+	_FORCE_INLINE_ uint32_t _prev_live(uint32_t p_entry) const {
+		// Returns `used` when there is no previous live entry.
+		p_entry = MIN(p_entry, used);
+		while (p_entry > 0) {
+			p_entry--;
+			if (entries[p_entry].hash != EMPTY_HASH) {
+				return p_entry;
+			}
+		}
+		return used;
+	}
+
+	void _release() {
+		clear();
+		if (entries != nullptr) {
+			Memory::free_static(entries);
+			entries = nullptr;
+		}
+		entry_capacity = 0;
+		if (metadata != nullptr) {
+			Memory::free_static(metadata);
+			metadata = nullptr;
+		}
+		index_capacity = 0;
+	}
+
+	void _copy_from(const OrderedHashMap &p_other) {
+		if (p_other.num_elements == 0) {
+			return;
+		}
+		reserve(p_other.num_elements);
+		for (uint32_t i = 0; i < p_other.used; i++) {
+			const Entry &entry = p_other.entries[i];
+			if (entry.hash != EMPTY_HASH) {
+				_insert_new(entry.data.key, entry.data.value, entry.hash);
+			}
+		}
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return index_capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (used == 0) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < used; i++) {
+			if (entries[i].hash != EMPTY_HASH) {
+				entries[i].data.~MapKeyValue();
+			}
+		}
+		memset((void *)metadata, 0, sizeof(Metadata) * index_capacity);
+		used = 0;
+		num_elements = 0;
+	}
+
+	// Sorts the entries by key. Keys are unique, so stability doesn't matter.
+	template <typename Less>
+	void sort_custom() {
+		if (num_elements < 2) {
+			return;
+		}
+		if (used != num_elements) {
+			_compact(false);
+		}
+
+		// Entries can't be assigned since their keys are const, so their order is sorted
+		// first and then they are relocated in one pass.
+		uint32_t *order = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * used));
+		for (uint32_t i = 0; i < used; i++) {
+			order[i] = i;
+		}
+		SortArray<uint32_t, EntryLess<Less>> sorter;
+		sorter.compare.entries = entries;
+		sorter.sort(order, used);
+
+		Entry *sorted = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * entry_capacity));
+		for (uint32_t i = 0; i < used; i++) {
+			memcpy((void *)&sorted[i], (const void *)&entries[order[i]], sizeof(Entry));
+		}
+		Memory::free_static(order);
+		Memory::free_static(entries);
+		entries = sorted;
+
+		_rebuild_index(index_capacity);
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "OrderedHashMap key not found.");
+		return entries[metadata[pos].entry].data.value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "OrderedHashMap key not found.");
+		return entries[metadata[pos].entry].data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &entries[metadata[pos].entry].data.value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &entries[metadata[pos].entry].data.value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return false;
+		}
+
+		const uint32_t mask = index_capacity - 1;
+		const uint32_t erased = metadata[pos].entry;
+
+		uint32_t next_pos = (pos + 1) & mask;
+		while (metadata[next_pos].hash != EMPTY_HASH && _get_probe_length(next_pos, metadata[next_pos].hash, mask) != 0) {
+			SWAP(metadata[next_pos], metadata[pos]);
+			pos = next_pos;
+			next_pos = (pos + 1) & mask;
+		}
+
+		metadata[pos].hash = EMPTY_HASH;
+		metadata[pos].entry = 0;
+
+		entries[erased].data.~MapKeyValue();
+		entries[erased].hash = EMPTY_HASH;
+		num_elements--;
+
+		_reclaim_tombstones();
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		ERR_FAIL_COND_MSG(p_new_capacity > (UINT32_MAX >> 2), "Hash table maximum capacity reached.");
+		const uint32_t new_index_capacity = _get_index_capacity(p_new_capacity);
+		if (new_index_capacity > index_capacity) {
+			_rebuild_index(new_index_capacity);
+		}
+		if (entry_capacity < p_new_capacity) {
+			_resize_entries(p_new_capacity);
+		}
+	}
+
+	// Returns the element at the given position in iteration order. Compacts the
+	// entries first if some were erased, so repeated calls are constant time.
+	KeyValue<TKey, TValue> &get_by_index(uint32_t p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, num_elements);
+		if (unlikely(used != num_elements)) {
+			_compact(false);
+		}
+		return entries[p_index].data;
+	}
+
+	const KeyValue<TKey, TValue> &get_by_index(uint32_t p_index) const {
+		// Compacting doesn't change the contents, only where they are stored.
+		return const_cast<OrderedHashMap *>(this)->get_by_index(p_index);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return map->entries[entry].data;
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &map->entries[entry].data; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			entry = entry < map->used ? map->_next_live(entry + 1) : map->used;
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			entry = map->_prev_live(entry);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return entry == b.entry; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return entry != b.entry; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && entry < map->used;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const OrderedHashMap *p_map, uint32_t p_entry) {
+			map = p_map;
+			entry = p_entry;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			map = p_it.map;
+			entry = p_it.entry;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			map = p_it.map;
+			entry = p_it.entry;
+		}
+
+	private:
+		const OrderedHashMap *map = nullptr;
+		uint32_t entry = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return map->entries[entry].data;
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &map->entries[entry].data; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			entry = entry < map->used ? map->_next_live(entry + 1) : map->used;
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			entry = map->_prev_live(entry);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return entry == b.entry; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return entry != b.entry; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && entry < map->used;
+		}
+
+		_FORCE_INLINE_ Iterator(OrderedHashMap *p_map, uint32_t p_entry) {
+			map = p_map;
+			entry = p_entry;
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			map = p_it.map;
+			entry = p_it.entry;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			map = p_it.map;
+			entry = p_it.entry;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, entry);
+		}
+
+	private:
+		OrderedHashMap *map = nullptr;
+		uint32_t entry = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _next_live(0));
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, used);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(this, _prev_live(used));
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return Iterator(this, metadata[pos].entry);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _next_live(0));
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, used);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(this, _prev_live(used));
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return ConstIterator(this, metadata[pos].entry);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return entries[metadata[pos].entry].data.value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t pos = 0;
+		if (_lookup_pos_with_hash(p_key, hash, pos)) {
+			return entries[metadata[pos].entry].data.value;
+		}
+		return _insert_new(p_key, TValue(), hash)->data.value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t entry = 0;
+		if (_insert(p_key, p_value, entry) == nullptr) {
+			return end();
+		}
+		return Iterator(this, entry);
+	}
+
+	/* Constructors */
+
+	OrderedHashMap(const OrderedHashMap &p_other) {
+		_copy_from(p_other);
+	}
+
+	void operator=(const OrderedHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		_copy_from(p_other);
+	}
+
+	OrderedHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	OrderedHashMap() {}
+
+	~OrderedHashMap() {
+		_release();
+	}
+};
+
+#endif // ORDERED_HASH_MAP_H
@@ -34,6 +34,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/compression.h"
 #include "core/io/marshalls.h"
+#include "core/math/packed_array_math.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
@@ -1117,6 +1118,60 @@ struct _VariantCall {
 		return len;
 	}
 
+	static void func_PackedFloat32Array_add_elementwise(PackedFloat32Array *p_instance, const PackedFloat32Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "The arrays must have the same size.");
+		PackedArrayMath::add(p_instance->ptrw(), p_array.ptr(), p_instance->size());
+	}
+	static void func_PackedFloat32Array_multiply_elementwise(PackedFloat32Array *p_instance, const PackedFloat32Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "The arrays must have the same size.");
+		PackedArrayMath::multiply(p_instance->ptrw(), p_array.ptr(), p_instance->size());
+	}
+	static void func_PackedFloat32Array_scale(PackedFloat32Array *p_instance, double p_factor) {
+		PackedArrayMath::scale(p_instance->ptrw(), (float)p_factor, p_instance->size());
+	}
+	static void func_PackedFloat32Array_add_scaled(PackedFloat32Array *p_instance, const PackedFloat32Array &p_array, double p_factor) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "The arrays must have the same size.");
+		PackedArrayMath::add_scaled(p_instance->ptrw(), p_array.ptr(), (float)p_factor, p_instance->size());
+	}
+	static void func_PackedFloat32Array_lerp(PackedFloat32Array *p_instance, const PackedFloat32Array &p_to, double p_weight) {
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "The arrays must have the same size.");
+		PackedArrayMath::lerp(p_instance->ptrw(), p_to.ptr(), (float)p_weight, p_instance->size());
+	}
+	static double func_PackedFloat32Array_dot(PackedFloat32Array *p_instance, const PackedFloat32Array &p_array) {
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), 0.0, "The arrays must have the same size.");
+		return PackedArrayMath::dot(p_instance->ptr(), p_array.ptr(), p_instance->size());
+	}
+
+	// Vectors are processed as flat arrays of components.
+	static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
+
+	static void func_PackedVector3Array_add_elementwise(PackedVector3Array *p_instance, const PackedVector3Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "The arrays must have the same size.");
+		PackedArrayMath::add((real_t *)p_instance->ptrw(), (const real_t *)p_array.ptr(), p_instance->size() * 3);
+	}
+	static void func_PackedVector3Array_multiply_elementwise(PackedVector3Array *p_instance, const PackedVector3Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "The arrays must have the same size.");
+		PackedArrayMath::multiply((real_t *)p_instance->ptrw(), (const real_t *)p_array.ptr(), p_instance->size() * 3);
+	}
+	static void func_PackedVector3Array_scale(PackedVector3Array *p_instance, double p_factor) {
+		PackedArrayMath::scale((real_t *)p_instance->ptrw(), (real_t)p_factor, p_instance->size() * 3);
+	}
+	static void func_PackedVector3Array_add_scaled(PackedVector3Array *p_instance, const PackedVector3Array &p_array, double p_factor) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "The arrays must have the same size.");
+		PackedArrayMath::add_scaled((real_t *)p_instance->ptrw(), (const real_t *)p_array.ptr(), (real_t)p_factor, p_instance->size() * 3);
+	}
+	static void func_PackedVector3Array_lerp(PackedVector3Array *p_instance, const PackedVector3Array &p_to, double p_weight) {
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "The arrays must have the same size.");
+		PackedArrayMath::lerp((real_t *)p_instance->ptrw(), (const real_t *)p_to.ptr(), (real_t)p_weight, p_instance->size() * 3);
+	}
+	static PackedFloat32Array func_PackedVector3Array_dot_elementwise(PackedVector3Array *p_instance, const PackedVector3Array &p_array) {
+		PackedFloat32Array result;
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), result, "The arrays must have the same size.");
+		result.resize(p_instance->size());
+		PackedArrayMath::dot3((const real_t *)p_instance->ptr(), (const real_t *)p_array.ptr(), result.ptrw(), p_instance->size());
+		return result;
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -2612,6 +2667,12 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat32Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, add_elementwise, _VariantCall::func_PackedFloat32Array_add_elementwise, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_elementwise, _VariantCall::func_PackedFloat32Array_multiply_elementwise, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, scale, _VariantCall::func_PackedFloat32Array_scale, sarray("factor"), varray());
+	bind_functionnc(PackedFloat32Array, add_scaled, _VariantCall::func_PackedFloat32Array_add_scaled, sarray("array", "factor"), varray());
+	bind_functionnc(PackedFloat32Array, lerp, _VariantCall::func_PackedFloat32Array_lerp, sarray("to", "weight"), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_PackedFloat32Array_dot, sarray("array"), varray());
 
 	/* Float64 Array */
 
@@ -2708,6 +2769,12 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector3Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, add_elementwise, _VariantCall::func_PackedVector3Array_add_elementwise, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, multiply_elementwise, _VariantCall::func_PackedVector3Array_multiply_elementwise, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, scale, _VariantCall::func_PackedVector3Array_scale, sarray("factor"), varray());
+	bind_functionnc(PackedVector3Array, add_scaled, _VariantCall::func_PackedVector3Array_add_scaled, sarray("array", "factor"), varray());
+	bind_functionnc(PackedVector3Array, lerp, _VariantCall::func_PackedVector3Array_lerp, sarray("to", "weight"), varray());
+	bind_function(PackedVector3Array, dot_elementwise, _VariantCall::func_PackedVector3Array_dot_elementwise, sarray("array"), varray());
 
 	/* Color Array */
 
@@ -36,6 +36,7 @@
 #include "core/object/script_language.h"
 #include "core/os/keyboard.h"
 #include "core/string/string_buffer.h"
+#include "core/templates/local_vector.h"
 
 char32_t VariantParser::Stream::get_char() {
 	// is within buffer?
@@ -157,6 +158,114 @@ static double stor_fix(const String &p_str) {
 	return -1;
 }
 
+#define READING_SIGN 0
+#define READING_INT 1
+#define READING_DEC 2
+#define READING_EXP 3
+#define READING_DONE 4
+
+// Reads the characters of a number starting with p_char into r_num and returns the first character after it.
+static char32_t _read_number(VariantParser::Stream *p_stream, char32_t p_char, StringBuffer<> &r_num, bool &r_is_float) {
+	int reading = READING_INT;
+
+	if (p_char == '-') {
+		r_num += '-';
+		p_char = p_stream->get_char();
+	}
+
+	char32_t c = p_char;
+	bool exp_sign = false;
+	bool exp_beg = false;
+	r_is_float = false;
+
+	while (true) {
+		switch (reading) {
+			case READING_INT: {
+				if (is_digit(c)) {
+					//pass
+				} else if (c == '.') {
+					reading = READING_DEC;
+					r_is_float = true;
+				} else if (c == 'e') {
+					reading = READING_EXP;
+					r_is_float = true;
+				} else {
+					reading = READING_DONE;
+				}
+
+			} break;
+			case READING_DEC: {
+				if (is_digit(c)) {
+				} else if (c == 'e') {
+					reading = READING_EXP;
+				} else {
+					reading = READING_DONE;
+				}
+
+			} break;
+			case READING_EXP: {
+				if (is_digit(c)) {
+					exp_beg = true;
+
+				} else if ((c == '-' || c == '+') && !exp_sign && !exp_beg) {
+					exp_sign = true;
+
+				} else {
+					reading = READING_DONE;
+				}
+			} break;
+		}
+
+		if (reading == READING_DONE) {
+			break;
+		}
+		r_num += c;
+		c = p_stream->get_char();
+	}
+
+	return c;
+}
+
+static void _append_utf8(LocalVector<char> &r_str, char32_t p_char) {
+	if (p_char < 0x80) {
+		r_str.push_back((char)p_char);
+	} else if (p_char < 0x800) {
+		r_str.push_back((char)(0xc0 | (p_char >> 6)));
+		r_str.push_back((char)(0x80 | (p_char & 0x3f)));
+	} else if (p_char < 0x10000) {
+		r_str.push_back((char)(0xe0 | (p_char >> 12)));
+		r_str.push_back((char)(0x80 | ((p_char >> 6) & 0x3f)));
+		r_str.push_back((char)(0x80 | (p_char & 0x3f)));
+	} else {
+		r_str.push_back((char)(0xf0 | (p_char >> 18)));
+		r_str.push_back((char)(0x80 | ((p_char >> 12) & 0x3f)));
+		r_str.push_back((char)(0x80 | ((p_char >> 6) & 0x3f)));
+		r_str.push_back((char)(0x80 | (p_char & 0x3f)));
+	}
+}
+
+// Skips whitespace and returns the next meaningful character, or 0 at the end of the stream.
+static char32_t _get_non_whitespace_char(VariantParser::Stream *p_stream, int &line) {
+	while (true) {
+		char32_t c;
+		if (p_stream->saved) {
+			c = p_stream->saved;
+			p_stream->saved = 0;
+		} else {
+			c = p_stream->get_char();
+			if (p_stream->is_eof()) {
+				return 0;
+			}
+		}
+
+		if (c == '\n') {
+			line++;
+		} else if (c == 0 || c > 32) {
+			return c;
+		}
+	}
+}
+
 Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, String &r_err_str) {
 	bool string_name = false;
 
@@ -274,6 +383,9 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 			}
 			case '"': {
 				String str;
+				// UTF-8 streams yield raw bytes; collect them and decode the string once at the end.
+				const bool utf8 = p_stream->is_utf8();
+				LocalVector<char> utf8_str;
 				char32_t prev = 0;
 				while (true) {
 					char32_t ch = p_stream->get_char();
@@ -293,6 +405,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							return ERR_PARSE_ERROR;
 						}
 						char32_t res = 0;
+						bool is_codepoint = false;
 
 						switch (next) {
 							case 'b':
@@ -314,6 +427,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							case 'u': {
 								// Hexadecimal sequence.
 								int hex_len = (next == 'U') ? 6 : 4;
+								is_codepoint = true;
 								for (int j = 0; j < hex_len; j++) {
 									char32_t c = p_stream->get_char();
 
@@ -376,7 +490,13 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							r_token.type = TK_ERROR;
 							return ERR_PARSE_ERROR;
 						}
-						str += res;
+						if (!utf8) {
+							str += res;
+						} else if (is_codepoint) {
+							_append_utf8(utf8_str, res);
+						} else {
+							utf8_str.push_back((char)res);
+						}
 					} else {
 						if (prev != 0) {
 							r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
@@ -386,7 +506,11 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 						if (ch == '\n') {
 							line++;
 						}
-						str += ch;
+						if (utf8) {
+							utf8_str.push_back((char)ch);
+						} else {
+							str += ch;
+						}
 					}
 				}
 				if (prev != 0) {
@@ -395,8 +519,8 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					return ERR_PARSE_ERROR;
 				}
 
-				if (p_stream->is_utf8()) {
-					str.parse_utf8(str.ascii(true).get_data());
+				if (utf8 && utf8_str.size()) {
+					str.parse_utf8(utf8_str.ptr(), utf8_str.size());
 				}
 				if (string_name) {
 					r_token.type = TK_STRING_NAME;
@@ -417,69 +541,8 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					//a number
 
 					StringBuffer<> num;
-#define READING_SIGN 0
-#define READING_INT 1
-#define READING_DEC 2
-#define READING_EXP 3
-#define READING_DONE 4
-					int reading = READING_INT;
-
-					if (cchar == '-') {
-						num += '-';
-						cchar = p_stream->get_char();
-					}
-
-					char32_t c = cchar;
-					bool exp_sign = false;
-					bool exp_beg = false;
 					bool is_float = false;
-
-					while (true) {
-						switch (reading) {
-							case READING_INT: {
-								if (is_digit(c)) {
-									//pass
-								} else if (c == '.') {
-									reading = READING_DEC;
-									is_float = true;
-								} else if (c == 'e') {
-									reading = READING_EXP;
-									is_float = true;
-								} else {
-									reading = READING_DONE;
-								}
-
-							} break;
-							case READING_DEC: {
-								if (is_digit(c)) {
-								} else if (c == 'e') {
-									reading = READING_EXP;
-								} else {
-									reading = READING_DONE;
-								}
-
-							} break;
-							case READING_EXP: {
-								if (is_digit(c)) {
-									exp_beg = true;
-
-								} else if ((c == '-' || c == '+') && !exp_sign && !exp_beg) {
-									exp_sign = true;
-
-								} else {
-									reading = READING_DONE;
-								}
-							} break;
-						}
-
-						if (reading == READING_DONE) {
-							break;
-						}
-						num += c;
-						c = p_stream->get_char();
-					}
-
-					p_stream->saved = c;
+					p_stream->saved = _read_number(p_stream, cchar, num, is_float);
 
 					r_token.type = TK_NUMBER;
 
@@ -556,19 +619,43 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	// Plain numbers and separators are read straight from the stream, so large packed arrays
+	// don't go through a Token and a Variant per element. Anything else (comments, inf/nan,
+	// errors) falls back to get_token().
+	LocalVector<T> values;
 	bool first = true;
 	while (true) {
 		if (!first) {
-			get_token(p_stream, token, line, r_err_str);
-			if (token.type == TK_COMMA) {
+			char32_t c = _get_non_whitespace_char(p_stream, line);
+			if (c == ',') {
 				//do none
-			} else if (token.type == TK_PARENTHESIS_CLOSE) {
+			} else if (c == ')') {
 				break;
 			} else {
-				r_err_str = "Expected ',' or ')' in constructor";
-				return ERR_PARSE_ERROR;
+				p_stream->saved = c;
+				get_token(p_stream, token, line, r_err_str);
+				if (token.type == TK_COMMA) {
+					//do none
+				} else if (token.type == TK_PARENTHESIS_CLOSE) {
+					break;
+				} else {
+					r_err_str = "Expected ',' or ')' in constructor";
+					return ERR_PARSE_ERROR;
+				}
 			}
 		}
+
+		char32_t c = _get_non_whitespace_char(p_stream, line);
+		if (c == '-' || is_digit(c)) {
+			StringBuffer<> num;
+			bool is_float = false;
+			p_stream->saved = _read_number(p_stream, c, num, is_float);
+			values.push_back(is_float ? (T)num.as_double() : (T)num.as_int());
+			first = false;
+			continue;
+		}
+
+		p_stream->saved = c;
 		get_token(p_stream, token, line, r_err_str);
 
 		if (first && token.type == TK_PARENTHESIS_CLOSE) {
@@ -589,10 +676,16 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 			}
 		}
 
-		r_construct.push_back(token.value);
+		values.push_back(token.value);
 		first = false;
 	}
 
+	if (values.size()) {
+		const int64_t from = r_construct.size();
+		r_construct.resize(from + values.size());
+		memcpy(r_construct.ptrw() + from, values.ptr(), values.size() * sizeof(T));
+	}
+
 	return OK;
 }
 
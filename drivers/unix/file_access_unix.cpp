@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -142,6 +143,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped_data) {
+		munmap(mapped_data, mapped_length);
+		mapped_data = nullptr;
+		mapped_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -228,6 +235,31 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessUnix::map_read_only(uint64_t &r_length) {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	if (!mapped_data) {
+		if (flags != READ) {
+			return nullptr;
+		}
+
+		uint64_t length = get_length();
+		if (length == 0 || length > SIZE_MAX) {
+			return nullptr;
+		}
+
+		void *data = mmap(nullptr, length, PROT_READ, MAP_SHARED, fileno(f), 0);
+		if (data == MAP_FAILED) {
+			return nullptr;
+		}
+		mapped_data = (uint8_t *)data;
+		mapped_length = length;
+	}
+
+	r_length = mapped_length;
+	return mapped_data;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
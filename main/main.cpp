@@ -45,6 +45,7 @@
 #include "core/io/image.h"
 #include "core/io/image_loader.h"
 #include "core/io/ip.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
 #include "core/os/os.h"
@@ -681,6 +682,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--gdextension-docs", "Rather than dumping the engine API, generate API reference from all the GDExtensions loaded in the current project (used with --doctool).\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #ifdef MODULE_GDSCRIPT_ENABLED
 	print_help_option("--gdscript-docs <path>", "Rather than dumping the engine API, generate API reference from the inline documentation in the GDScript files found in <path> (used with --doctool).\n", CLI_OPTION_AVAILABILITY_EDITOR);
+	print_help_option("--gdscript-aot-output <dir>", "Translate the typed GDScript functions compiled while running to C++, written to \"<dir>/gdscript_aot.gen.cpp\" on exit. Copy it to \"modules/gdscript/aot/\" to build it into export templates.\n");
 #endif
 	print_help_option("--build-solutions", "Build the scripting solutions (e.g. for C# projects). Implies --editor and requires a valid project to edit.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("--dump-gdextension-interface", "Generate a GDExtension header file \"gdextension_interface.h\" in the current folder. This file is the base file required to implement a GDExtension.\n", CLI_OPTION_AVAILABILITY_EDITOR);
@@ -1920,6 +1922,20 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	GLOBAL_DEF("debug/file_logging/log_path", "user://logs/godot.log");
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/file_logging/max_log_files", PROPERTY_HINT_RANGE, "0,20,1,or_greater"), 5);
 
+	// Keeping recently used resources loaded only makes sense for the running project.
+	const uint64_t texture_retention_budget = uint64_t(int(GLOBAL_DEF(PropertyInfo(Variant::INT, "memory/limits/resource_retention/texture_budget_mb", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0))) * 1024 * 1024;
+	const uint64_t audio_retention_budget = uint64_t(int(GLOBAL_DEF(PropertyInfo(Variant::INT, "memory/limits/resource_retention/audio_stream_budget_mb", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), 0))) * 1024 * 1024;
+	if (!editor && !project_manager) {
+		ResourceCache::set_retention_budget(StringName("Texture2D"), texture_retention_budget);
+		ResourceCache::set_retention_budget(StringName("AudioStream"), audio_retention_budget);
+	}
+
+	// The editor needs resources fully loaded to inspect and save them.
+	const bool lazy_sub_resources = GLOBAL_DEF("memory/resource_loading/lazy_sub_resources", false);
+	if (!editor && !project_manager) {
+		ResourceFormatLoaderBinary::set_lazy_sub_resources(lazy_sub_resources);
+	}
+
 	// If `--log-file` is used to override the log path, allow creating logs for the project manager or editor
 	// and even if file logging is disabled in the Project Settings.
 	// `--log-file` can be used with any path (including absolute paths outside the project folder),
@@ -4552,6 +4568,7 @@ void Main::cleanup(bool p_force) {
 	}
 
 	ResourceLoader::clear_thread_load_tasks();
+	ResourceCache::clear_retained();
 
 	ResourceLoader::remove_custom_loaders();
 	ResourceSaver::remove_custom_savers();
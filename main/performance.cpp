@@ -97,6 +97,11 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SURFACE);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_DRAW);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SPECIALIZATION);
+	BIND_ENUM_CONSTANT(MEMORY_LAZY_RESOURCES);
+	BIND_ENUM_CONSTANT(MEMORY_RETAINED_RESOURCES);
+	BIND_ENUM_CONSTANT(OBJECT_RETAINED_RESOURCE_COUNT);
+	BIND_ENUM_CONSTANT(OBJECT_RETAINED_RESOURCE_HITS);
+	BIND_ENUM_CONSTANT(OBJECT_RETAINED_RESOURCE_MISSES);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -153,6 +158,11 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("pipeline/compilations_surface"),
 		PNAME("pipeline/compilations_draw"),
 		PNAME("pipeline/compilations_specialization"),
+		PNAME("memory/lazy_resources"),
+		PNAME("memory/retained_resources"),
+		PNAME("object/retained_resources"),
+		PNAME("object/retained_resource_hits"),
+		PNAME("object/retained_resource_misses"),
 	};
 
 	return names[p_monitor];
@@ -248,6 +258,16 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
 		case NAVIGATION_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
+		case MEMORY_LAZY_RESOURCES:
+			return Resource::get_lazy_payloads_pending_size();
+		case MEMORY_RETAINED_RESOURCES:
+			return ResourceCache::get_retention_stats().retained_size;
+		case OBJECT_RETAINED_RESOURCE_COUNT:
+			return ResourceCache::get_retention_stats().retained_count;
+		case OBJECT_RETAINED_RESOURCE_HITS:
+			return ResourceCache::get_retention_stats().hits;
+		case OBJECT_RETAINED_RESOURCE_MISSES:
+			return ResourceCache::get_retention_stats().misses;
 
 		default: {
 		}
@@ -296,7 +316,16 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
-
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 	};
 
 	return types[p_monitor];
@@ -106,6 +106,11 @@ public:
 		PIPELINE_COMPILATIONS_SURFACE,
 		PIPELINE_COMPILATIONS_DRAW,
 		PIPELINE_COMPILATIONS_SPECIALIZATION,
+		MEMORY_LAZY_RESOURCES,
+		MEMORY_RETAINED_RESOURCES,
+		OBJECT_RETAINED_RESOURCE_COUNT,
+		OBJECT_RETAINED_RESOURCE_HITS,
+		OBJECT_RETAINED_RESOURCE_MISSES,
 		MONITOR_MAX
 	};
 
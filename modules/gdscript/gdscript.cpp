@@ -31,10 +31,12 @@
 #include "gdscript.h"
 
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 #include "gdscript_rpc_callable.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_warning.h"
 
@@ -824,7 +826,24 @@ Error GDScript::reload(bool p_keep_state) {
 		return ERR_PARSE_ERROR;
 	}
 
+	// Parse the scripts this one depends on in parallel before the analysis reaches them.
+	// Only the parsers it ends up using outlive this call.
+	LocalVector<Ref<GDScriptParserRef>> dependency_parsers;
+	if (!path.is_empty()) {
+		GDScriptCache::parse_dependencies(&parser, dependency_parsers);
+	}
+
+	// Scripts exported as binary tokens may have their bytecode cached by a previous run.
+	uint32_t binary_tokens_hash = 0;
+	bool cached_bytecode_complete = false;
+	Dictionary cached_bytecode;
+	if (!binary_tokens.is_empty()) {
+		binary_tokens_hash = GDScriptBytecodeCache::hash_script(get_script_path(), binary_tokens);
+		cached_bytecode = GDScriptBytecodeCache::get_script_bytecode(get_script_path(), binary_tokens_hash, cached_bytecode_complete);
+	}
+
 	GDScriptAnalyzer analyzer(&parser);
+	analyzer.set_skip_function_bodies(cached_bytecode_complete);
 	err = analyzer.analyze();
 
 	if (err) {
@@ -844,7 +863,17 @@ Error GDScript::reload(bool p_keep_state) {
 	can_run = ScriptServer::is_scripting_enabled() || parser.is_tool();
 
 	GDScriptCompiler compiler;
+	compiler.set_cached_bytecode(cached_bytecode, cached_bytecode_complete);
 	err = compiler.compile(&parser, this, p_keep_state);
+	// Members and functions may have moved, drop what call sites cached about this script.
+	GDScriptFunction::invalidate_inline_caches();
+
+	if (err && compiler.is_cached_bytecode_stale()) {
+		// Drop the cache entry and start over, analyzing and generating every function.
+		GDScriptBytecodeCache::remove_script(get_script_path());
+		reloading = false;
+		return reload(p_keep_state);
+	}
 
 	if (err) {
 		_err_print_error("GDScript::reload", path.is_empty() ? "built-in" : (const char *)path.utf8().get_data(), compiler.get_error_line(), ("Compile Error: " + compiler.get_error()).utf8().get_data(), false, ERR_HANDLER_SCRIPT);
@@ -860,6 +889,10 @@ Error GDScript::reload(bool p_keep_state) {
 		}
 	}
 
+	if (!binary_tokens.is_empty() && cached_bytecode.is_empty()) {
+		GDScriptBytecodeCache::store_script(this, binary_tokens_hash);
+	}
+
 #ifdef TOOLS_ENABLED
 	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
 	// which are made by calling make_scripts() within compiler.compile() above.
@@ -1632,6 +1665,8 @@ GDScript::~GDScript() {
 	}
 
 	clear();
+	// A new script could be allocated at the same address.
+	GDScriptFunction::invalidate_inline_caches();
 
 	{
 		MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
@@ -2274,6 +2309,11 @@ void GDScriptLanguage::init() {
 	}
 #endif
 
+	GDScriptSamplingProfiler *sampling_profiler = GDScriptSamplingProfiler::get_singleton();
+	if (sampling_profiler && !Engine::get_singleton()->is_editor_hint() && GLOBAL_GET("debug/gdscript/sampling_profiler/autostart")) {
+		sampling_profiler->start(GLOBAL_GET("debug/gdscript/sampling_profiler/interval_usec"));
+	}
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2315,6 +2355,16 @@ void GDScriptLanguage::finish() {
 	}
 	finishing = true;
 
+	GDScriptSamplingProfiler *sampling_profiler = GDScriptSamplingProfiler::get_singleton();
+	if (sampling_profiler && sampling_profiler->is_running()) {
+		sampling_profiler->stop();
+
+		const String output_path = GLOBAL_GET("debug/gdscript/sampling_profiler/output_path");
+		if (!output_path.is_empty()) {
+			sampling_profiler->save_collapsed_stacks(output_path);
+		}
+	}
+
 	_call_stack.free();
 
 	// Clear the cache before parsing the script_list
@@ -2351,6 +2401,8 @@ void GDScriptLanguage::finish() {
 	script_list.clear();
 	function_list.clear();
 
+	GDScriptFunctionState::clear_frame_pool();
+
 	finishing = false;
 }
 
@@ -2937,6 +2989,12 @@ GDScriptLanguage::GDScriptLanguage() {
 
 	int dmcs = GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/settings/gdscript/max_call_stack", PROPERTY_HINT_RANGE, "512," + itos(GDScriptFunction::MAX_CALL_DEPTH - 1) + ",1"), 1024);
 
+	GLOBAL_DEF("application/run/cache_gdscript_bytecode", false);
+
+	GLOBAL_DEF("debug/gdscript/sampling_profiler/autostart", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/gdscript/sampling_profiler/interval_usec", PROPERTY_HINT_RANGE, U"100,1000000,1,suffix:\u00B5s"), 1000);
+	GLOBAL_DEF(PropertyInfo(Variant::STRING, "debug/gdscript/sampling_profiler/output_path", PROPERTY_HINT_SAVE_FILE, "*.txt"), "");
+
 	if (EngineDebugger::is_active()) {
 		//debugging enabled!
 
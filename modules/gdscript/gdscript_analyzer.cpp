@@ -1372,9 +1372,11 @@ void GDScriptAnalyzer::resolve_class_body(GDScriptParser::ClassNode *p_class, co
 				resolve_annotation(E);
 				E->apply(parser, member.function, p_class);
 			}
-			resolve_function_body(member.function);
+			if (!skip_function_bodies) {
+				resolve_function_body(member.function);
+			}
 		} else if (member.type == GDScriptParser::ClassNode::Member::VARIABLE && member.variable->property != GDScriptParser::VariableNode::PROP_NONE) {
-			if (member.variable->property == GDScriptParser::VariableNode::PROP_INLINE) {
+			if (member.variable->property == GDScriptParser::VariableNode::PROP_INLINE && !skip_function_bodies) {
 				if (member.variable->getter != nullptr) {
 					member.variable->getter->return_type = member.variable->datatype_specifier;
 					member.variable->getter->set_datatype(member.get_datatype());
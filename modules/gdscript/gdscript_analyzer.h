@@ -58,6 +58,7 @@ class GDScriptAnalyzer {
 	List<GDScriptParser::LambdaNode *> pending_body_resolution_lambdas;
 	HashMap<const GDScriptParser::ClassNode *, Ref<GDScriptParserRef>> external_class_parser_cache;
 	bool static_context = false;
+	bool skip_function_bodies = false;
 
 	// Tests for detecting invalid overloading of script members
 	static _FORCE_INLINE_ bool has_member_name_conflict_in_script_class(const StringName &p_name, const GDScriptParser::ClassNode *p_current_class_node, const GDScriptParser::Node *p_member);
@@ -162,6 +163,9 @@ public:
 	Error resolve_dependencies();
 	Error analyze();
 
+	// Only for scripts whose functions are all restored from the bytecode cache.
+	void set_skip_function_bodies(bool p_skip) { skip_function_bodies = p_skip; }
+
 	Variant make_variable_default_value(GDScriptParser::VariableNode *p_variable);
 	static bool check_type_compatibility(const GDScriptParser::DataType &p_target, const GDScriptParser::DataType &p_source, bool p_allow_implicit_conversion = false, const GDScriptParser::Node *p_source_node = nullptr);
 
@@ -0,0 +1,659 @@
+/**************************************************************************/
+/*  gdscript_aot.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "gdscript_aot.h"
+
+#include "gdscript.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/templates/hash_set.h"
+
+GDScriptAOT *GDScriptAOT::singleton = nullptr;
+
+static const char *_type_adjust_c_type(int p_opcode) {
+#define TYPE_ADJUST_C_TYPE(m_v_type, m_c_type)          \
+	case GDScriptFunction::OPCODE_TYPE_ADJUST_##m_v_type: \
+		return m_c_type
+
+	switch (p_opcode) {
+		TYPE_ADJUST_C_TYPE(BOOL, "bool");
+		TYPE_ADJUST_C_TYPE(INT, "int64_t");
+		TYPE_ADJUST_C_TYPE(FLOAT, "double");
+		TYPE_ADJUST_C_TYPE(STRING, "String");
+		TYPE_ADJUST_C_TYPE(VECTOR2, "Vector2");
+		TYPE_ADJUST_C_TYPE(VECTOR2I, "Vector2i");
+		TYPE_ADJUST_C_TYPE(RECT2, "Rect2");
+		TYPE_ADJUST_C_TYPE(RECT2I, "Rect2i");
+		TYPE_ADJUST_C_TYPE(VECTOR3, "Vector3");
+		TYPE_ADJUST_C_TYPE(VECTOR3I, "Vector3i");
+		TYPE_ADJUST_C_TYPE(TRANSFORM2D, "Transform2D");
+		TYPE_ADJUST_C_TYPE(VECTOR4, "Vector4");
+		TYPE_ADJUST_C_TYPE(VECTOR4I, "Vector4i");
+		TYPE_ADJUST_C_TYPE(PLANE, "Plane");
+		TYPE_ADJUST_C_TYPE(QUATERNION, "Quaternion");
+		TYPE_ADJUST_C_TYPE(AABB, "AABB");
+		TYPE_ADJUST_C_TYPE(BASIS, "Basis");
+		TYPE_ADJUST_C_TYPE(TRANSFORM3D, "Transform3D");
+		TYPE_ADJUST_C_TYPE(PROJECTION, "Projection");
+		TYPE_ADJUST_C_TYPE(COLOR, "Color");
+		TYPE_ADJUST_C_TYPE(STRING_NAME, "StringName");
+		TYPE_ADJUST_C_TYPE(NODE_PATH, "NodePath");
+		TYPE_ADJUST_C_TYPE(RID, "RID");
+		TYPE_ADJUST_C_TYPE(OBJECT, "Object *");
+		TYPE_ADJUST_C_TYPE(CALLABLE, "Callable");
+		TYPE_ADJUST_C_TYPE(SIGNAL, "Signal");
+		TYPE_ADJUST_C_TYPE(DICTIONARY, "Dictionary");
+		TYPE_ADJUST_C_TYPE(ARRAY, "Array");
+		TYPE_ADJUST_C_TYPE(PACKED_BYTE_ARRAY, "PackedByteArray");
+		TYPE_ADJUST_C_TYPE(PACKED_INT32_ARRAY, "PackedInt32Array");
+		TYPE_ADJUST_C_TYPE(PACKED_INT64_ARRAY, "PackedInt64Array");
+		TYPE_ADJUST_C_TYPE(PACKED_FLOAT32_ARRAY, "PackedFloat32Array");
+		TYPE_ADJUST_C_TYPE(PACKED_FLOAT64_ARRAY, "PackedFloat64Array");
+		TYPE_ADJUST_C_TYPE(PACKED_STRING_ARRAY, "PackedStringArray");
+		TYPE_ADJUST_C_TYPE(PACKED_VECTOR2_ARRAY, "PackedVector2Array");
+		TYPE_ADJUST_C_TYPE(PACKED_VECTOR3_ARRAY, "PackedVector3Array");
+		TYPE_ADJUST_C_TYPE(PACKED_COLOR_ARRAY, "PackedColorArray");
+		TYPE_ADJUST_C_TYPE(PACKED_VECTOR4_ARRAY, "PackedVector4Array");
+		default:
+			return nullptr;
+	}
+
+#undef TYPE_ADJUST_C_TYPE
+}
+
+uint32_t GDScriptAOT::_hash_function(const GDScriptFunction *p_function) {
+	const int layout[] = {
+		p_function->_stack_size,
+		p_function->_argument_count,
+		p_function->_default_arg_count,
+		p_function->_constant_count,
+		p_function->_operator_funcs_count,
+		p_function->_setters_count,
+		p_function->_getters_count,
+		p_function->_keyed_setters_count,
+		p_function->_keyed_getters_count,
+		p_function->_indexed_setters_count,
+		p_function->_indexed_getters_count,
+		p_function->_builtin_methods_count,
+		p_function->_constructors_count,
+		p_function->_utilities_count,
+		p_function->_methods_count,
+	};
+
+	uint32_t hash = hash_murmur3_buffer(layout, sizeof(layout));
+	hash = hash_murmur3_buffer(p_function->_code_ptr, p_function->_code_size * sizeof(int), hash);
+	if (p_function->_default_arg_count > 0) {
+		hash = hash_murmur3_buffer(p_function->_default_arg_ptr, (p_function->_default_arg_count + 1) * sizeof(int), hash);
+	}
+	return hash;
+}
+
+// Returns the size of the instruction at `p_ip`, or 0 if it can't be translated.
+int GDScriptAOT::_get_instruction_size(const GDScriptFunction *p_function, int p_ip) {
+	const int *code = p_function->_code_ptr;
+
+	switch (code[p_ip]) {
+		case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT:
+			return 6;
+		case GDScriptFunction::OPCODE_OPERATOR_VALIDATED:
+		case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED:
+		case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED:
+		case GDScriptFunction::OPCODE_SET_INDEXED_PACKED:
+		case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED:
+		case GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED:
+		case GDScriptFunction::OPCODE_GET_INDEXED_PACKED:
+		case GDScriptFunction::OPCODE_ITERATE_BEGIN_INT:
+		case GDScriptFunction::OPCODE_ITERATE_BEGIN_FLOAT:
+		case GDScriptFunction::OPCODE_ITERATE_INT:
+		case GDScriptFunction::OPCODE_ITERATE_FLOAT:
+			return 5;
+		case GDScriptFunction::OPCODE_SET_NAMED_VALIDATED:
+		case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED:
+		case GDScriptFunction::OPCODE_ASSIGN_TYPED_BUILTIN:
+			return 4;
+		case GDScriptFunction::OPCODE_ASSIGN:
+		case GDScriptFunction::OPCODE_JUMP_IF:
+		case GDScriptFunction::OPCODE_JUMP_IF_NOT:
+		case GDScriptFunction::OPCODE_JUMP_IF_SHARED:
+		case GDScriptFunction::OPCODE_RETURN_TYPED_BUILTIN:
+		case GDScriptFunction::OPCODE_ASSERT:
+			return 3;
+		case GDScriptFunction::OPCODE_ASSIGN_NULL:
+		case GDScriptFunction::OPCODE_ASSIGN_TRUE:
+		case GDScriptFunction::OPCODE_ASSIGN_FALSE:
+		case GDScriptFunction::OPCODE_JUMP:
+		case GDScriptFunction::OPCODE_RETURN:
+		case GDScriptFunction::OPCODE_LINE:
+			return 2;
+		case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT:
+		case GDScriptFunction::OPCODE_BREAKPOINT:
+		case GDScriptFunction::OPCODE_END:
+			return 1;
+		case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED:
+		case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED:
+		case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED:
+		case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+		case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN:
+		case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN:
+		case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN:
+			if (p_ip + 1 >= p_function->_code_size) {
+				return 0;
+			}
+			return code[p_ip + 1] + 4;
+		default:
+			return _type_adjust_c_type(code[p_ip]) ? 2 : 0;
+	}
+}
+
+bool GDScriptAOT::generate_function_code(const GDScriptFunction *p_function, String &r_code) {
+	const int *code = p_function->_code_ptr;
+	const int code_size = p_function->_code_size;
+	if (!code || code_size == 0 || code[code_size - 1] != GDScriptFunction::OPCODE_END) {
+		return false;
+	}
+
+	// First pass: check every instruction can be translated, and collect jump targets.
+	HashSet<int> instructions;
+	HashSet<int> targets;
+	bool uses_stack = false;
+	bool uses_constants = false;
+	bool uses_members = false;
+
+	auto check_address = [&](int p_address) -> bool {
+		const int index = p_address & GDScriptFunction::ADDR_MASK;
+		switch ((p_address & GDScriptFunction::ADDR_TYPE_MASK) >> GDScriptFunction::ADDR_BITS) {
+			case GDScriptFunction::ADDR_TYPE_STACK:
+				uses_stack = true;
+				return index < p_function->_stack_size;
+			case GDScriptFunction::ADDR_TYPE_CONSTANT:
+				uses_constants = true;
+				return index < p_function->_constant_count;
+			case GDScriptFunction::ADDR_TYPE_MEMBER:
+				uses_members = true;
+				return true;
+		}
+		return false;
+	};
+
+	for (int ip = 0; ip < code_size;) {
+		const int size = _get_instruction_size(p_function, ip);
+		if (size == 0 || ip + size > code_size) {
+			return false;
+		}
+		instructions.insert(ip);
+
+		const int opcode = code[ip];
+		switch (opcode) {
+			case GDScriptFunction::OPCODE_JUMP:
+				targets.insert(code[ip + 1]);
+				break;
+			case GDScriptFunction::OPCODE_JUMP_IF:
+			case GDScriptFunction::OPCODE_JUMP_IF_NOT:
+			case GDScriptFunction::OPCODE_JUMP_IF_SHARED:
+				targets.insert(code[ip + 2]);
+				break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT:
+				targets.insert(code[ip + 5]);
+				break;
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_INT:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_FLOAT:
+			case GDScriptFunction::OPCODE_ITERATE_INT:
+			case GDScriptFunction::OPCODE_ITERATE_FLOAT:
+				targets.insert(code[ip + 4]);
+				break;
+			case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT:
+				for (int i = 0; i <= p_function->_default_arg_count; i++) {
+					targets.insert(p_function->_default_arg_ptr[i]);
+				}
+				break;
+			default:
+				break;
+		}
+
+		// Operand addresses.
+		int first = 1;
+		int count = 0;
+		switch (opcode) {
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED:
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT:
+			case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED:
+			case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED:
+			case GDScriptFunction::OPCODE_SET_INDEXED_PACKED:
+			case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED:
+			case GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED:
+			case GDScriptFunction::OPCODE_GET_INDEXED_PACKED:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_INT:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_FLOAT:
+			case GDScriptFunction::OPCODE_ITERATE_INT:
+			case GDScriptFunction::OPCODE_ITERATE_FLOAT:
+				count = 3;
+				break;
+			case GDScriptFunction::OPCODE_SET_NAMED_VALIDATED:
+			case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED:
+			case GDScriptFunction::OPCODE_ASSIGN:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_BUILTIN:
+				count = 2;
+				break;
+			case GDScriptFunction::OPCODE_JUMP:
+			case GDScriptFunction::OPCODE_LINE:
+			case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT:
+			case GDScriptFunction::OPCODE_BREAKPOINT:
+			case GDScriptFunction::OPCODE_END:
+				count = 0;
+				break;
+			case GDScriptFunction::OPCODE_ASSERT:
+				// The message is only read when the assertion fails, which the VM handles.
+				count = 1;
+				break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN:
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN:
+				first = 2;
+				count = code[ip + 1];
+				break;
+			default:
+				// Single operand: assignments of constants, conditional jumps, returns and type adjustments.
+				count = 1;
+				break;
+		}
+		for (int i = 0; i < count; i++) {
+			if (!check_address(code[ip + first + i])) {
+				return false;
+			}
+		}
+
+		ip += size;
+	}
+
+	for (const int &E : targets) {
+		if (!instructions.has(E)) {
+			return false;
+		}
+	}
+
+	auto addr = [&](int p_ip) -> String {
+		const int address = code[p_ip];
+		const String index = itos(address & GDScriptFunction::ADDR_MASK);
+		switch ((address & GDScriptFunction::ADDR_TYPE_MASK) >> GDScriptFunction::ADDR_BITS) {
+			case GDScriptFunction::ADDR_TYPE_CONSTANT:
+				return "(c + " + index + ")";
+			case GDScriptFunction::ADDR_TYPE_MEMBER:
+				return "(m + " + index + ")";
+			default:
+				return "(s + " + index + ")";
+		}
+	};
+
+	auto instruction_args = [&](int p_ip, int p_argc) -> String {
+		if (p_argc == 0) {
+			return "\t\tconst Variant **args = nullptr;\n";
+		}
+		String args = "\t\tconst Variant *args[] = { ";
+		for (int i = 0; i < p_argc; i++) {
+			if (i > 0) {
+				args += ", ";
+			}
+			args += addr(p_ip + 2 + i);
+		}
+		return args + " };\n";
+	};
+
+	auto type = [](int p_type) -> String {
+		return "Variant::Type(" + itos(p_type) + ")";
+	};
+
+	String end = itos(code_size - 1);
+
+	// Second pass: translate.
+	String body;
+	if (uses_stack) {
+		body += "\tVariant *s = p_frame.stack;\n";
+	}
+	if (uses_constants) {
+		body += "\tVariant *c = GDScriptAOT::get_constants(p_frame.function);\n";
+	}
+	if (uses_members) {
+		body += "\tVariant *m = p_frame.members;\n";
+		body += "\tif (unlikely(!m)) {\n\t\treturn 0;\n\t}\n";
+	}
+
+	for (int ip = 0; ip < code_size; ip += _get_instruction_size(p_function, ip)) {
+		if (targets.has(ip)) {
+			body += "L" + itos(ip) + ":\n";
+		}
+		const String retry = "\t\t\treturn " + itos(ip) + ";\n";
+
+		switch (code[ip]) {
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED: {
+				body += "\tGDScriptAOT::get_operator_funcs(p_frame.function)[" + itos(code[ip + 4]) + "](" + addr(ip + 1) + ", " + addr(ip + 2) + ", " + addr(ip + 3) + ");\n";
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT: {
+				body += "\tGDScriptAOT::get_operator_funcs(p_frame.function)[" + itos(code[ip + 4]) + "](" + addr(ip + 1) + ", " + addr(ip + 2) + ", " + addr(ip + 3) + ");\n";
+				body += "\tif (!*VariantInternal::get_bool(" + addr(ip + 3) + ")) {\n\t\tgoto L" + itos(code[ip + 5]) + ";\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED: {
+				body += "\t{\n\t\tbool valid;\n";
+				body += "\t\tGDScriptAOT::get_keyed_setters(p_frame.function)[" + itos(code[ip + 4]) + "](" + addr(ip + 1) + ", " + addr(ip + 2) + ", " + addr(ip + 3) + ", &valid);\n";
+				body += "#ifdef DEBUG_ENABLED\n\t\tif (unlikely(!valid)) {\n" + retry + "\t\t}\n#endif\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED: {
+				body += "\t{\n\t\tbool oob;\n";
+				body += "\t\tGDScriptAOT::get_indexed_setters(p_frame.function)[" + itos(code[ip + 4]) + "](" + addr(ip + 1) + ", *VariantInternal::get_int(" + addr(ip + 2) + "), " + addr(ip + 3) + ", &oob);\n";
+				body += "#ifdef DEBUG_ENABLED\n\t\tif (unlikely(oob)) {\n" + retry + "\t\t}\n#endif\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_SET_INDEXED_PACKED: {
+				body += "\t{\n\t\tif (unlikely(!GDScriptPackedArray::set((Variant::Type)" + itos(code[ip + 4]) + ", " + addr(ip + 1) + ", *VariantInternal::get_int(" + addr(ip + 2) + "), " + addr(ip + 3) + "))) {\n" + retry + "\t\t}\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED: {
+				const String getter = "GDScriptAOT::get_keyed_getters(p_frame.function)[" + itos(code[ip + 4]) + "]";
+				body += "\t{\n\t\tbool valid;\n";
+				body += "#ifdef DEBUG_ENABLED\n";
+				body += "\t\tVariant ret;\n";
+				body += "\t\t" + getter + "(" + addr(ip + 1) + ", " + addr(ip + 2) + ", &ret, &valid);\n";
+				body += "\t\tif (unlikely(!valid)) {\n" + retry + "\t\t}\n";
+				body += "\t\t*" + addr(ip + 3) + " = ret;\n";
+				body += "#else\n";
+				body += "\t\t" + getter + "(" + addr(ip + 1) + ", " + addr(ip + 2) + ", " + addr(ip + 3) + ", &valid);\n";
+				body += "#endif\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED: {
+				body += "\t{\n\t\tbool oob;\n";
+				body += "\t\tGDScriptAOT::get_indexed_getters(p_frame.function)[" + itos(code[ip + 4]) + "](" + addr(ip + 1) + ", *VariantInternal::get_int(" + addr(ip + 2) + "), " + addr(ip + 3) + ", &oob);\n";
+				body += "#ifdef DEBUG_ENABLED\n\t\tif (unlikely(oob)) {\n" + retry + "\t\t}\n#endif\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_GET_INDEXED_PACKED: {
+				body += "\t{\n\t\tif (unlikely(!GDScriptPackedArray::get((Variant::Type)" + itos(code[ip + 4]) + ", " + addr(ip + 1) + ", *VariantInternal::get_int(" + addr(ip + 2) + "), " + addr(ip + 3) + "))) {\n" + retry + "\t\t}\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_SET_NAMED_VALIDATED: {
+				body += "\tGDScriptAOT::get_setters(p_frame.function)[" + itos(code[ip + 3]) + "](" + addr(ip + 1) + ", " + addr(ip + 2) + ");\n";
+			} break;
+			case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED: {
+				body += "\tGDScriptAOT::get_getters(p_frame.function)[" + itos(code[ip + 3]) + "](" + addr(ip + 1) + ", " + addr(ip + 2) + ");\n";
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN: {
+				body += "\t*" + addr(ip + 1) + " = *" + addr(ip + 2) + ";\n";
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_NULL: {
+				body += "\t*" + addr(ip + 1) + " = Variant();\n";
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_TRUE: {
+				body += "\t*" + addr(ip + 1) + " = true;\n";
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_FALSE: {
+				body += "\t*" + addr(ip + 1) + " = false;\n";
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_BUILTIN: {
+				const String var_type = type(code[ip + 3]);
+				body += "\tif (" + addr(ip + 2) + "->get_type() != " + var_type + ") {\n";
+				body += "#ifdef DEBUG_ENABLED\n\t\tif (unlikely(!Variant::can_convert_strict(" + addr(ip + 2) + "->get_type(), " + var_type + "))) {\n" + retry + "\t\t}\n#endif\n";
+				body += "\t\tconst Variant *src = " + addr(ip + 2) + ";\n";
+				body += "\t\tCallable::CallError ce;\n";
+				body += "\t\tVariant::construct(" + var_type + ", *" + addr(ip + 1) + ", &src, 1, ce);\n";
+				body += "\t} else {\n";
+				body += "\t\t*" + addr(ip + 1) + " = *" + addr(ip + 2) + ";\n";
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED: {
+				const int instr_arg_count = code[ip + 1];
+				const int argc = code[ip + 2 + instr_arg_count];
+				body += "\t{\n" + instruction_args(ip, argc);
+				body += "\t\tGDScriptAOT::get_constructors(p_frame.function)[" + itos(code[ip + 3 + instr_arg_count]) + "](" + addr(ip + 2 + argc) + ", args);\n";
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED: {
+				const int instr_arg_count = code[ip + 1];
+				const int argc = code[ip + 2 + instr_arg_count];
+				body += "\t{\n" + instruction_args(ip, argc);
+				body += "\t\tGDScriptAOT::get_utilities(p_frame.function)[" + itos(code[ip + 3 + instr_arg_count]) + "](" + addr(ip + 2 + argc) + ", args, " + itos(argc) + ");\n";
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED: {
+				const int instr_arg_count = code[ip + 1];
+				const int argc = code[ip + 2 + instr_arg_count];
+				body += "\t{\n" + instruction_args(ip, argc);
+				body += "\t\tGDScriptAOT::get_builtin_methods(p_frame.function)[" + itos(code[ip + 3 + instr_arg_count]) + "](" + addr(ip + 2 + argc) + ", args, " + itos(argc) + ", " + addr(ip + 3 + argc) + ");\n";
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+				const int instr_arg_count = code[ip + 1];
+				const int argc = code[ip + 2 + instr_arg_count];
+				const bool has_return = code[ip] == GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN;
+				body += "\t{\n";
+				body += "#ifdef DEBUG_ENABLED\n";
+				body += "\t\tbool freed = false;\n";
+				body += "\t\tObject *base_obj = " + addr(ip + 2 + argc) + "->get_validated_object_with_check(freed);\n";
+				body += "\t\tif (unlikely(freed || !base_obj)) {\n" + retry + "\t\t}\n";
+				body += "#else\n";
+				body += "\t\tObject *base_obj = *VariantInternal::get_object(" + addr(ip + 2 + argc) + ");\n";
+				body += "#endif\n";
+				body += instruction_args(ip, argc);
+				if (has_return) {
+					body += "\t\tGDScriptAOT::get_methods(p_frame.function)[" + itos(code[ip + 3 + instr_arg_count]) + "]->validated_call(base_obj, args, " + addr(ip + 3 + argc) + ");\n";
+				} else {
+					body += "\t\tVariantInternal::initialize(" + addr(ip + 3 + argc) + ", Variant::NIL);\n";
+					body += "\t\tGDScriptAOT::get_methods(p_frame.function)[" + itos(code[ip + 3 + instr_arg_count]) + "]->validated_call(base_obj, args, nullptr);\n";
+				}
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN: {
+				const int instr_arg_count = code[ip + 1];
+				const int argc = code[ip + 2 + instr_arg_count];
+				const bool has_return = code[ip] == GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN;
+				body += "\t{\n" + instruction_args(ip, argc);
+				if (has_return) {
+					body += "\t\tGDScriptAOT::get_methods(p_frame.function)[" + itos(code[ip + 3 + instr_arg_count]) + "]->validated_call(nullptr, args, " + addr(ip + 2 + argc) + ");\n";
+				} else {
+					body += "\t\tVariantInternal::initialize(" + addr(ip + 2 + argc) + ", Variant::NIL);\n";
+					body += "\t\tGDScriptAOT::get_methods(p_frame.function)[" + itos(code[ip + 3 + instr_arg_count]) + "]->validated_call(nullptr, args, nullptr);\n";
+				}
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_JUMP: {
+				body += "\tgoto L" + itos(code[ip + 1]) + ";\n";
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_IF: {
+				body += "\tif (" + addr(ip + 1) + "->booleanize()) {\n\t\tgoto L" + itos(code[ip + 2]) + ";\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_IF_NOT: {
+				body += "\tif (!" + addr(ip + 1) + "->booleanize()) {\n\t\tgoto L" + itos(code[ip + 2]) + ";\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_IF_SHARED: {
+				body += "\tif (" + addr(ip + 1) + "->is_shared()) {\n\t\tgoto L" + itos(code[ip + 2]) + ";\n\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT: {
+				body += "\tswitch (p_frame.defarg) {\n";
+				for (int i = 0; i < p_function->_default_arg_count; i++) {
+					body += "\t\tcase " + itos(i) + ":\n\t\t\tgoto L" + itos(p_function->_default_arg_ptr[i]) + ";\n";
+				}
+				body += "\t\tdefault:\n\t\t\tgoto L" + itos(p_function->_default_arg_ptr[p_function->_default_arg_count]) + ";\n";
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_RETURN: {
+				body += "\t*p_frame.retvalue = *" + addr(ip + 1) + ";\n";
+				body += "\treturn " + end + ";\n";
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_BUILTIN: {
+				const String ret_type = type(code[ip + 2]);
+				body += "\tif (" + addr(ip + 1) + "->get_type() != " + ret_type + ") {\n";
+				body += "\t\tif (unlikely(!Variant::can_convert_strict(" + addr(ip + 1) + "->get_type(), " + ret_type + "))) {\n" + retry + "\t\t}\n";
+				body += "\t\tconst Variant *r = " + addr(ip + 1) + ";\n";
+				body += "\t\tCallable::CallError ce;\n";
+				body += "\t\tVariant::construct(" + ret_type + ", *p_frame.retvalue, &r, 1, ce);\n";
+				body += "\t} else {\n";
+				body += "\t\t*p_frame.retvalue = *" + addr(ip + 1) + ";\n";
+				body += "\t}\n";
+				body += "\treturn " + end + ";\n";
+			} break;
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_INT:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_FLOAT: {
+				const bool is_int = code[ip] == GDScriptFunction::OPCODE_ITERATE_BEGIN_INT;
+				const String getter = is_int ? "VariantInternal::get_int" : "VariantInternal::get_float";
+				const String variant_type = is_int ? "Variant::INT" : "Variant::FLOAT";
+				body += "\t{\n";
+				body += "\t\tconst " + String(is_int ? "int64_t" : "double") + " size = *" + getter + "(" + addr(ip + 2) + ");\n";
+				body += "\t\tVariantInternal::initialize(" + addr(ip + 1) + ", " + variant_type + ");\n";
+				body += "\t\t*" + getter + "(" + addr(ip + 1) + ") = 0;\n";
+				body += "\t\tif (size <= 0) {\n";
+				body += "\t\t\tgoto L" + itos(code[ip + 4]) + ";\n";
+				body += "\t\t}\n";
+				body += "\t\tVariantInternal::initialize(" + addr(ip + 3) + ", " + variant_type + ");\n";
+				body += "\t\t*" + getter + "(" + addr(ip + 3) + ") = 0;\n";
+				body += "\t}\n";
+			} break;
+			case GDScriptFunction::OPCODE_ITERATE_INT:
+			case GDScriptFunction::OPCODE_ITERATE_FLOAT: {
+				const String getter = code[ip] == GDScriptFunction::OPCODE_ITERATE_INT ? "VariantInternal::get_int" : "VariantInternal::get_float";
+				body += "\tif (++(*" + getter + "(" + addr(ip + 1) + ")) >= *" + getter + "(" + addr(ip + 2) + ")) {\n";
+				body += "\t\tgoto L" + itos(code[ip + 4]) + ";\n";
+				body += "\t}\n";
+				body += "\t*" + getter + "(" + addr(ip + 3) + ") = *" + getter + "(" + addr(ip + 1) + ");\n";
+			} break;
+			case GDScriptFunction::OPCODE_ASSERT: {
+				body += "#ifdef DEBUG_ENABLED\n\tif (unlikely(!" + addr(ip + 1) + "->booleanize())) {\n\t\treturn " + itos(ip) + ";\n\t}\n#endif\n";
+			} break;
+			case GDScriptFunction::OPCODE_LINE: {
+				body += "\tGDSCRIPT_AOT_LINE(p_frame, " + itos(code[ip + 1]) + ");\n";
+			} break;
+			case GDScriptFunction::OPCODE_BREAKPOINT: {
+				// Translated functions only run without a debugger.
+			} break;
+			case GDScriptFunction::OPCODE_END: {
+				body += "\treturn " + end + ";\n";
+			} break;
+			default: {
+				body += "\tVariantTypeAdjust<" + String(_type_adjust_c_type(code[ip])) + ">::adjust(" + addr(ip + 1) + ");\n";
+			} break;
+		}
+	}
+
+	r_code = body;
+	return true;
+}
+
+void GDScriptAOT::register_function(const char *p_key, uint32_t p_hash, Function p_function) {
+	ERR_FAIL_NULL(singleton);
+
+	Entry entry;
+	entry.hash = p_hash;
+	entry.function = p_function;
+	singleton->functions.insert(String::utf8(p_key), entry);
+}
+
+void GDScriptAOT::bind_function(GDScript *p_script, GDScriptFunction *p_function) {
+	if (!singleton || !p_function->_code_ptr) {
+		return;
+	}
+	if (singleton->functions.is_empty() && singleton->output_dir.is_empty()) {
+		return;
+	}
+
+	const String key = p_script->get_fully_qualified_name() + "::" + String(p_function->get_name());
+	const uint32_t hash = _hash_function(p_function);
+
+	if (!singleton->output_dir.is_empty()) {
+		Generated generated;
+		generated.hash = hash;
+		if (generate_function_code(p_function, generated.code)) {
+			MutexLock lock(singleton->mutex);
+			singleton->generated[key] = generated;
+		}
+	}
+
+	// Only written while registering, before any script is compiled.
+	const Entry *entry = singleton->functions.getptr(key);
+	if (entry && entry->hash == hash) {
+		p_function->_aot_function = entry->function;
+	}
+}
+
+Error GDScriptAOT::save_generated_code() {
+	MutexLock lock(mutex);
+
+	if (output_dir.is_empty() || generated.is_empty()) {
+		return OK;
+	}
+
+	List<String> keys;
+	for (const KeyValue<String, Generated> &E : generated) {
+		keys.push_back(E.key);
+	}
+	keys.sort();
+
+	const String path = output_dir.path_join("gdscript_aot.gen.cpp");
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(file.is_null(), err, vformat(R"(Cannot write translated GDScript functions to "%s".)", path));
+
+	file->store_line("/* THIS FILE IS GENERATED DO NOT EDIT */");
+	file->store_line("");
+	file->store_line("#include \"modules/gdscript/gdscript_aot.h\"");
+	file->store_line("");
+
+	String registration;
+	int index = 0;
+	for (const String &key : keys) {
+		const Generated &function = generated[key];
+		const String symbol = "_gdscript_aot_function_" + itos(index++);
+
+		file->store_string("// " + key + "\n");
+		file->store_string("static int " + symbol + "(GDScriptAOTFrame &p_frame) {\n" + function.code + "}\n\n");
+		registration += "\tGDScriptAOT::register_function(\"" + key.c_escape() + "\", " + itos(function.hash) + "u, &" + symbol + ");\n";
+	}
+
+	file->store_line("void register_gdscript_aot_functions() {");
+	file->store_string(registration);
+	file->store_line("}");
+
+	print_line(vformat("Translated %d GDScript functions to \"%s\".", keys.size(), path));
+	return OK;
+}
+
+GDScriptAOT::GDScriptAOT() {
+	singleton = this;
+
+	const List<String> args = OS::get_singleton()->get_cmdline_args();
+	for (const List<String>::Element *E = args.front(); E; E = E->next()) {
+		if (E->get() == "--gdscript-aot-output" && E->next()) {
+			output_dir = E->next()->get();
+		}
+	}
+}
+
+GDScriptAOT::~GDScriptAOT() {
+	singleton = nullptr;
+}
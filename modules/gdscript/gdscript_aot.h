@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*  gdscript_aot.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_AOT_H
+#define GDSCRIPT_AOT_H
+
+#include "gdscript_function.h"
+#include "gdscript_packed_array.h"
+
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/variant/variant_internal.h"
+
+class GDScript;
+
+// State shared between the VM and a translated function. Translated functions
+// work directly on the VM stack, so they can hand execution back at any
+// instruction boundary.
+struct GDScriptAOTFrame {
+	const GDScriptFunction *function = nullptr;
+	Variant *stack = nullptr;
+	Variant *members = nullptr;
+	Variant *retvalue = nullptr;
+	int defarg = 0;
+#ifdef DEBUG_ENABLED
+	int *line = nullptr;
+#endif
+};
+
+#ifdef DEBUG_ENABLED
+#define GDSCRIPT_AOT_LINE(m_frame, m_line) (*(m_frame).line = (m_line))
+#else
+#define GDSCRIPT_AOT_LINE(m_frame, m_line)
+#endif
+
+// Ahead-of-time translation of typed GDScript functions to C++.
+//
+// Running a project with `--gdscript-aot-output <dir>` translates every function
+// compiled during the run whose bytecode only uses validated (fully typed)
+// instructions, and writes them to `<dir>/gdscript_aot.gen.cpp` on exit. Copying
+// that file to `modules/gdscript/aot/` and building the export template again
+// links the translated functions in. The functions must be generated with a
+// template built with the same options, since the bytecode they translate is
+// checked by hash when scripts are compiled and functions that don't match keep
+// running in the VM.
+//
+// A translated function returns the address of the instruction the VM must
+// resume at: the final `OPCODE_END` when it ran to completion, or the
+// instruction that failed a runtime check, so the VM executes it again and
+// reports the error as usual.
+class GDScriptAOT {
+public:
+	typedef int (*Function)(GDScriptAOTFrame &p_frame);
+
+private:
+	static GDScriptAOT *singleton;
+
+	struct Entry {
+		uint32_t hash = 0;
+		Function function = nullptr;
+	};
+
+	HashMap<String, Entry> functions;
+
+	struct Generated {
+		uint32_t hash = 0;
+		String code;
+	};
+
+	Mutex mutex;
+	String output_dir;
+	HashMap<String, Generated> generated;
+
+	static uint32_t _hash_function(const GDScriptFunction *p_function);
+	static int _get_instruction_size(const GDScriptFunction *p_function, int p_ip);
+
+public:
+	static GDScriptAOT *get_singleton() { return singleton; }
+
+	// Called by generated code at module initialization.
+	static void register_function(const char *p_key, uint32_t p_hash, Function p_function);
+
+	// Attaches the translation of `p_function` if one was built in, and translates
+	// the function when generating.
+	static void bind_function(GDScript *p_script, GDScriptFunction *p_function);
+
+	// Writes the body of the C++ translation of `p_function`, or returns `false` if
+	// it uses instructions that can't be translated.
+	static bool generate_function_code(const GDScriptFunction *p_function, String &r_code);
+
+	Error save_generated_code();
+
+	_FORCE_INLINE_ static Variant *get_constants(const GDScriptFunction *p_function) { return p_function->_constants_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedOperatorEvaluator *get_operator_funcs(const GDScriptFunction *p_function) { return p_function->_operator_funcs_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedSetter *get_setters(const GDScriptFunction *p_function) { return p_function->_setters_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedGetter *get_getters(const GDScriptFunction *p_function) { return p_function->_getters_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedKeyedSetter *get_keyed_setters(const GDScriptFunction *p_function) { return p_function->_keyed_setters_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedKeyedGetter *get_keyed_getters(const GDScriptFunction *p_function) { return p_function->_keyed_getters_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedIndexedSetter *get_indexed_setters(const GDScriptFunction *p_function) { return p_function->_indexed_setters_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedIndexedGetter *get_indexed_getters(const GDScriptFunction *p_function) { return p_function->_indexed_getters_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedBuiltInMethod *get_builtin_methods(const GDScriptFunction *p_function) { return p_function->_builtin_methods_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedConstructor *get_constructors(const GDScriptFunction *p_function) { return p_function->_constructors_ptr; }
+	_FORCE_INLINE_ static const Variant::ValidatedUtilityFunction *get_utilities(const GDScriptFunction *p_function) { return p_function->_utilities_ptr; }
+	_FORCE_INLINE_ static MethodBind *const *get_methods(const GDScriptFunction *p_function) { return p_function->_methods_ptr; }
+
+	GDScriptAOT();
+	~GDScriptAOT();
+};
+
+#ifdef GDSCRIPT_AOT_ENABLED
+// Defined in the generated `aot/gdscript_aot.gen.cpp`.
+void register_gdscript_aot_functions();
+#endif
+
+#endif // GDSCRIPT_AOT_H
@@ -31,6 +31,7 @@
 #include "gdscript_byte_codegen.h"
 
 #include "gdscript.h"
+#include "gdscript_packed_array.h"
 
 #include "core/debugger/engine_debugger.h"
 
@@ -152,6 +153,7 @@ void GDScriptByteCodeGenerator::start_parameters() {
 	if (function->_default_arg_count > 0) {
 		append(GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT);
 		function->default_arguments.push_back(opcodes.size());
+		last_operator = LastOperator();
 	}
 }
 
@@ -401,6 +403,11 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 	function->_stack_size = GDScriptFunction::FIXED_ADDRESSES_MAX + max_locals + temporaries.size();
 	function->_instruction_args_size = instr_args_max;
 
+	if (inline_cache_count) {
+		function->_inline_caches_ptr = memnew_arr(GDScriptFunction::InlineCache, inline_cache_count);
+		function->_inline_caches_count = inline_cache_count;
+	}
+
 #ifdef DEBUG_ENABLED
 	function->operator_names = operator_names;
 	function->setter_names = setter_names;
@@ -431,6 +438,58 @@ void GDScriptByteCodeGenerator::set_initial_line(int p_line) {
 #define IS_BUILTIN_TYPE(m_var, m_type) \
 	(m_var.type.has_type && m_var.type.kind == GDScriptDataType::BUILTIN && m_var.type.builtin_type == m_type && m_type != Variant::NIL)
 
+void GDScriptByteCodeGenerator::_track_operator(int p_position, const Address &p_target, Variant::Type p_result_type) {
+	if (p_target.mode != Address::TEMPORARY) {
+		last_operator = LastOperator();
+		return;
+	}
+	last_operator.position = p_position;
+	last_operator.end = opcodes.size();
+	last_operator.temporary = p_target.address;
+	last_operator.result_type = p_result_type;
+}
+
+bool GDScriptByteCodeGenerator::_forward_operator_result(const Address &p_target, const Address &p_source) {
+	if (!optimizations_enabled || last_operator.end != opcodes.size() || p_source.mode != Address::TEMPORARY || int(p_source.address) != last_operator.temporary) {
+		return false;
+	}
+
+	// Validated operators don't change the type of their result, so the target must already hold
+	// a value of the result type. Containers are left alone since typed ones need the checked assignment.
+	if (!HAS_BUILTIN_TYPE(p_target) || p_target.type.builtin_type != last_operator.result_type || p_target.type.builtin_type == Variant::ARRAY || p_target.type.builtin_type == Variant::DICTIONARY) {
+		return false;
+	}
+	switch (p_target.mode) {
+		case Address::LOCAL_VARIABLE:
+			if (!initialized_locals.has(p_target.address)) {
+				return false;
+			}
+			break;
+		case Address::FUNCTION_PARAMETER:
+			break;
+		default:
+			return false;
+	}
+
+	// Write the result straight into the target instead of copying it from the temporary.
+	const int operand = last_operator.position + 3;
+	temporaries.write[p_source.address].bytecode_indices.erase(operand);
+	opcodes.write[operand] = address_of(p_target);
+	last_operator = LastOperator();
+	return true;
+}
+
+bool GDScriptByteCodeGenerator::_fuse_operator_jump(const Address &p_condition) {
+	if (!optimizations_enabled || last_operator.end != opcodes.size() || p_condition.mode != Address::TEMPORARY || int(p_condition.address) != last_operator.temporary || last_operator.result_type != Variant::BOOL) {
+		return false;
+	}
+
+	// Same operands as `OPCODE_OPERATOR_VALIDATED`, the jump destination is appended by the caller.
+	opcodes.write[last_operator.position] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+	last_operator = LastOperator();
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_type_adjust(const Address &p_target, Variant::Type p_new_type) {
 	switch (p_new_type) {
 		case Variant::BOOL:
@@ -559,6 +618,7 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, Variant::NIL);
 
+		const int position = opcodes.size();
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(Address());
@@ -567,6 +627,7 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
+		_track_operator(position, p_target, Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, Variant::NIL));
 		return;
 	}
 
@@ -587,8 +648,8 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
 	// Avoid validated evaluator for modulo and division when operands are int, since there's no check for division by zero.
 	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand) && ((p_operator != Variant::OP_DIVIDE && p_operator != Variant::OP_MODULE) || p_left_operand.type.builtin_type != Variant::INT || p_right_operand.type.builtin_type != Variant::INT)) {
+		Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 		if (p_target.mode == Address::TEMPORARY) {
-			Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 			Variant::Type temp_type = temporaries[p_target.address].type;
 			if (result_type != temp_type) {
 				write_type_adjust(p_target, result_type);
@@ -598,6 +659,7 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		const int position = opcodes.size();
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -606,6 +668,7 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
+		_track_operator(position, p_target, result_type);
 		return;
 	}
 
@@ -773,7 +836,16 @@ void GDScriptByteCodeGenerator::write_end_ternary() {
 
 void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address &p_index, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_target)) {
-		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_setter(p_target.type.builtin_type) &&
+		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && GDScriptPackedArray::is_supported(p_target.type.builtin_type) &&
+				IS_BUILTIN_TYPE(p_source, Variant::get_indexed_element_type(p_target.type.builtin_type))) {
+			// Access the packed array directly.
+			append_opcode(GDScriptFunction::OPCODE_SET_INDEXED_PACKED);
+			append(p_target);
+			append(p_index);
+			append(p_source);
+			append(p_target.type.builtin_type);
+			return;
+		} else if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_setter(p_target.type.builtin_type) &&
 				IS_BUILTIN_TYPE(p_source, Variant::get_indexed_element_type(p_target.type.builtin_type))) {
 			// Use indexed setter instead.
 			Variant::ValidatedIndexedSetter setter = Variant::get_member_validated_indexed_setter(p_target.type.builtin_type);
@@ -802,7 +874,15 @@ void GDScriptByteCodeGenerator::write_set(const Address &p_target, const Address
 
 void GDScriptByteCodeGenerator::write_get(const Address &p_target, const Address &p_index, const Address &p_source) {
 	if (HAS_BUILTIN_TYPE(p_source)) {
-		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
+		if (IS_BUILTIN_TYPE(p_index, Variant::INT) && GDScriptPackedArray::is_supported(p_source.type.builtin_type)) {
+			// Access the packed array directly.
+			append_opcode(GDScriptFunction::OPCODE_GET_INDEXED_PACKED);
+			append(p_source);
+			append(p_index);
+			append(p_target);
+			append(p_source.type.builtin_type);
+			return;
+		} else if (IS_BUILTIN_TYPE(p_index, Variant::INT) && Variant::get_member_validated_indexed_getter(p_source.type.builtin_type)) {
 			// Use indexed getter instead.
 			Variant::ValidatedIndexedGetter getter = Variant::get_member_validated_indexed_getter(p_source.type.builtin_type);
 			append_opcode(GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED);
@@ -844,6 +924,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -862,6 +943,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -891,6 +973,10 @@ void GDScriptByteCodeGenerator::write_get_static_variable(const Address &p_targe
 }
 
 void GDScriptByteCodeGenerator::write_assign_with_conversion(const Address &p_target, const Address &p_source) {
+	if (p_target.mode == Address::LOCAL_VARIABLE) {
+		initialized_locals.insert(p_target.address);
+	}
+
 	switch (p_target.type.kind) {
 		case GDScriptDataType::BUILTIN: {
 			if (p_target.type.builtin_type == Variant::ARRAY && p_target.type.has_container_element_type(0)) {
@@ -951,6 +1037,13 @@ void GDScriptByteCodeGenerator::write_assign_with_conversion(const Address &p_ta
 }
 
 void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Address &p_source) {
+	if (_forward_operator_result(p_target, p_source)) {
+		return;
+	}
+	if (p_target.mode == Address::LOCAL_VARIABLE) {
+		initialized_locals.insert(p_target.address);
+	}
+
 	if (p_target.type.kind == GDScriptDataType::BUILTIN && p_target.type.builtin_type == Variant::ARRAY && p_target.type.has_container_element_type(0)) {
 		const GDScriptDataType &element_type = p_target.type.get_container_element_type(0);
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN_TYPED_ARRAY);
@@ -1000,6 +1093,8 @@ void GDScriptByteCodeGenerator::write_assign_false(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_dst, const Address &p_src, bool p_use_conversion) {
+	// Parameters without an argument aren't typed yet.
+	last_operator = LastOperator();
 	if (p_use_conversion) {
 		write_assign_with_conversion(p_dst, p_src);
 	} else {
@@ -1076,6 +1171,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1101,6 +1197,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1335,6 +1432,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1348,6 +1446,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1361,6 +1460,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1495,8 +1595,10 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!_fuse_operator_jump(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1702,12 +1804,15 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	last_operator = LastOperator();
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!_fuse_operator_jump(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -1908,6 +2013,9 @@ void GDScriptByteCodeGenerator::clear_address(const Address &p_address) {
 
 	if (p_address.mode == Address::LOCAL_VARIABLE) {
 		dirty_locals.erase(p_address.address);
+		if (p_address.type.has_type && p_address.type.kind == GDScriptDataType::BUILTIN) {
+			initialized_locals.insert(p_address.address);
+		}
 	}
 }
 
@@ -98,6 +98,22 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int max_locals = 0;
 	int current_line = 0;
 	int instr_args_max = 0;
+	int inline_cache_count = 0;
+
+	bool optimizations_enabled = true;
+
+	// The last validated operator written into a temporary. When it's immediately followed by an
+	// assignment or a conditional jump on that temporary, the operator can write to the final
+	// destination or be fused with the jump. Reset whenever a jump may land in between.
+	struct LastOperator {
+		int position = -1;
+		int end = -1;
+		int temporary = -1;
+		Variant::Type result_type = Variant::NIL;
+	} last_operator;
+
+	// Locals that already hold a value of their type (their declaration was written).
+	HashSet<int> initialized_locals;
 
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
@@ -196,6 +212,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 #endif
 		for (int i = current_locals; i < locals.size(); i++) {
 			dirty_locals.insert(i + GDScriptFunction::FIXED_ADDRESSES_MAX);
+			initialized_locals.erase(i + GDScriptFunction::FIXED_ADDRESSES_MAX);
 		}
 		locals.resize(current_locals);
 		if (debug_stack) {
@@ -395,6 +412,10 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(get_name_map_pos(p_name));
 	}
 
+	void append_inline_cache() {
+		opcodes.push_back(inline_cache_count++);
+	}
+
 	void append(const Variant::ValidatedOperatorEvaluator p_operation) {
 		opcodes.push_back(get_operation_pos(p_operation));
 	}
@@ -449,9 +470,17 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		last_operator = LastOperator();
 	}
 
+	void _track_operator(int p_position, const Address &p_target, Variant::Type p_result_type);
+	bool _forward_operator_result(const Address &p_target, const Address &p_source);
+	bool _fuse_operator_jump(const Address &p_condition);
+
 public:
+	// Enables the peephole optimizations done while writing the bytecode.
+	void set_optimizations_enabled(bool p_enabled) { optimizations_enabled = p_enabled; }
+
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local_constant(const StringName &p_name, const Variant &p_constant) override;
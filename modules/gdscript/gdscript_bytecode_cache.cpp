@@ -0,0 +1,1432 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript.h"
+#include "gdscript_cache.h"
+#include "gdscript_tokenizer_buffer.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/debugger/engine_debugger.h"
+#include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
+#include "core/version.h"
+
+GDScriptBytecodeCache *GDScriptBytecodeCache::singleton = nullptr;
+
+// Objects referenced by constants and data types are stored by how they can be found again.
+enum ObjectSymbol {
+	OBJECT_SYMBOL_GLOBAL, // Native class or engine singleton from the global map.
+	OBJECT_SYMBOL_GDSCRIPT, // GDScript class, by fully qualified name.
+	OBJECT_SYMBOL_RESOURCE, // Any other resource saved to its own file.
+};
+
+static _FORCE_INLINE_ bool _is_valid_type(int p_type) {
+	return p_type >= 0 && p_type < Variant::VARIANT_MAX;
+}
+
+static Array _make_symbol(const Variant &p_first, const Variant &p_second) {
+	Array symbol;
+	symbol.push_back(p_first);
+	symbol.push_back(p_second);
+	return symbol;
+}
+
+// Whether the value survives `encode_variant()` without objects and decodes to an equal value.
+static bool _is_plain_variant(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::OBJECT:
+		case Variant::RID:
+		case Variant::CALLABLE:
+		case Variant::SIGNAL: {
+			return false;
+		}
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			if (array.get_typed_script().get_type() != Variant::NIL) {
+				return false;
+			}
+			for (const Variant &E : array) {
+				if (!_is_plain_variant(E)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::DICTIONARY: {
+			const Dictionary dictionary = p_value;
+			if (dictionary.get_typed_key_script().get_type() != Variant::NIL || dictionary.get_typed_value_script().get_type() != Variant::NIL) {
+				return false;
+			}
+			return _is_plain_variant(dictionary.keys()) && _is_plain_variant(dictionary.values());
+		}
+		default: {
+			return true;
+		}
+	}
+}
+
+static bool _encode_object(Object *p_object, Array &r_symbol) {
+	if (p_object == nullptr) {
+		return false;
+	}
+
+	GDScript *script = Object::cast_to<GDScript>(p_object);
+	if (script) {
+		if (!script->get_root_script()->get_script_path().is_resource_file()) {
+			return false; // Built-in scripts can't be found by path.
+		}
+		r_symbol = _make_symbol(OBJECT_SYMBOL_GDSCRIPT, script->get_fully_qualified_name());
+		return true;
+	}
+
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+	for (const KeyValue<StringName, int> &E : language->get_global_map()) {
+		if (language->get_global_array()[E.value].get_validated_object() == p_object) {
+			r_symbol = _make_symbol(OBJECT_SYMBOL_GLOBAL, E.key);
+			return true;
+		}
+	}
+
+	Resource *resource = Object::cast_to<Resource>(p_object);
+	if (resource && resource->get_path().is_resource_file()) {
+		r_symbol = _make_symbol(OBJECT_SYMBOL_RESOURCE, resource->get_path());
+		return true;
+	}
+
+	return false;
+}
+
+static Ref<GDScript> _resolve_gdscript(const String &p_fqcn, GDScript *p_main_script) {
+	const String path = p_fqcn.get_slice("::", 0);
+	if (path == p_main_script->get_script_path()) {
+		return Ref<GDScript>(p_main_script->find_class(p_fqcn));
+	}
+
+	Error err = OK;
+	Ref<GDScript> script = GDScriptCache::get_shallow_script(path, err, p_main_script->get_script_path());
+	if (err || script.is_null()) {
+		return Ref<GDScript>();
+	}
+	return Ref<GDScript>(script->find_class(p_fqcn));
+}
+
+static bool _decode_object(const Array &p_symbol, GDScript *p_main_script, Variant &r_object) {
+	ERR_FAIL_COND_V(p_symbol.size() != 2, false);
+
+	const String name = p_symbol[1];
+	switch (int(p_symbol[0])) {
+		case OBJECT_SYMBOL_GLOBAL: {
+			GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+			HashMap<StringName, int>::ConstIterator E = language->get_global_map().find(name);
+			if (!E) {
+				return false;
+			}
+			r_object = language->get_global_array()[E->value];
+		} break;
+		case OBJECT_SYMBOL_GDSCRIPT: {
+			r_object = _resolve_gdscript(name, p_main_script);
+		} break;
+		case OBJECT_SYMBOL_RESOURCE: {
+			r_object = ResourceLoader::load(name);
+		} break;
+		default: {
+			return false;
+		}
+	}
+
+	return r_object.get_validated_object() != nullptr;
+}
+
+static bool _encode_data_type(const GDScriptDataType &p_type, Dictionary &r_data) {
+	r_data["has_type"] = p_type.has_type;
+	r_data["kind"] = p_type.kind;
+	r_data["builtin_type"] = p_type.builtin_type;
+	r_data["native_type"] = p_type.native_type;
+
+	if (p_type.script_type) {
+		Array symbol;
+		if (!_encode_object(p_type.script_type, symbol)) {
+			return false;
+		}
+		r_data["script_type"] = symbol;
+		r_data["script_type_ref"] = p_type.script_type_ref.is_valid();
+	}
+
+	if (p_type.has_container_element_types()) {
+		Array element_types;
+		for (const GDScriptDataType &E : p_type.container_element_types) {
+			Dictionary element_type;
+			if (!_encode_data_type(E, element_type)) {
+				return false;
+			}
+			element_types.push_back(element_type);
+		}
+		r_data["element_types"] = element_types;
+	}
+
+	return true;
+}
+
+static bool _decode_data_type(const Dictionary &p_data, GDScript *p_main_script, GDScriptDataType &r_type) {
+	const int kind = p_data.get("kind", GDScriptDataType::UNINITIALIZED);
+	const int builtin_type = p_data.get("builtin_type", Variant::NIL);
+	ERR_FAIL_COND_V(kind < GDScriptDataType::UNINITIALIZED || kind > GDScriptDataType::GDSCRIPT || !_is_valid_type(builtin_type), false);
+
+	r_type.has_type = p_data.get("has_type", false);
+	r_type.kind = GDScriptDataType::Kind(kind);
+	r_type.builtin_type = Variant::Type(builtin_type);
+	r_type.native_type = p_data.get("native_type", StringName());
+
+	if (p_data.has("script_type")) {
+		Variant script;
+		if (!_decode_object(p_data["script_type"], p_main_script, script)) {
+			return false;
+		}
+		Ref<Script> script_type = script;
+		if (script_type.is_null()) {
+			return false;
+		}
+		// Same ownership as the compiler: no strong reference to classes of the script itself.
+		if (p_data.get("script_type_ref", false)) {
+			r_type.script_type_ref = script_type;
+		}
+		r_type.script_type = script_type.ptr();
+	}
+
+	const Array element_types = p_data.get("element_types", Array());
+	for (int i = 0; i < element_types.size(); i++) {
+		GDScriptDataType element_type;
+		if (!_decode_data_type(element_types[i], p_main_script, element_type)) {
+			return false;
+		}
+		r_type.set_container_element_type(i, element_type);
+	}
+
+	return true;
+}
+
+template <typename T>
+static bool _encode_symbols(const Vector<T> &p_table, const RBMap<T, Variant> &p_symbols, Array &r_symbols) {
+	for (const T &E : p_table) {
+		const typename RBMap<T, Variant>::Element *symbol = p_symbols.find(E);
+		if (!symbol) {
+			return false;
+		}
+		r_symbols.push_back(symbol->value());
+	}
+	return true;
+}
+
+void GDScriptBytecodeCache::_build_symbols() {
+	if (symbols_built) {
+		return;
+	}
+	symbols_built = true;
+
+	for (int i = 0; i < Variant::VARIANT_MAX; i++) {
+		const Variant::Type type = Variant::Type(i);
+
+		for (int op = 0; op < Variant::OP_MAX; op++) {
+			for (int j = 0; j < Variant::VARIANT_MAX; j++) {
+				Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::Operator(op), type, Variant::Type(j));
+				if (evaluator && !operator_symbols.has(evaluator)) {
+					operator_symbols.insert(evaluator, Vector3i(op, i, j));
+				}
+			}
+		}
+
+		List<StringName> members;
+		Variant::get_member_list(type, &members);
+		for (const StringName &E : members) {
+			setter_symbols.insert(Variant::get_member_validated_setter(type, E), _make_symbol(i, E));
+			getter_symbols.insert(Variant::get_member_validated_getter(type, E), _make_symbol(i, E));
+		}
+
+		if (Variant::ValidatedKeyedSetter keyed_setter = Variant::get_member_validated_keyed_setter(type)) {
+			keyed_setter_symbols.insert(keyed_setter, i);
+		}
+		if (Variant::ValidatedKeyedGetter keyed_getter = Variant::get_member_validated_keyed_getter(type)) {
+			keyed_getter_symbols.insert(keyed_getter, i);
+		}
+		if (Variant::ValidatedIndexedSetter indexed_setter = Variant::get_member_validated_indexed_setter(type)) {
+			indexed_setter_symbols.insert(indexed_setter, i);
+		}
+		if (Variant::ValidatedIndexedGetter indexed_getter = Variant::get_member_validated_indexed_getter(type)) {
+			indexed_getter_symbols.insert(indexed_getter, i);
+		}
+
+		List<StringName> methods;
+		Variant::get_builtin_method_list(type, &methods);
+		for (const StringName &E : methods) {
+			builtin_method_symbols.insert(Variant::get_validated_builtin_method(type, E), _make_symbol(i, E));
+		}
+
+		for (int j = 0; j < Variant::get_constructor_count(type); j++) {
+			constructor_symbols.insert(Variant::get_validated_constructor(type, j), Vector2i(i, j));
+		}
+	}
+
+	List<StringName> utilities;
+	Variant::get_utility_function_list(&utilities);
+	for (const StringName &E : utilities) {
+		utility_symbols.insert(Variant::get_validated_utility_function(E), E);
+	}
+
+	List<StringName> gds_utilities;
+	GDScriptUtilityFunctions::get_function_list(&gds_utilities);
+	for (const StringName &E : gds_utilities) {
+		gds_utility_symbols.insert(GDScriptUtilityFunctions::get_function(E), E);
+	}
+}
+
+bool GDScriptBytecodeCache::_serialize_function(const GDScriptFunction *p_function, Dictionary &r_data) {
+	const Dictionary method_info = p_function->method_info;
+	if (!_is_plain_variant(method_info) || !_is_plain_variant(p_function->rpc_config)) {
+		return false;
+	}
+
+	r_data["name"] = p_function->name;
+	r_data["static"] = p_function->_static;
+	r_data["initial_line"] = p_function->_initial_line;
+	r_data["argument_count"] = p_function->_argument_count;
+	r_data["stack_size"] = p_function->_stack_size;
+	r_data["instruction_args_size"] = p_function->_instruction_args_size;
+	r_data["inline_cache_count"] = p_function->_inline_caches_count;
+	r_data["method_info"] = method_info;
+	r_data["rpc_config"] = p_function->rpc_config;
+	r_data["code"] = p_function->code;
+	r_data["default_arguments"] = p_function->default_arguments;
+
+	Dictionary return_type;
+	if (!_encode_data_type(p_function->return_type, return_type)) {
+		return false;
+	}
+	r_data["return_type"] = return_type;
+
+	Array argument_types;
+	for (const GDScriptDataType &E : p_function->argument_types) {
+		Dictionary argument_type;
+		if (!_encode_data_type(E, argument_type)) {
+			return false;
+		}
+		argument_types.push_back(argument_type);
+	}
+	r_data["argument_types"] = argument_types;
+
+	Array constants;
+	Dictionary object_constants;
+	for (int i = 0; i < p_function->constants.size(); i++) {
+		const Variant &constant = p_function->constants[i];
+		if (constant.get_type() == Variant::OBJECT) {
+			Array symbol;
+			if (!_encode_object(constant.get_validated_object(), symbol)) {
+				return false;
+			}
+			object_constants[i] = symbol;
+			constants.push_back(Variant());
+		} else if (_is_plain_variant(constant)) {
+			constants.push_back(constant);
+		} else {
+			return false;
+		}
+	}
+	r_data["constants"] = constants;
+	r_data["object_constants"] = object_constants;
+
+	Array global_names;
+	for (const StringName &E : p_function->global_names) {
+		global_names.push_back(E);
+	}
+	r_data["global_names"] = global_names;
+
+	Array operators, setters, getters, keyed_setters, keyed_getters, indexed_setters, indexed_getters;
+	Array builtin_methods, constructors, utilities, gds_utilities;
+	if (!_encode_symbols(p_function->operator_funcs, operator_symbols, operators) ||
+			!_encode_symbols(p_function->setters, setter_symbols, setters) ||
+			!_encode_symbols(p_function->getters, getter_symbols, getters) ||
+			!_encode_symbols(p_function->keyed_setters, keyed_setter_symbols, keyed_setters) ||
+			!_encode_symbols(p_function->keyed_getters, keyed_getter_symbols, keyed_getters) ||
+			!_encode_symbols(p_function->indexed_setters, indexed_setter_symbols, indexed_setters) ||
+			!_encode_symbols(p_function->indexed_getters, indexed_getter_symbols, indexed_getters) ||
+			!_encode_symbols(p_function->builtin_methods, builtin_method_symbols, builtin_methods) ||
+			!_encode_symbols(p_function->constructors, constructor_symbols, constructors) ||
+			!_encode_symbols(p_function->utilities, utility_symbols, utilities) ||
+			!_encode_symbols(p_function->gds_utilities, gds_utility_symbols, gds_utilities)) {
+		return false;
+	}
+	r_data["operators"] = operators;
+	r_data["setters"] = setters;
+	r_data["getters"] = getters;
+	r_data["keyed_setters"] = keyed_setters;
+	r_data["keyed_getters"] = keyed_getters;
+	r_data["indexed_setters"] = indexed_setters;
+	r_data["indexed_getters"] = indexed_getters;
+	r_data["builtin_methods"] = builtin_methods;
+	r_data["constructors"] = constructors;
+	r_data["utilities"] = utilities;
+	r_data["gds_utilities"] = gds_utilities;
+
+	Array methods;
+	for (MethodBind *method : p_function->methods) {
+		if (ClassDB::get_method(method->get_instance_class(), method->get_name()) != method) {
+			return false;
+		}
+		methods.push_back(_make_symbol(method->get_instance_class(), method->get_name()));
+	}
+	r_data["methods"] = methods;
+
+	Array lambdas;
+	for (const GDScriptFunction *lambda : p_function->lambdas) {
+		Dictionary lambda_data;
+		if (!_serialize_function(lambda, lambda_data)) {
+			return false;
+		}
+		const GDScript::LambdaInfo *info = lambda->_script->lambda_info.getptr(const_cast<GDScriptFunction *>(lambda));
+		lambda_data["capture_count"] = info ? info->capture_count : 0;
+		lambda_data["use_self"] = info ? info->use_self : false;
+		lambdas.push_back(lambda_data);
+	}
+	r_data["lambdas"] = lambdas;
+
+	Dictionary temporary_slots;
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		temporary_slots[E.key] = E.value;
+	}
+	r_data["temporary_slots"] = temporary_slots;
+
+	Array stack_debug;
+	for (const GDScriptFunction::StackDebug &E : p_function->stack_debug) {
+		Array entry;
+		entry.push_back(E.line);
+		entry.push_back(E.pos);
+		entry.push_back(E.added);
+		entry.push_back(E.identifier);
+		stack_debug.push_back(entry);
+	}
+	r_data["stack_debug"] = stack_debug;
+
+#ifdef DEBUG_ENABLED
+	Array debug_names;
+	debug_names.push_back(PackedStringArray(p_function->operator_names));
+	debug_names.push_back(PackedStringArray(p_function->setter_names));
+	debug_names.push_back(PackedStringArray(p_function->getter_names));
+	debug_names.push_back(PackedStringArray(p_function->builtin_methods_names));
+	debug_names.push_back(PackedStringArray(p_function->constructors_names));
+	debug_names.push_back(PackedStringArray(p_function->utilities_names));
+	debug_names.push_back(PackedStringArray(p_function->gds_utilities_names));
+	r_data["debug_names"] = debug_names;
+	r_data["signature"] = p_function->profile.signature;
+#endif
+
+	return true;
+}
+
+bool GDScriptBytecodeCache::_serialize_class(GDScript *p_script, Dictionary &r_classes) {
+	bool complete = true;
+	Dictionary functions;
+
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		Dictionary data;
+		if (_serialize_function(E.value, data)) {
+			functions[String(E.key)] = data;
+		} else {
+			complete = false;
+		}
+	}
+
+	// Implicit functions use names that can't be declared in scripts, so they don't clash with `_ready()`.
+	const GDScriptFunction *implicit_functions[] = { p_script->implicit_initializer, p_script->implicit_ready, p_script->static_initializer };
+	const char *implicit_names[] = { "@implicit_new", "@implicit_ready", "@static_initializer" };
+	for (int i = 0; i < 3; i++) {
+		if (!implicit_functions[i]) {
+			continue;
+		}
+		Dictionary data;
+		if (_serialize_function(implicit_functions[i], data)) {
+			functions[implicit_names[i]] = data;
+		} else {
+			complete = false;
+		}
+	}
+
+	r_classes[p_script->fully_qualified_name] = functions;
+
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		complete = _serialize_class(E.value.ptr(), r_classes) && complete;
+	}
+
+	return complete;
+}
+
+bool GDScriptBytecodeCache::_restore_function(const Dictionary &p_data, GDScriptFunction *p_function, GDScript *p_main_script, LocalVector<Pair<GDScriptFunction *, Vector2i>> &r_lambdas) {
+	p_function->_static = p_data.get("static", false);
+	p_function->_initial_line = p_data.get("initial_line", 0);
+	p_function->_argument_count = p_data.get("argument_count", 0);
+	p_function->_stack_size = p_data.get("stack_size", 0);
+	p_function->_instruction_args_size = p_data.get("instruction_args_size", 0);
+	p_function->_inline_caches_count = p_data.get("inline_cache_count", 0);
+	if (p_function->_inline_caches_count > 0) {
+		p_function->_inline_caches_ptr = memnew_arr(GDScriptFunction::InlineCache, p_function->_inline_caches_count);
+	}
+	p_function->method_info = MethodInfo::from_dict(p_data.get("method_info", Dictionary()));
+	p_function->rpc_config = p_data.get("rpc_config", Variant());
+	p_function->code = p_data.get("code", PackedInt32Array());
+	p_function->default_arguments = p_data.get("default_arguments", PackedInt32Array());
+
+	if (!_decode_data_type(p_data.get("return_type", Dictionary()), p_main_script, p_function->return_type)) {
+		return false;
+	}
+
+	const Array argument_types = p_data.get("argument_types", Array());
+	for (const Variant &E : argument_types) {
+		GDScriptDataType argument_type;
+		if (!_decode_data_type(E, p_main_script, argument_type)) {
+			return false;
+		}
+		p_function->argument_types.push_back(argument_type);
+	}
+
+	const Array constants = p_data.get("constants", Array());
+	const Dictionary object_constants = p_data.get("object_constants", Dictionary());
+	p_function->constants.resize(constants.size());
+	for (int i = 0; i < constants.size(); i++) {
+		if (object_constants.has(i)) {
+			if (!_decode_object(object_constants[i], p_main_script, p_function->constants.write[i])) {
+				return false;
+			}
+		} else {
+			p_function->constants.write[i] = constants[i];
+		}
+	}
+
+	const Array global_names = p_data.get("global_names", Array());
+	for (const Variant &E : global_names) {
+		p_function->global_names.push_back(E);
+	}
+
+	const Array operators = p_data.get("operators", Array());
+	for (const Variant &E : operators) {
+		const Vector3i symbol = E;
+		ERR_FAIL_COND_V(symbol.x < 0 || symbol.x >= Variant::OP_MAX || !_is_valid_type(symbol.y) || !_is_valid_type(symbol.z), false);
+		Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::Operator(symbol.x), Variant::Type(symbol.y), Variant::Type(symbol.z));
+		if (!evaluator) {
+			return false;
+		}
+		p_function->operator_funcs.push_back(evaluator);
+	}
+
+	const Array setters = p_data.get("setters", Array());
+	for (const Variant &E : setters) {
+		const Array symbol = E;
+		ERR_FAIL_COND_V(symbol.size() != 2 || !_is_valid_type(symbol[0]), false);
+		Variant::ValidatedSetter setter = Variant::get_member_validated_setter(Variant::Type(int(symbol[0])), symbol[1]);
+		if (!setter) {
+			return false;
+		}
+		p_function->setters.push_back(setter);
+	}
+
+	const Array getters = p_data.get("getters", Array());
+	for (const Variant &E : getters) {
+		const Array symbol = E;
+		ERR_FAIL_COND_V(symbol.size() != 2 || !_is_valid_type(symbol[0]), false);
+		Variant::ValidatedGetter getter = Variant::get_member_validated_getter(Variant::Type(int(symbol[0])), symbol[1]);
+		if (!getter) {
+			return false;
+		}
+		p_function->getters.push_back(getter);
+	}
+
+	const Array keyed_setters = p_data.get("keyed_setters", Array());
+	for (const Variant &E : keyed_setters) {
+		ERR_FAIL_COND_V(!_is_valid_type(E), false);
+		Variant::ValidatedKeyedSetter keyed_setter = Variant::get_member_validated_keyed_setter(Variant::Type(int(E)));
+		if (!keyed_setter) {
+			return false;
+		}
+		p_function->keyed_setters.push_back(keyed_setter);
+	}
+
+	const Array keyed_getters = p_data.get("keyed_getters", Array());
+	for (const Variant &E : keyed_getters) {
+		ERR_FAIL_COND_V(!_is_valid_type(E), false);
+		Variant::ValidatedKeyedGetter keyed_getter = Variant::get_member_validated_keyed_getter(Variant::Type(int(E)));
+		if (!keyed_getter) {
+			return false;
+		}
+		p_function->keyed_getters.push_back(keyed_getter);
+	}
+
+	const Array indexed_setters = p_data.get("indexed_setters", Array());
+	for (const Variant &E : indexed_setters) {
+		ERR_FAIL_COND_V(!_is_valid_type(E), false);
+		Variant::ValidatedIndexedSetter indexed_setter = Variant::get_member_validated_indexed_setter(Variant::Type(int(E)));
+		if (!indexed_setter) {
+			return false;
+		}
+		p_function->indexed_setters.push_back(indexed_setter);
+	}
+
+	const Array indexed_getters = p_data.get("indexed_getters", Array());
+	for (const Variant &E : indexed_getters) {
+		ERR_FAIL_COND_V(!_is_valid_type(E), false);
+		Variant::ValidatedIndexedGetter indexed_getter = Variant::get_member_validated_indexed_getter(Variant::Type(int(E)));
+		if (!indexed_getter) {
+			return false;
+		}
+		p_function->indexed_getters.push_back(indexed_getter);
+	}
+
+	const Array builtin_methods = p_data.get("builtin_methods", Array());
+	for (const Variant &E : builtin_methods) {
+		const Array symbol = E;
+		ERR_FAIL_COND_V(symbol.size() != 2 || !_is_valid_type(symbol[0]), false);
+		Variant::ValidatedBuiltInMethod method = Variant::get_validated_builtin_method(Variant::Type(int(symbol[0])), symbol[1]);
+		if (!method) {
+			return false;
+		}
+		p_function->builtin_methods.push_back(method);
+	}
+
+	const Array constructors = p_data.get("constructors", Array());
+	for (const Variant &E : constructors) {
+		const Vector2i symbol = E;
+		ERR_FAIL_COND_V(!_is_valid_type(symbol.x), false);
+		if (symbol.y < 0 || symbol.y >= Variant::get_constructor_count(Variant::Type(symbol.x))) {
+			return false;
+		}
+		p_function->constructors.push_back(Variant::get_validated_constructor(Variant::Type(symbol.x), symbol.y));
+	}
+
+	const Array utilities = p_data.get("utilities", Array());
+	for (const Variant &E : utilities) {
+		Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(E);
+		if (!utility) {
+			return false;
+		}
+		p_function->utilities.push_back(utility);
+	}
+
+	const Array gds_utilities = p_data.get("gds_utilities", Array());
+	for (const Variant &E : gds_utilities) {
+		GDScriptUtilityFunctions::FunctionPtr gds_utility = GDScriptUtilityFunctions::get_function(E);
+		if (!gds_utility) {
+			return false;
+		}
+		p_function->gds_utilities.push_back(gds_utility);
+	}
+
+	const Array methods = p_data.get("methods", Array());
+	for (const Variant &E : methods) {
+		const Array symbol = E;
+		ERR_FAIL_COND_V(symbol.size() != 2, false);
+		MethodBind *method = ClassDB::get_method(symbol[0], symbol[1]);
+		if (!method) {
+			return false;
+		}
+		p_function->methods.push_back(method);
+	}
+
+	const Array lambdas = p_data.get("lambdas", Array());
+	for (const Variant &E : lambdas) {
+		const Dictionary lambda_data = E;
+		GDScriptFunction *lambda = memnew(GDScriptFunction);
+		lambda->_script = p_function->_script;
+		lambda->source = p_function->source;
+		// Owned by the function from now on, so it is freed along with it on failure.
+		p_function->lambdas.push_back(lambda);
+		if (!_restore_function(lambda_data, lambda, p_main_script, r_lambdas)) {
+			return false;
+		}
+		r_lambdas.push_back(Pair<GDScriptFunction *, Vector2i>(lambda, Vector2i(lambda_data.get("capture_count", 0), lambda_data.get("use_self", false))));
+	}
+
+	const Dictionary temporary_slots = p_data.get("temporary_slots", Dictionary());
+	for (const Variant &E : temporary_slots.keys()) {
+		const int type = temporary_slots[E];
+		ERR_FAIL_COND_V(!_is_valid_type(type), false);
+		p_function->temporary_slots[int(E)] = Variant::Type(type);
+	}
+
+	const Array stack_debug = p_data.get("stack_debug", Array());
+	for (const Variant &E : stack_debug) {
+		const Array entry = E;
+		ERR_FAIL_COND_V(entry.size() != 4, false);
+		GDScriptFunction::StackDebug sd;
+		sd.line = entry[0];
+		sd.pos = entry[1];
+		sd.added = entry[2];
+		sd.identifier = entry[3];
+		p_function->stack_debug.push_back(sd);
+	}
+
+	// Same layout as `GDScriptByteCodeGenerator::write_end()`.
+	p_function->_code_size = p_function->code.size();
+	p_function->_code_ptr = p_function->code.is_empty() ? nullptr : p_function->code.ptrw();
+	p_function->_default_arg_count = p_function->default_arguments.is_empty() ? 0 : p_function->default_arguments.size() - 1;
+	p_function->_default_arg_ptr = p_function->default_arguments.is_empty() ? nullptr : p_function->default_arguments.ptr();
+	p_function->_constant_count = p_function->constants.size();
+	p_function->_constants_ptr = p_function->constants.is_empty() ? nullptr : p_function->constants.ptrw();
+	p_function->_global_names_count = p_function->global_names.size();
+	p_function->_global_names_ptr = p_function->global_names.is_empty() ? nullptr : p_function->global_names.ptr();
+	p_function->_operator_funcs_count = p_function->operator_funcs.size();
+	p_function->_operator_funcs_ptr = p_function->operator_funcs.is_empty() ? nullptr : p_function->operator_funcs.ptr();
+	p_function->_setters_count = p_function->setters.size();
+	p_function->_setters_ptr = p_function->setters.is_empty() ? nullptr : p_function->setters.ptr();
+	p_function->_getters_count = p_function->getters.size();
+	p_function->_getters_ptr = p_function->getters.is_empty() ? nullptr : p_function->getters.ptr();
+	p_function->_keyed_setters_count = p_function->keyed_setters.size();
+	p_function->_keyed_setters_ptr = p_function->keyed_setters.is_empty() ? nullptr : p_function->keyed_setters.ptr();
+	p_function->_keyed_getters_count = p_function->keyed_getters.size();
+	p_function->_keyed_getters_ptr = p_function->keyed_getters.is_empty() ? nullptr : p_function->keyed_getters.ptr();
+	p_function->_indexed_setters_count = p_function->indexed_setters.size();
+	p_function->_indexed_setters_ptr = p_function->indexed_setters.is_empty() ? nullptr : p_function->indexed_setters.ptr();
+	p_function->_indexed_getters_count = p_function->indexed_getters.size();
+	p_function->_indexed_getters_ptr = p_function->indexed_getters.is_empty() ? nullptr : p_function->indexed_getters.ptr();
+	p_function->_builtin_methods_count = p_function->builtin_methods.size();
+	p_function->_builtin_methods_ptr = p_function->builtin_methods.is_empty() ? nullptr : p_function->builtin_methods.ptr();
+	p_function->_constructors_count = p_function->constructors.size();
+	p_function->_constructors_ptr = p_function->constructors.is_empty() ? nullptr : p_function->constructors.ptr();
+	p_function->_utilities_count = p_function->utilities.size();
+	p_function->_utilities_ptr = p_function->utilities.is_empty() ? nullptr : p_function->utilities.ptr();
+	p_function->_gds_utilities_count = p_function->gds_utilities.size();
+	p_function->_gds_utilities_ptr = p_function->gds_utilities.is_empty() ? nullptr : p_function->gds_utilities.ptr();
+	p_function->_methods_count = p_function->methods.size();
+	p_function->_methods_ptr = p_function->methods.is_empty() ? nullptr : p_function->methods.ptrw();
+	p_function->_lambdas_count = p_function->lambdas.size();
+	p_function->_lambdas_ptr = p_function->lambdas.is_empty() ? nullptr : p_function->lambdas.ptrw();
+
+	if (!_verify_code(p_function)) {
+		return false;
+	}
+
+	// Set last: the destructor unregisters the function by name when restoring fails.
+	p_function->name = p_data.get("name", StringName());
+
+#ifdef DEBUG_ENABLED
+	p_function->func_cname = (String(p_function->source) + " - " + String(p_function->name)).utf8();
+	p_function->_func_cname = p_function->func_cname.get_data();
+
+	const Array debug_names = p_data.get("debug_names", Array());
+	ERR_FAIL_COND_V(debug_names.size() != 7, false);
+	p_function->operator_names = PackedStringArray(debug_names[0]);
+	p_function->setter_names = PackedStringArray(debug_names[1]);
+	p_function->getter_names = PackedStringArray(debug_names[2]);
+	p_function->builtin_methods_names = PackedStringArray(debug_names[3]);
+	p_function->constructors_names = PackedStringArray(debug_names[4]);
+	p_function->utilities_names = PackedStringArray(debug_names[5]);
+	p_function->gds_utilities_names = PackedStringArray(debug_names[6]);
+	p_function->profile.signature = p_data.get("signature", StringName());
+#endif
+
+	return true;
+}
+
+bool GDScriptBytecodeCache::_verify_code(GDScriptFunction *p_function) {
+	int *code = p_function->_code_ptr;
+	const int code_size = p_function->_code_size;
+	const int stack_size = p_function->_stack_size;
+	const int member_count = p_function->_script ? p_function->_script->member_indices.size() : 0;
+
+	if (p_function->_argument_count < 0 || p_function->_default_arg_count > p_function->_argument_count || p_function->_instruction_args_size < 0) {
+		return false;
+	}
+	if (stack_size < GDScriptFunction::FIXED_ADDRESSES_MAX + p_function->_argument_count || stack_size > GDScriptFunction::ADDR_MASK) {
+		return false;
+	}
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		if (E.key < 0 || E.key >= stack_size) {
+			return false;
+		}
+	}
+
+	// Instructions are walked in order, and jump targets checked once every instruction start is known.
+	LocalVector<bool> instruction_starts;
+	instruction_starts.resize(code_size);
+	for (int i = 0; i < code_size; i++) {
+		instruction_starts[i] = false;
+	}
+	LocalVector<int> jump_targets;
+	for (int i = 0; i < p_function->default_arguments.size(); i++) {
+		jump_targets.push_back(p_function->default_arguments[i]);
+	}
+
+	int ip = 0;
+	int length = 0;
+	int instruction_args = 0;
+
+	// Operands of the current instruction, by offset from its opcode.
+	const auto fits = [&](int p_length) {
+		length = p_length;
+		return p_length > 0 && ip + p_length <= code_size;
+	};
+	const auto address = [&](int p_offset) {
+		const int operand = code[ip + p_offset];
+		const int index = operand & GDScriptFunction::ADDR_MASK;
+		switch ((operand & GDScriptFunction::ADDR_TYPE_MASK) >> GDScriptFunction::ADDR_BITS) {
+			case GDScriptFunction::ADDR_TYPE_STACK:
+				return index < stack_size;
+			case GDScriptFunction::ADDR_TYPE_CONSTANT:
+				return index < p_function->_constant_count;
+			case GDScriptFunction::ADDR_TYPE_MEMBER:
+				return index < member_count;
+			default:
+				return false;
+		}
+	};
+	const auto addresses = [&](int p_from, int p_count) {
+		for (int i = p_from; i < p_from + p_count; i++) {
+			if (!address(i)) {
+				return false;
+			}
+		}
+		return true;
+	};
+	const auto index = [&](int p_offset, int p_count) {
+		return code[ip + p_offset] >= 0 && code[ip + p_offset] < p_count;
+	};
+	const auto type = [&](int p_offset) {
+		return index(p_offset, Variant::VARIANT_MAX);
+	};
+	const auto name = [&](int p_offset) {
+		return index(p_offset, p_function->_global_names_count);
+	};
+	const auto jump = [&](int p_offset) {
+		jump_targets.push_back(code[ip + p_offset]);
+		return true;
+	};
+
+	// Instructions with a variable number of arguments: the count, the addresses, then `p_trailing` operands.
+	// Returns the offset of the operand before the trailing ones, which are read at `base + 1` and after.
+	const auto variable_args = [&](int p_trailing, int &r_base) {
+		if (!fits(2)) {
+			return false;
+		}
+		instruction_args = code[ip + 1];
+		if (instruction_args < 0 || instruction_args > p_function->_instruction_args_size || !fits(2 + instruction_args + p_trailing)) {
+			return false;
+		}
+		r_base = 1 + instruction_args;
+		return addresses(2, instruction_args);
+	};
+	// Instruction arguments used past the `argc` regular arguments.
+	const auto arg_count = [&](int p_offset, int p_multiplier, int p_extra) {
+		const int argc = code[ip + p_offset];
+		return argc >= 0 && argc <= instruction_args && int64_t(argc) * p_multiplier + p_extra <= instruction_args;
+	};
+
+	while (ip < code_size) {
+		instruction_starts[ip] = true;
+		length = 0;
+		int base = 0;
+		bool valid = false;
+
+		switch (GDScriptFunction::Opcode(code[ip])) {
+			case GDScriptFunction::OPCODE_OPERATOR: {
+				constexpr int pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*code);
+				valid = fits(7 + pointer_size) && addresses(1, 3) && index(4, Variant::OP_MAX);
+				if (valid) {
+					// Signature, return type and evaluator are cached at runtime, from this run only.
+					for (int i = 5; i < 7 + pointer_size; i++) {
+						code[ip + i] = 0;
+					}
+				}
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED: {
+				valid = fits(5) && addresses(1, 3) && index(4, p_function->_operator_funcs_count);
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_BUILTIN:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_BUILTIN:
+			case GDScriptFunction::OPCODE_CAST_TO_BUILTIN: {
+				valid = fits(4) && addresses(1, 2) && type(3);
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_ARRAY:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_ARRAY: {
+				valid = fits(6) && addresses(1, 3) && type(4) && name(5);
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_DICTIONARY:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_DICTIONARY: {
+				valid = fits(9) && addresses(1, 4) && type(5) && name(6) && type(7) && name(8);
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_NATIVE: {
+				valid = fits(4) && addresses(1, 2) && name(3);
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_SCRIPT:
+			case GDScriptFunction::OPCODE_SET_KEYED:
+			case GDScriptFunction::OPCODE_GET_KEYED:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_NATIVE:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_SCRIPT:
+			case GDScriptFunction::OPCODE_CAST_TO_NATIVE:
+			case GDScriptFunction::OPCODE_CAST_TO_SCRIPT: {
+				valid = fits(4) && addresses(1, 3);
+			} break;
+			case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED: {
+				valid = fits(5) && addresses(1, 3) && index(4, p_function->_keyed_setters_count);
+			} break;
+			case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED: {
+				valid = fits(5) && addresses(1, 3) && index(4, p_function->_indexed_setters_count);
+			} break;
+			case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED: {
+				valid = fits(5) && addresses(1, 3) && index(4, p_function->_keyed_getters_count);
+			} break;
+			case GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED: {
+				valid = fits(5) && addresses(1, 3) && index(4, p_function->_indexed_getters_count);
+			} break;
+			case GDScriptFunction::OPCODE_SET_INDEXED_PACKED:
+			case GDScriptFunction::OPCODE_GET_INDEXED_PACKED: {
+				valid = fits(5) && addresses(1, 3) && type(4);
+			} break;
+			case GDScriptFunction::OPCODE_SET_NAMED:
+			case GDScriptFunction::OPCODE_GET_NAMED: {
+				valid = fits(5) && addresses(1, 2) && name(3) && index(4, p_function->_inline_caches_count);
+			} break;
+			case GDScriptFunction::OPCODE_SET_NAMED_VALIDATED: {
+				valid = fits(4) && addresses(1, 2) && index(3, p_function->_setters_count);
+			} break;
+			case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED: {
+				valid = fits(4) && addresses(1, 2) && index(3, p_function->_getters_count);
+			} break;
+			case GDScriptFunction::OPCODE_SET_MEMBER:
+			case GDScriptFunction::OPCODE_GET_MEMBER:
+			case GDScriptFunction::OPCODE_STORE_NAMED_GLOBAL: {
+				valid = fits(3) && address(1) && name(2);
+			} break;
+			case GDScriptFunction::OPCODE_SET_STATIC_VARIABLE:
+			case GDScriptFunction::OPCODE_GET_STATIC_VARIABLE: {
+				// The variable index is checked against the class at runtime.
+				valid = fits(4) && addresses(1, 2);
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN: {
+				valid = fits(3) && addresses(1, 2);
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_NULL:
+			case GDScriptFunction::OPCODE_ASSIGN_TRUE:
+			case GDScriptFunction::OPCODE_ASSIGN_FALSE:
+			case GDScriptFunction::OPCODE_AWAIT_RESUME:
+			case GDScriptFunction::OPCODE_RETURN:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_BOOL:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_INT:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_FLOAT:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_STRING:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR2:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR2I:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_RECT2:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_RECT2I:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR3:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR3I:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_TRANSFORM2D:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR4:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_VECTOR4I:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PLANE:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_QUATERNION:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_AABB:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_BASIS:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_TRANSFORM3D:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PROJECTION:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_COLOR:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_STRING_NAME:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_NODE_PATH:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_RID:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_OBJECT:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_CALLABLE:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_SIGNAL:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_DICTIONARY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_BYTE_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_INT32_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_INT64_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_FLOAT32_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_FLOAT64_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_STRING_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_VECTOR2_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_VECTOR3_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY:
+			case GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY: {
+				valid = fits(2) && address(1);
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 1) && type(base + 2);
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 1) && index(base + 2, p_function->_constructors_count);
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_ARRAY: {
+				valid = variable_args(1, base) && arg_count(base + 1, 1, 1);
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_TYPED_ARRAY: {
+				valid = variable_args(3, base) && arg_count(base + 1, 1, 2) && type(base + 2) && name(base + 3);
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_DICTIONARY: {
+				valid = variable_args(1, base) && arg_count(base + 1, 2, 1);
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_TYPED_DICTIONARY: {
+				valid = variable_args(5, base) && arg_count(base + 1, 2, 3) && type(base + 2) && name(base + 3) && type(base + 4) && name(base + 5);
+			} break;
+			case GDScriptFunction::OPCODE_CALL: {
+				valid = variable_args(3, base) && arg_count(base + 1, 1, 1) && name(base + 2) && index(base + 3, p_function->_inline_caches_count);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_RETURN:
+			case GDScriptFunction::OPCODE_CALL_ASYNC: {
+				valid = variable_args(3, base) && arg_count(base + 1, 1, 2) && name(base + 2) && index(base + 3, p_function->_inline_caches_count);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 1) && index(base + 2, p_function->_methods_count);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_RET:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 2) && index(base + 2, p_function->_methods_count);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_STATIC: {
+				valid = variable_args(3, base) && type(base + 1) && name(base + 2) && arg_count(base + 3, 1, 1);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC: {
+				valid = variable_args(2, base) && index(base + 1, p_function->_methods_count) && arg_count(base + 2, 1, 1);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 1) && index(base + 2, p_function->_methods_count);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 2) && index(base + 2, p_function->_builtin_methods_count);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_UTILITY:
+			case GDScriptFunction::OPCODE_CALL_SELF_BASE: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 1) && name(base + 2);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 1) && index(base + 2, p_function->_utilities_count);
+			} break;
+			case GDScriptFunction::OPCODE_CALL_GDSCRIPT_UTILITY: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 1) && index(base + 2, p_function->_gds_utilities_count);
+			} break;
+			case GDScriptFunction::OPCODE_CREATE_LAMBDA:
+			case GDScriptFunction::OPCODE_CREATE_SELF_LAMBDA: {
+				valid = variable_args(2, base) && arg_count(base + 1, 1, 1) && index(base + 2, p_function->_lambdas_count);
+			} break;
+			case GDScriptFunction::OPCODE_AWAIT: {
+				// Always followed by its resume, which the VM reads ahead.
+				valid = fits(4) && address(1) && code[ip + 2] == GDScriptFunction::OPCODE_AWAIT_RESUME;
+				length = 2;
+			} break;
+			case GDScriptFunction::OPCODE_JUMP: {
+				valid = fits(2) && jump(1);
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_IF:
+			case GDScriptFunction::OPCODE_JUMP_IF_NOT:
+			case GDScriptFunction::OPCODE_JUMP_IF_SHARED: {
+				valid = fits(3) && address(1) && jump(2);
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT: {
+				valid = fits(6) && addresses(1, 3) && index(4, p_function->_operator_funcs_count) && jump(5);
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT:
+			case GDScriptFunction::OPCODE_BREAKPOINT:
+			case GDScriptFunction::OPCODE_END: {
+				valid = fits(1);
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_BUILTIN: {
+				valid = fits(3) && address(1) && type(2);
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_ARRAY: {
+				valid = fits(5) && addresses(1, 2) && type(3) && name(4);
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_DICTIONARY: {
+				valid = fits(8) && addresses(1, 3) && type(4) && name(5) && type(6) && name(7);
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_NATIVE:
+			case GDScriptFunction::OPCODE_RETURN_TYPED_SCRIPT: {
+				valid = fits(3) && addresses(1, 2);
+			} break;
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_INT:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_FLOAT:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_VECTOR2:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_VECTOR2I:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_VECTOR3:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_VECTOR3I:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_STRING:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_DICTIONARY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_INT32_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_INT64_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_FLOAT32_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_FLOAT64_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_STRING_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_VECTOR2_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_VECTOR3_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_COLOR_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_VECTOR4_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_BEGIN_OBJECT:
+			case GDScriptFunction::OPCODE_ITERATE:
+			case GDScriptFunction::OPCODE_ITERATE_INT:
+			case GDScriptFunction::OPCODE_ITERATE_FLOAT:
+			case GDScriptFunction::OPCODE_ITERATE_VECTOR2:
+			case GDScriptFunction::OPCODE_ITERATE_VECTOR2I:
+			case GDScriptFunction::OPCODE_ITERATE_VECTOR3:
+			case GDScriptFunction::OPCODE_ITERATE_VECTOR3I:
+			case GDScriptFunction::OPCODE_ITERATE_STRING:
+			case GDScriptFunction::OPCODE_ITERATE_DICTIONARY:
+			case GDScriptFunction::OPCODE_ITERATE_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_BYTE_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_INT32_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_INT64_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_FLOAT32_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_FLOAT64_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_STRING_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_VECTOR2_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_VECTOR3_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_COLOR_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_PACKED_VECTOR4_ARRAY:
+			case GDScriptFunction::OPCODE_ITERATE_OBJECT: {
+				valid = fits(5) && addresses(1, 3) && jump(4);
+			} break;
+			case GDScriptFunction::OPCODE_STORE_GLOBAL: {
+				valid = fits(3) && address(1) && index(2, GDScriptLanguage::get_singleton()->get_global_array_size());
+			} break;
+			case GDScriptFunction::OPCODE_ASSERT: {
+				// The message is optional, zero when missing.
+				valid = fits(3) && address(1) && (code[ip + 2] == 0 || address(2));
+			} break;
+			case GDScriptFunction::OPCODE_LINE: {
+				valid = fits(2);
+			} break;
+			default: {
+				valid = false;
+			} break;
+		}
+
+		if (!valid) {
+			return false;
+		}
+		ip += length;
+	}
+
+	for (const int target : jump_targets) {
+		if (target < 0 || target >= code_size || !instruction_starts[target]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+GDScriptFunction *GDScriptBytecodeCache::restore_function(const Dictionary &p_data, GDScript *p_script, GDScript *p_main_script) {
+	GDScriptFunction *function = memnew(GDScriptFunction);
+	function->_script = p_script;
+	function->source = p_script->get_script_path();
+
+	LocalVector<Pair<GDScriptFunction *, Vector2i>> lambdas;
+	if (!_restore_function(p_data, function, p_main_script, lambdas)) {
+		memdelete(function);
+		return nullptr;
+	}
+
+	for (const Pair<GDScriptFunction *, Vector2i> &E : lambdas) {
+		p_script->lambda_info.insert(E.first, { E.second.x, bool(E.second.y) });
+	}
+
+	return function;
+}
+
+uint32_t GDScriptBytecodeCache::_compute_engine_hash() {
+	uint32_t hash = hash_murmur3_one_32(FORMAT_VERSION);
+	hash = hash_murmur3_one_32(String(VERSION_FULL_BUILD).hash(), hash);
+	hash = hash_murmur3_one_32(String(VERSION_HASH).hash(), hash);
+	hash = hash_murmur3_one_32(GDScriptFunction::OPCODE_END, hash);
+#ifdef DEBUG_ENABLED
+	hash = hash_murmur3_one_32(1, hash); // Debug builds emit line and assert opcodes.
+#endif
+#ifdef TOOLS_ENABLED
+	hash = hash_murmur3_one_32(2, hash);
+#endif
+	// Stack debug info and profiler signatures are only generated while debugging.
+	hash = hash_murmur3_one_32(EngineDebugger::is_active(), hash);
+
+	// `OPCODE_STORE_GLOBAL` addresses globals by index.
+	for (const KeyValue<StringName, int> &E : GDScriptLanguage::get_singleton()->get_global_map()) {
+		hash = hash_murmur3_one_32(E.key.hash(), hash);
+		hash = hash_murmur3_one_32(E.value, hash);
+	}
+
+	return hash_fmix32(hash);
+}
+
+void GDScriptBytecodeCache::_load() {
+	if (loaded) {
+		return;
+	}
+	loaded = true;
+
+	// Only scripts exported as binary tokens are cached, which the editor never runs.
+	enabled = !Engine::get_singleton()->is_editor_hint() && bool(GLOBAL_GET("application/run/cache_gdscript_bytecode"));
+	if (!enabled) {
+		return;
+	}
+	engine_hash = _compute_engine_hash();
+
+	Ref<FileAccess> f = FileAccess::open(cache_path, FileAccess::READ);
+	if (f.is_null()) {
+		return;
+	}
+
+	uint8_t header[4] = {};
+	f->get_buffer(header, 4);
+	if (header[0] != 'G' || header[1] != 'D' || header[2] != 'B' || header[3] != 'C') {
+		return;
+	}
+	if (f->get_32() != FORMAT_VERSION || f->get_32() != engine_hash) {
+		return; // Written by another build, it is replaced when saving.
+	}
+
+	// The checksum is seeded with the engine hash, so it only matches data written by this build.
+	const uint32_t size = f->get_32();
+	const uint32_t checksum = f->get_32();
+	if (size == 0 || size > f->get_length() - f->get_position()) {
+		print_verbose(vformat(R"(GDScript bytecode cache "%s" is truncated, ignoring it.)", cache_path));
+		return;
+	}
+	Vector<uint8_t> data;
+	data.resize(size);
+	if (f->get_buffer(data.ptrw(), size) != size || hash_murmur3_buffer(data.ptr(), size, engine_hash) != checksum) {
+		print_verbose(vformat(R"(GDScript bytecode cache "%s" is corrupted, ignoring it.)", cache_path));
+		return;
+	}
+
+	Variant value;
+	if (decode_variant(value, data.ptr(), size, nullptr, false) != OK || value.get_type() != Variant::DICTIONARY) {
+		print_verbose(vformat(R"(GDScript bytecode cache "%s" can't be decoded, ignoring it.)", cache_path));
+		return;
+	}
+	scripts = value;
+}
+
+void GDScriptBytecodeCache::_scan_references(GDScriptTokenizer *p_tokenizer, const String &p_path, Vector<String> &r_paths) {
+	// Only tokens are scanned, parsing would be much slower. This finds the same scripts the
+	// parser would: global class names, and the paths given to `extends` and `preload()`.
+	HashSet<String> paths;
+	GDScriptTokenizer::Token::Type previous[2] = { GDScriptTokenizer::Token::EMPTY, GDScriptTokenizer::Token::EMPTY };
+	for (GDScriptTokenizer::Token token = p_tokenizer->scan(); token.type != GDScriptTokenizer::Token::TK_EOF; token = p_tokenizer->scan()) {
+		if (token.type == GDScriptTokenizer::Token::IDENTIFIER) {
+			const StringName name = token.get_identifier();
+			if (ScriptServer::is_global_class(name)) {
+				paths.insert(ScriptServer::get_global_class_path(name));
+			}
+		} else if (token.type == GDScriptTokenizer::Token::LITERAL && token.literal.get_type() == Variant::STRING) {
+			if (previous[1] == GDScriptTokenizer::Token::EXTENDS || (previous[0] == GDScriptTokenizer::Token::PRELOAD && previous[1] == GDScriptTokenizer::Token::PARENTHESIS_OPEN)) {
+				String path = token.literal;
+				if (path.is_relative_path()) {
+					path = p_path.get_base_dir().path_join(path);
+				}
+				paths.insert(path.simplify_path());
+			}
+		}
+		previous[0] = previous[1];
+		previous[1] = token.type;
+	}
+
+	paths.erase(p_path);
+	for (const String &E : paths) {
+		r_paths.push_back(E);
+	}
+}
+
+GDScriptBytecodeCache::ScriptReferences GDScriptBytecodeCache::_get_script_references(const String &p_path) {
+	{
+		MutexLock lock(mutex);
+		const ScriptReferences *references = script_references.getptr(p_path);
+		if (references) {
+			return *references;
+		}
+	}
+
+	ScriptReferences references;
+	const String remapped_path = ResourceLoader::path_remap(p_path);
+	if (FileAccess::exists(remapped_path)) {
+		if (remapped_path.get_extension().to_lower() == "gdc") {
+			const Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
+			references.source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+			GDScriptTokenizerBuffer tokenizer;
+			if (tokenizer.set_code_buffer(tokens) == OK) {
+				_scan_references(&tokenizer, p_path, references.paths);
+			}
+		} else if (remapped_path.get_extension().to_lower() == "gd") {
+			const String source = GDScriptCache::get_source_code(remapped_path);
+			references.source_hash = source.hash();
+			GDScriptTokenizerText tokenizer;
+			tokenizer.set_source_code(source);
+			_scan_references(&tokenizer, p_path, references.paths);
+		}
+	}
+
+	MutexLock lock(mutex);
+	script_references.insert(p_path, references);
+	return references;
+}
+
+uint32_t GDScriptBytecodeCache::hash_script(const String &p_path, const Vector<uint8_t> &p_binary_tokens) {
+	uint32_t hash = hash_djb2_buffer(p_binary_tokens.ptr(), p_binary_tokens.size());
+	if (!singleton) {
+		return hash;
+	}
+
+	Vector<String> pending;
+	GDScriptTokenizerBuffer tokenizer;
+	if (tokenizer.set_code_buffer(p_binary_tokens) == OK) {
+		_scan_references(&tokenizer, p_path, pending);
+	}
+
+	// Sorted, so the hash doesn't depend on the order scripts are found in.
+	RBMap<String, uint32_t> dependencies;
+	while (!pending.is_empty()) {
+		const String path = pending[pending.size() - 1];
+		pending.remove_at(pending.size() - 1);
+		if (path == p_path || dependencies.has(path)) {
+			continue;
+		}
+		const ScriptReferences references = singleton->_get_script_references(path);
+		dependencies.insert(path, references.source_hash);
+		pending.append_array(references.paths);
+	}
+
+	for (const KeyValue<String, uint32_t> &E : dependencies) {
+		hash = hash_murmur3_one_32(E.key.hash(), hash);
+		hash = hash_murmur3_one_32(E.value, hash);
+	}
+	return hash_fmix32(hash);
+}
+
+void GDScriptBytecodeCache::set_cache_path(const String &p_path) {
+	MutexLock lock(mutex);
+	cache_path = p_path;
+	scripts.clear();
+	script_references.clear();
+	loaded = false;
+	dirty = false;
+}
+
+String GDScriptBytecodeCache::get_cache_path() const {
+	return cache_path;
+}
+
+Dictionary GDScriptBytecodeCache::get_script_bytecode(const String &p_path, uint32_t p_source_hash, bool &r_complete) {
+	r_complete = false;
+	if (!singleton) {
+		return Dictionary();
+	}
+
+	MutexLock lock(singleton->mutex);
+	singleton->_load();
+	if (!singleton->enabled) {
+		return Dictionary();
+	}
+
+	const Dictionary entry = singleton->scripts.get(p_path, Dictionary());
+	if (entry.is_empty() || uint32_t(entry.get("source_hash", 0)) != p_source_hash) {
+		return Dictionary();
+	}
+
+	r_complete = entry.get("complete", false);
+	return entry.get("classes", Dictionary());
+}
+
+void GDScriptBytecodeCache::store_script(GDScript *p_script, uint32_t p_source_hash) {
+	if (!singleton) {
+		return;
+	}
+
+	MutexLock lock(singleton->mutex);
+	singleton->_load();
+	if (!singleton->enabled) {
+		return;
+	}
+
+	singleton->_build_symbols();
+
+	Dictionary classes;
+	Dictionary entry;
+	entry["complete"] = singleton->_serialize_class(p_script, classes);
+	entry["source_hash"] = p_source_hash;
+	entry["classes"] = classes;
+	singleton->scripts[p_script->get_script_path()] = entry;
+	singleton->dirty = true;
+}
+
+void GDScriptBytecodeCache::remove_script(const String &p_path) {
+	if (!singleton) {
+		return;
+	}
+
+	MutexLock lock(singleton->mutex);
+	singleton->script_references.erase(p_path);
+	if (singleton->scripts.erase(p_path)) {
+		singleton->dirty = true;
+	}
+}
+
+Error GDScriptBytecodeCache::save() {
+	MutexLock lock(mutex);
+	if (!dirty) {
+		return OK;
+	}
+
+	int size = 0;
+	Error err = encode_variant(scripts, nullptr, size, false);
+	ERR_FAIL_COND_V(err != OK, err);
+	Vector<uint8_t> data;
+	data.resize(size);
+	encode_variant(scripts, data.ptrw(), size, false);
+
+	Ref<FileAccess> f = FileAccess::open(cache_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat(R"(Cannot write the GDScript bytecode cache to "%s".)", cache_path));
+
+	f->store_buffer((const uint8_t *)"GDBC", 4);
+	f->store_32(FORMAT_VERSION);
+	f->store_32(engine_hash);
+	f->store_32(size);
+	f->store_32(hash_murmur3_buffer(data.ptr(), size, engine_hash));
+	f->store_buffer(data);
+
+	dirty = false;
+	return OK;
+}
+
+GDScriptBytecodeCache::GDScriptBytecodeCache() {
+	singleton = this;
+}
+
+GDScriptBytecodeCache::~GDScriptBytecodeCache() {
+	singleton = nullptr;
+}
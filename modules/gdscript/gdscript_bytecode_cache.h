@@ -0,0 +1,126 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_BYTECODE_CACHE_H
+#define GDSCRIPT_BYTECODE_CACHE_H
+
+#include "gdscript_function.h"
+
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+#include "core/templates/rb_map.h"
+#include "core/variant/dictionary.h"
+
+class GDScript;
+class GDScriptTokenizer;
+
+// Keeps the compiled bytecode of scripts loaded from binary tokens, so later runs
+// of the same build can restore their functions instead of analyzing and generating
+// the function bodies again. Function and type tables are stored by symbol (operator
+// and type, method and class name, script path...) and resolved again when restored,
+// so any symbol that can't be found anymore makes the compiler fall back to codegen.
+class GDScriptBytecodeCache {
+	static GDScriptBytecodeCache *singleton;
+
+	Mutex mutex;
+	String cache_path = "user://gdscript_bytecode.cache";
+	Dictionary scripts;
+	uint32_t engine_hash = 0;
+	bool enabled = false;
+	bool loaded = false;
+	bool dirty = false;
+
+	// Hash of the tokens (or source) of a script and the scripts it refers to, read once per run.
+	struct ScriptReferences {
+		uint32_t source_hash = 0;
+		Vector<String> paths;
+	};
+	HashMap<String, ScriptReferences> script_references;
+
+	bool symbols_built = false;
+	RBMap<Variant::ValidatedOperatorEvaluator, Variant> operator_symbols;
+	RBMap<Variant::ValidatedSetter, Variant> setter_symbols;
+	RBMap<Variant::ValidatedGetter, Variant> getter_symbols;
+	RBMap<Variant::ValidatedKeyedSetter, Variant> keyed_setter_symbols;
+	RBMap<Variant::ValidatedKeyedGetter, Variant> keyed_getter_symbols;
+	RBMap<Variant::ValidatedIndexedSetter, Variant> indexed_setter_symbols;
+	RBMap<Variant::ValidatedIndexedGetter, Variant> indexed_getter_symbols;
+	RBMap<Variant::ValidatedBuiltInMethod, Variant> builtin_method_symbols;
+	RBMap<Variant::ValidatedConstructor, Variant> constructor_symbols;
+	RBMap<Variant::ValidatedUtilityFunction, Variant> utility_symbols;
+	RBMap<GDScriptUtilityFunctions::FunctionPtr, Variant> gds_utility_symbols;
+
+	void _load();
+	void _build_symbols();
+
+	bool _serialize_function(const GDScriptFunction *p_function, Dictionary &r_data);
+	bool _serialize_class(GDScript *p_script, Dictionary &r_classes);
+
+	// Restored lambdas are paired with their capture count and `use_self` flag.
+	static bool _restore_function(const Dictionary &p_data, GDScriptFunction *p_function, GDScript *p_main_script, LocalVector<Pair<GDScriptFunction *, Vector2i>> &r_lambdas);
+	// Checks that every instruction fits in the code, and that every operand, address and table index is in range.
+	static bool _verify_code(GDScriptFunction *p_function);
+
+	static uint32_t _compute_engine_hash();
+	static void _scan_references(GDScriptTokenizer *p_tokenizer, const String &p_path, Vector<String> &r_paths);
+	ScriptReferences _get_script_references(const String &p_path);
+
+public:
+	static constexpr uint32_t FORMAT_VERSION = 5;
+
+	static GDScriptBytecodeCache *get_singleton() { return singleton; }
+
+	// Changing the path drops everything read or stored so far, the new file is read on next use.
+	void set_cache_path(const String &p_path);
+	String get_cache_path() const;
+
+	// Hash of the tokens of a script and of every script it refers to (bases, preloads, global
+	// classes), transitively, since their member layouts and constants end up in the bytecode.
+	static uint32_t hash_script(const String &p_path, const Vector<uint8_t> &p_binary_tokens);
+
+	// Returns the cached classes of the script, keyed by fully qualified class name, or an empty
+	// dictionary when nothing valid is cached for that hash, see hash_script(). `r_complete` tells whether every
+	// function of the script could be cached, in which case function bodies don't need analysis.
+	static Dictionary get_script_bytecode(const String &p_path, uint32_t p_source_hash, bool &r_complete);
+	static void store_script(GDScript *p_script, uint32_t p_source_hash);
+	static void remove_script(const String &p_path);
+
+	// Returns `nullptr` if any symbol can't be resolved anymore, or if the bytecode isn't valid.
+	static GDScriptFunction *restore_function(const Dictionary &p_data, GDScript *p_script, GDScript *p_main_script);
+
+	Error save();
+
+	GDScriptBytecodeCache();
+	~GDScriptBytecodeCache();
+};
+
+#endif // GDSCRIPT_BYTECODE_CACHE_H
@@ -237,6 +237,90 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 	return ref;
 }
 
+void GDScriptCache::_queue_dependency_parsers(const Vector<String> &p_paths, HashSet<String> &r_visited, LocalVector<Ref<GDScriptParserRef>> &r_queue) {
+	for (const String &path : p_paths) {
+		if (r_visited.has(path)) {
+			continue;
+		}
+		r_visited.insert(path);
+
+		// Scripts already in the cache are parsed, or being parsed, somewhere else.
+		if (singleton->parser_map.has(path) || !FileAccess::exists(ResourceLoader::path_remap(path))) {
+			continue;
+		}
+
+		Ref<GDScriptParserRef> ref;
+		ref.instantiate();
+		ref->path = path;
+		// Create the parser on this thread, since the first one registers the annotations.
+		ref->get_parser();
+		r_queue.push_back(ref);
+	}
+}
+
+void GDScriptCache::_parse_dependency_task(void *p_userdata, uint32_t p_index) {
+	Ref<GDScriptParserRef> *refs = static_cast<Ref<GDScriptParserRef> *>(p_userdata);
+	// Parsing doesn't touch the cache, errors are reported when the analyzer raises the status again.
+	refs[p_index]->raise_status(GDScriptParserRef::PARSED);
+}
+
+void GDScriptCache::parse_dependencies(const GDScriptParser *p_parser, LocalVector<Ref<GDScriptParserRef>> &r_parsers) {
+	MutexLock lock(singleton->mutex);
+
+	if (singleton->cleared) {
+		return;
+	}
+
+	HashSet<String> visited;
+	visited.insert(p_parser->script_path);
+
+	LocalVector<Ref<GDScriptParserRef>> queue;
+	_queue_dependency_parsers(p_parser->get_referenced_script_paths(), visited, queue);
+
+	// Each round parses the dependencies found by the previous one.
+	while (!queue.is_empty()) {
+		if (queue.size() == 1) {
+			queue[0]->raise_status(GDScriptParserRef::PARSED);
+		} else {
+			// The parsers aren't in the cache yet, so other threads can use it while they run.
+			uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(singleton->mutex);
+			WorkerThreadPool::GroupID group_id = WorkerThreadPool::get_singleton()->add_native_group_task(&_parse_dependency_task, queue.ptr(), queue.size(), -1, true, SNAME("GDScriptParseDependencies"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_id);
+			WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
+
+			if (singleton->cleared) {
+				for (const Ref<GDScriptParserRef> &ref : queue) {
+					ref->abandoned = true;
+				}
+				return;
+			}
+		}
+
+		LocalVector<Ref<GDScriptParserRef>> next_queue;
+		for (const Ref<GDScriptParserRef> &ref : queue) {
+			if (singleton->parser_map.has(ref->path)) {
+				// Another thread got to this script while the lock was lifted, keep its parser.
+				// Ours was never in the cache, so it must not remove the other one when freed.
+				ref->abandoned = true;
+				Ref<GDScriptParserRef> existing = Ref<GDScriptParserRef>(singleton->parser_map[ref->path]);
+				if (existing.is_valid()) {
+					r_parsers.push_back(existing);
+				}
+				continue;
+			}
+
+			singleton->parser_map[ref->path] = ref.ptr();
+			r_parsers.push_back(ref);
+
+			if (ref->result == OK) {
+				// Resolving a dependency only needs its interface, so its function bodies aren't followed.
+				_queue_dependency_parsers(ref->parser->get_interface_script_paths(), visited, next_queue);
+			}
+		}
+		queue = next_queue;
+	}
+}
+
 bool GDScriptCache::has_parser(const String &p_path) {
 	MutexLock lock(singleton->mutex);
 	return singleton->parser_map.has(p_path);
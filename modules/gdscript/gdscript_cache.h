@@ -37,6 +37,7 @@
 #include "core/os/safe_binary_mutex.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 
 class GDScriptAnalyzer;
 class GDScriptParser;
@@ -102,10 +103,16 @@ private:
 	static SafeBinaryMutex<BINARY_MUTEX_TAG> mutex;
 	friend SafeBinaryMutex<BINARY_MUTEX_TAG> &_get_gdscript_cache_mutex();
 
+	static void _queue_dependency_parsers(const Vector<String> &p_paths, HashSet<String> &r_visited, LocalVector<Ref<GDScriptParserRef>> &r_queue);
+	static void _parse_dependency_task(void *p_userdata, uint32_t p_index);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
+	// Parses the scripts that `p_parser` refers to, and recursively the ones they refer to, in
+	// parallel. The parsers are kept alive in `r_parsers`, so the analysis finds them ready.
+	static void parse_dependencies(const GDScriptParser *p_parser, LocalVector<Ref<GDScriptParserRef>> &r_parsers);
 	static bool has_parser(const String &p_path);
 	static void remove_parser(const String &p_path);
 	static String get_source_code(const String &p_path);
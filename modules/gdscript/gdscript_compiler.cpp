@@ -31,12 +31,15 @@
 #include "gdscript_compiler.h"
 
 #include "gdscript.h"
+#include "gdscript_aot.h"
 #include "gdscript_byte_codegen.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_utility_functions.h"
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/debugger/engine_debugger.h"
 
 #include "scene/scene_string_names.h"
 
@@ -251,6 +254,149 @@ static bool _can_use_validate_call(const MethodBind *p_method, const Vector<GDSc
 	return true;
 }
 
+// Only expressions of parameters, constants, operators and Variant utility functions can be inlined,
+// so evaluating them in the caller can't depend on the members or the script of the callee.
+static bool _is_inlineable_expression(const GDScriptParser::ExpressionNode *p_expression, int &r_budget) {
+	if (p_expression == nullptr || --r_budget < 0) {
+		return false;
+	}
+
+	const GDScriptParser::DataType datatype = p_expression->get_datatype();
+	if (datatype.is_set() && datatype.kind != GDScriptParser::DataType::BUILTIN && datatype.kind != GDScriptParser::DataType::VARIANT) {
+		return false;
+	}
+	if (p_expression->is_constant) {
+		return true;
+	}
+
+	switch (p_expression->type) {
+		case GDScriptParser::Node::LITERAL:
+			return true;
+		case GDScriptParser::Node::IDENTIFIER:
+			return static_cast<const GDScriptParser::IdentifierNode *>(p_expression)->source == GDScriptParser::IdentifierNode::FUNCTION_PARAMETER;
+		case GDScriptParser::Node::UNARY_OPERATOR:
+			return _is_inlineable_expression(static_cast<const GDScriptParser::UnaryOpNode *>(p_expression)->operand, r_budget);
+		case GDScriptParser::Node::BINARY_OPERATOR: {
+			const GDScriptParser::BinaryOpNode *binary = static_cast<const GDScriptParser::BinaryOpNode *>(p_expression);
+			return _is_inlineable_expression(binary->left_operand, r_budget) && _is_inlineable_expression(binary->right_operand, r_budget);
+		}
+		case GDScriptParser::Node::TERNARY_OPERATOR: {
+			const GDScriptParser::TernaryOpNode *ternary = static_cast<const GDScriptParser::TernaryOpNode *>(p_expression);
+			return _is_inlineable_expression(ternary->condition, r_budget) && _is_inlineable_expression(ternary->true_expr, r_budget) && _is_inlineable_expression(ternary->false_expr, r_budget);
+		}
+		case GDScriptParser::Node::CALL: {
+			const GDScriptParser::CallNode *call = static_cast<const GDScriptParser::CallNode *>(p_expression);
+			if (call->is_super || call->callee == nullptr || call->callee->type != GDScriptParser::Node::IDENTIFIER) {
+				return false;
+			}
+			if (GDScriptParser::get_builtin_type(call->function_name) >= Variant::VARIANT_MAX && !Variant::has_utility_function(call->function_name)) {
+				return false;
+			}
+			for (const GDScriptParser::ExpressionNode *argument : call->arguments) {
+				if (!_is_inlineable_expression(argument, r_budget)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+// Static functions made of a single `return` can be evaluated in place when called through their class.
+// Calls without a class may reach a static function of a derived script, so they are never inlined.
+const GDScriptParser::FunctionNode *GDScriptCompiler::_get_inlineable_function(const GDScriptParser::CallNode *p_call, const Vector<GDScriptCodeGenerator::Address> &p_arguments) const {
+	if (!optimizations_enabled || EngineDebugger::is_active() || p_call->is_super || p_call->callee == nullptr || p_call->callee->type != GDScriptParser::Node::SUBSCRIPT) {
+		return nullptr;
+	}
+	const GDScriptParser::SubscriptNode *subscript = static_cast<const GDScriptParser::SubscriptNode *>(p_call->callee);
+	if (!subscript->is_attribute || subscript->base == nullptr) {
+		return nullptr;
+	}
+	const GDScriptParser::DataType base_type = subscript->base->get_datatype();
+	if (!base_type.is_meta_type || base_type.kind != GDScriptParser::DataType::CLASS || base_type.class_type == nullptr) {
+		return nullptr;
+	}
+
+	// The callee must be compiled from the same source, otherwise it could change without recompiling the caller.
+	const GDScriptParser::ClassNode *root = base_type.class_type;
+	while (root->outer != nullptr) {
+		root = root->outer;
+	}
+	if (root != parser->get_tree() || !base_type.class_type->has_function(p_call->function_name)) {
+		return nullptr;
+	}
+
+	const GDScriptParser::FunctionNode *function = base_type.class_type->get_member(p_call->function_name).function;
+	if (function == nullptr || !function->is_static || function->is_coroutine || !function->resolved_body || function->body == nullptr) {
+		return nullptr;
+	}
+	if (function->parameters.size() != p_arguments.size() || function->body->statements.size() != 1 || function->body->statements[0]->type != GDScriptParser::Node::RETURN) {
+		return nullptr;
+	}
+	const GDScriptParser::ReturnNode *return_node = static_cast<const GDScriptParser::ReturnNode *>(function->body->statements[0]);
+	if (return_node->return_value == nullptr) {
+		return nullptr;
+	}
+
+	// Typed parameters and return values would convert the values, so they must match exactly.
+	for (int i = 0; i < function->parameters.size(); i++) {
+		const GDScriptParser::DataType par_type = function->parameters[i]->get_datatype();
+		if (!par_type.is_hard_type() || par_type.is_variant()) {
+			continue;
+		}
+		const GDScriptDataType &arg_type = p_arguments[i].type;
+		if (par_type.kind != GDScriptParser::DataType::BUILTIN || par_type.builtin_type == Variant::ARRAY || par_type.builtin_type == Variant::DICTIONARY) {
+			return nullptr;
+		}
+		if (!arg_type.has_type || arg_type.kind != GDScriptDataType::BUILTIN || arg_type.builtin_type != par_type.builtin_type) {
+			return nullptr;
+		}
+	}
+	const GDScriptParser::DataType return_type = function->get_datatype();
+	if (return_type.is_hard_type() && !return_type.is_variant()) {
+		const GDScriptParser::DataType value_type = return_node->return_value->get_datatype();
+		if (return_type.kind != GDScriptParser::DataType::BUILTIN || !value_type.is_hard_type() || value_type.kind != GDScriptParser::DataType::BUILTIN || value_type.builtin_type != return_type.builtin_type) {
+			return nullptr;
+		}
+	}
+
+	int budget = 32;
+	if (!_is_inlineable_expression(return_node->return_value, budget)) {
+		return nullptr;
+	}
+	return function;
+}
+
+Error GDScriptCompiler::_write_inlined_call(CodeGen &codegen, const GDScriptParser::FunctionNode *p_function, const Vector<GDScriptCodeGenerator::Address> &p_arguments, const GDScriptCodeGenerator::Address &p_result) {
+	const GDScriptParser::ReturnNode *return_node = static_cast<const GDScriptParser::ReturnNode *>(p_function->body->statements[0]);
+
+	// Parameters of the callee are bound to the already evaluated arguments.
+	HashMap<StringName, GDScriptCodeGenerator::Address> parameters = codegen.parameters;
+	HashMap<StringName, GDScriptCodeGenerator::Address> locals = codegen.locals;
+	codegen.parameters.clear();
+	codegen.locals.clear();
+	for (int i = 0; i < p_function->parameters.size(); i++) {
+		codegen.parameters[p_function->parameters[i]->identifier->name] = p_arguments[i];
+	}
+
+	Error err = OK;
+	GDScriptCodeGenerator::Address value = _parse_expression(codegen, err, return_node->return_value);
+
+	codegen.parameters = parameters;
+	codegen.locals = locals;
+	if (err) {
+		return err;
+	}
+
+	codegen.generator->write_assign(p_result, value);
+	if (value.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+		codegen.generator->pop_temporary();
+	}
+	return OK;
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root, bool p_initializer) {
 	if (p_expression->is_constant && !(p_expression->get_datatype().is_meta_type && p_expression->get_datatype().kind == GDScriptParser::DataType::CLASS)) {
 		return codegen.add_constant(p_expression->reduced_value);
@@ -630,10 +776,16 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 			} else {
 				// Regular function.
 				const GDScriptParser::ExpressionNode *callee = call->callee;
+				const GDScriptParser::FunctionNode *inlined = (p_root || is_awaited) ? nullptr : _get_inlineable_function(call, arguments);
 
 				if (call->is_super) {
 					// Super call.
 					gen->write_super_call(result, call->function_name, arguments);
+				} else if (inlined) {
+					r_error = _write_inlined_call(codegen, inlined, arguments, result);
+					if (r_error) {
+						return GDScriptCodeGenerator::Address();
+					}
 				} else {
 					if (callee->type == GDScriptParser::Node::IDENTIFIER) {
 						// Self function call.
@@ -2240,8 +2392,34 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_script, const GDScriptParser::ClassNode *p_class, const GDScriptParser::FunctionNode *p_func, bool p_for_ready, bool p_for_lambda) {
 	r_error = OK;
+
+	// Lambdas are restored along with the function declaring them.
+	if (!p_for_lambda && !cached_bytecode.is_empty()) {
+		StringName cached_name = p_func ? p_func->identifier->name : (p_for_ready ? SNAME("@implicit_ready") : SNAME("@implicit_new"));
+		GDScriptFunction *cached_function = _restore_cached_function(r_error, p_script, cached_name);
+		if (r_error) {
+			return nullptr;
+		}
+		if (cached_function) {
+			if (!p_func) {
+				if (p_for_ready) {
+					p_script->implicit_ready = cached_function;
+				} else {
+					p_script->implicit_initializer = cached_function;
+				}
+			} else {
+				if (cached_name == GDScriptLanguage::get_singleton()->strings._init) {
+					p_script->initializer = cached_function;
+				}
+				p_script->member_functions[cached_name] = cached_function;
+			}
+			return cached_function;
+		}
+	}
+
 	CodeGen codegen;
 	codegen.generator = memnew(GDScriptByteCodeGenerator);
+	static_cast<GDScriptByteCodeGenerator *>(codegen.generator)->set_optimizations_enabled(optimizations_enabled);
 
 	codegen.class_node = p_class;
 	codegen.script = p_script;
@@ -2473,6 +2651,10 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 		p_script->member_functions[func_name] = gd_function;
 	}
 
+	if (!p_for_lambda) {
+		GDScriptAOT::bind_function(p_script, gd_function);
+	}
+
 	memdelete(codegen.generator);
 
 	return gd_function;
@@ -2480,8 +2662,17 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 
 GDScriptFunction *GDScriptCompiler::_make_static_initializer(Error &r_error, GDScript *p_script, const GDScriptParser::ClassNode *p_class) {
 	r_error = OK;
+
+	if (!cached_bytecode.is_empty()) {
+		GDScriptFunction *cached_function = _restore_cached_function(r_error, p_script, SNAME("@static_initializer"));
+		if (cached_function || r_error) {
+			return cached_function;
+		}
+	}
+
 	CodeGen codegen;
 	codegen.generator = memnew(GDScriptByteCodeGenerator);
+	static_cast<GDScriptByteCodeGenerator *>(codegen.generator)->set_optimizations_enabled(optimizations_enabled);
 
 	codegen.class_node = p_class;
 	codegen.script = p_script;
@@ -2608,11 +2799,34 @@ GDScriptFunction *GDScriptCompiler::_make_static_initializer(Error &r_error, GDS
 
 	GDScriptFunction *gd_function = codegen.generator->write_end();
 
+	GDScriptAOT::bind_function(p_script, gd_function);
+
 	memdelete(codegen.generator);
 
 	return gd_function;
 }
 
+GDScriptFunction *GDScriptCompiler::_restore_cached_function(Error &r_error, GDScript *p_script, const StringName &p_name) {
+	const Dictionary functions = cached_bytecode.get(p_script->fully_qualified_name, Dictionary());
+	const Variant data = functions.get(String(p_name), Variant());
+
+	GDScriptFunction *function = nullptr;
+	if (data.get_type() == Variant::DICTIONARY) {
+		function = GDScriptBytecodeCache::restore_function(data, p_script, main_script);
+	}
+
+	if (function) {
+		GDScriptAOT::bind_function(p_script, function);
+	} else if (cached_bytecode_required) {
+		// The function body was not analyzed, so it can't be generated either.
+		cached_bytecode_stale = true;
+		_set_error(vformat(R"(Could not restore cached bytecode for function "%s".)", p_name), nullptr);
+		r_error = ERR_COMPILATION_FAILED;
+	}
+
+	return function;
+}
+
 Error GDScriptCompiler::_parse_setter_getter(GDScript *p_script, const GDScriptParser::ClassNode *p_class, const GDScriptParser::VariableNode *p_variable, bool p_is_setter) {
 	Error err = OK;
 
@@ -3285,5 +3499,10 @@ int GDScriptCompiler::get_error_column() const {
 	return err_column;
 }
 
+void GDScriptCompiler::set_cached_bytecode(const Dictionary &p_classes, bool p_required) {
+	cached_bytecode = p_classes;
+	cached_bytecode_required = p_required && !p_classes.is_empty();
+}
+
 GDScriptCompiler::GDScriptCompiler() {
 }
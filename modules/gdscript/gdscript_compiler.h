@@ -44,6 +44,13 @@ class GDScriptCompiler {
 	HashSet<GDScript *> parsing_classes;
 	GDScript *main_script = nullptr;
 
+	// Functions restored from the bytecode cache, by fully qualified class name and function name.
+	Dictionary cached_bytecode;
+	bool cached_bytecode_required = false;
+	bool cached_bytecode_stale = false;
+
+	bool optimizations_enabled = true;
+
 	struct FunctionLambdaInfo {
 		GDScriptFunction *function = nullptr;
 		GDScriptFunction *parent = nullptr;
@@ -151,6 +158,8 @@ class GDScriptCompiler {
 
 	GDScriptDataType _gdtype_from_datatype(const GDScriptParser::DataType &p_datatype, GDScript *p_owner, bool p_handle_metatype = true);
 
+	const GDScriptParser::FunctionNode *_get_inlineable_function(const GDScriptParser::CallNode *p_call, const Vector<GDScriptCodeGenerator::Address> &p_arguments) const;
+	Error _write_inlined_call(CodeGen &codegen, const GDScriptParser::FunctionNode *p_function, const Vector<GDScriptCodeGenerator::Address> &p_arguments, const GDScriptCodeGenerator::Address &p_result);
 	GDScriptCodeGenerator::Address _parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root = false, bool p_initializer = false);
 	GDScriptCodeGenerator::Address _parse_match_pattern(CodeGen &codegen, Error &r_error, const GDScriptParser::PatternNode *p_pattern, const GDScriptCodeGenerator::Address &p_value_addr, const GDScriptCodeGenerator::Address &p_type_addr, const GDScriptCodeGenerator::Address &p_previous_test, bool p_is_first, bool p_is_nested);
 	List<GDScriptCodeGenerator::Address> _add_block_locals(CodeGen &codegen, const GDScriptParser::SuiteNode *p_block);
@@ -158,6 +167,7 @@ class GDScriptCompiler {
 	Error _parse_block(CodeGen &codegen, const GDScriptParser::SuiteNode *p_block, bool p_add_locals = true, bool p_clear_locals = true);
 	GDScriptFunction *_parse_function(Error &r_error, GDScript *p_script, const GDScriptParser::ClassNode *p_class, const GDScriptParser::FunctionNode *p_func, bool p_for_ready = false, bool p_for_lambda = false);
 	GDScriptFunction *_make_static_initializer(Error &r_error, GDScript *p_script, const GDScriptParser::ClassNode *p_class);
+	GDScriptFunction *_restore_cached_function(Error &r_error, GDScript *p_script, const StringName &p_name);
 	Error _parse_setter_getter(GDScript *p_script, const GDScriptParser::ClassNode *p_class, const GDScriptParser::VariableNode *p_variable, bool p_is_setter);
 	Error _prepare_compilation(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state);
 	Error _compile_class(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state);
@@ -180,6 +190,13 @@ public:
 	static void make_scripts(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state);
 	Error compile(const GDScriptParser *p_parser, GDScript *p_script, bool p_keep_state = false);
 
+	// When required, every function must be restored since bodies were not analyzed.
+	void set_cached_bytecode(const Dictionary &p_classes, bool p_required);
+	bool is_cached_bytecode_stale() const { return cached_bytecode_stale; }
+
+	// Peephole optimizations in the bytecode generator and inlining of trivial static functions.
+	void set_optimizations_enabled(bool p_enabled) { optimizations_enabled = p_enabled; }
+
 	String get_error() const;
 	int get_error_line() const;
 	int get_error_column() const;
@@ -32,6 +32,43 @@
 
 #include "gdscript.h"
 
+SafeNumeric<uint32_t> GDScriptFunction::inline_cache_epoch(1);
+
+BinaryMutex GDScriptFunctionState::frame_pool_mutex;
+LocalVector<uint8_t *> GDScriptFunctionState::frame_pool[GDScriptFunctionState::FRAME_POOL_BUCKETS];
+
+void GDScriptFunction::InlineCache::store(const void *p_key, uint32_t p_epoch, Kind p_kind, uintptr_t p_data, uintptr_t p_aux) {
+	uint32_t v = version.load(std::memory_order_relaxed);
+	if ((v & 1) || !version.compare_exchange_strong(v, v + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+		return; // Another thread is writing, this one can skip caching.
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+
+	int slot = -1;
+	for (int i = 0; i < ENTRY_COUNT; i++) {
+		const void *key = entries[i].key.load(std::memory_order_relaxed);
+		if (key == p_key) {
+			slot = i;
+			break;
+		}
+		if (slot == -1 && (key == nullptr || entries[i].epoch.load(std::memory_order_relaxed) != p_epoch)) {
+			slot = i;
+		}
+	}
+
+	// When every entry is in use the site is megamorphic, keep the receivers already cached.
+	if (slot != -1) {
+		Entry &e = entries[slot];
+		e.key.store(p_key, std::memory_order_relaxed);
+		e.epoch.store(p_epoch, std::memory_order_relaxed);
+		e.kind.store(p_kind, std::memory_order_relaxed);
+		e.data.store(p_data, std::memory_order_relaxed);
+		e.aux.store(p_aux, std::memory_order_relaxed);
+	}
+
+	version.store(v + 2, std::memory_order_release);
+}
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -126,6 +163,12 @@ GDScriptFunction::~GDScriptFunction() {
 	}
 	return_type.script_type_ref = Ref<Script>();
 
+	if (_inline_caches_ptr) {
+		memdelete_arr(_inline_caches_ptr);
+	}
+	// Other functions may have cached this one.
+	invalidate_inline_caches();
+
 #ifdef DEBUG_ENABLED
 	MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
 	GDScriptLanguage::get_singleton()->function_list.remove(&function_list);
@@ -134,24 +177,26 @@ GDScriptFunction::~GDScriptFunction() {
 
 /////////////////////
 
+Variant GDScriptFunctionState::_get_signal_result(const Variant **p_args, int p_argcount) {
+	if (p_argcount == 0) {
+		return Variant();
+	} else if (p_argcount == 1) {
+		return *p_args[0];
+	}
+	Array extra_args;
+	for (int i = 0; i < p_argcount; i++) {
+		extra_args.push_back(*p_args[i]);
+	}
+	return extra_args;
+}
+
 Variant GDScriptFunctionState::_signal_callback(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
-	Variant arg;
 	r_error.error = Callable::CallError::CALL_OK;
 
 	if (p_argcount == 0) {
 		r_error.error = Callable::CallError::CALL_ERROR_TOO_FEW_ARGUMENTS;
 		r_error.expected = 1;
 		return Variant();
-	} else if (p_argcount == 1) {
-		//noooneee
-	} else if (p_argcount == 2) {
-		arg = *p_args[0];
-	} else {
-		Array extra_args;
-		for (int i = 0; i < p_argcount - 1; i++) {
-			extra_args.push_back(*p_args[i]);
-		}
-		arg = extra_args;
 	}
 
 	Ref<GDScriptFunctionState> self = *p_args[p_argcount - 1];
@@ -163,7 +208,7 @@ Variant GDScriptFunctionState::_signal_callback(const Variant **p_args, int p_ar
 		return Variant();
 	}
 
-	return resume(arg);
+	return resume(_get_signal_result(p_args, p_argcount - 1));
 }
 
 bool GDScriptFunctionState::is_valid(bool p_extended_check) const {
@@ -249,9 +294,67 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 	return ret;
 }
 
+uint8_t *GDScriptFunctionState::_allocate_frame(uint32_t p_size) {
+	ERR_FAIL_COND_V(frame_bucket != -1 || state.stack != nullptr, nullptr);
+
+	if (p_size <= INLINE_FRAME_SIZE) {
+		return inline_frame;
+	}
+
+	int bucket = 0;
+	while (bucket < FRAME_POOL_BUCKETS && (1u << (FRAME_POOL_MIN_SHIFT + bucket)) < p_size) {
+		bucket++;
+	}
+	frame_bucket = bucket;
+	if (bucket == FRAME_POOL_BUCKETS) {
+		return (uint8_t *)memalloc(p_size);
+	}
+
+	{
+		MutexLock lock(frame_pool_mutex);
+		if (!frame_pool[bucket].is_empty()) {
+			uint8_t *frame = frame_pool[bucket][frame_pool[bucket].size() - 1];
+			frame_pool[bucket].resize(frame_pool[bucket].size() - 1);
+			return frame;
+		}
+	}
+	return (uint8_t *)memalloc(1u << (FRAME_POOL_MIN_SHIFT + bucket));
+}
+
+void GDScriptFunctionState::_free_frame() {
+	if (state.stack == nullptr || frame_bucket == -1) {
+		state.stack = nullptr;
+		return;
+	}
+
+	uint8_t *frame = state.stack;
+	state.stack = nullptr;
+	if (frame_bucket < FRAME_POOL_BUCKETS) {
+		MutexLock lock(frame_pool_mutex);
+		if (frame_pool[frame_bucket].size() < FRAME_POOL_MAX_FREE) {
+			frame_pool[frame_bucket].push_back(frame);
+			frame = nullptr;
+		}
+	}
+	if (frame) {
+		memfree(frame);
+	}
+	frame_bucket = -1;
+}
+
+void GDScriptFunctionState::clear_frame_pool() {
+	MutexLock lock(frame_pool_mutex);
+	for (LocalVector<uint8_t *> &bucket : frame_pool) {
+		for (uint8_t *frame : bucket) {
+			memfree(frame);
+		}
+		bucket.reset();
+	}
+}
+
 void GDScriptFunctionState::_clear_stack() {
 	if (state.stack_size) {
-		Variant *stack = (Variant *)state.stack.ptr();
+		Variant *stack = (Variant *)state.stack;
 		// The first 3 are special addresses and not copied to the state, so we skip them here.
 		for (int i = 3; i < state.stack_size; i++) {
 			stack[i].~Variant();
@@ -267,6 +370,9 @@ void GDScriptFunctionState::_clear_connections() {
 	for (Object::Connection &c : conns) {
 		c.signal.disconnect(c.callable);
 	}
+
+	// A signal being emitted may already hold the resume callable, which checks this before resuming.
+	function = nullptr;
 }
 
 void GDScriptFunctionState::_bind_methods() {
@@ -288,4 +394,52 @@ GDScriptFunctionState::~GDScriptFunctionState() {
 		scripts_list.remove_from_list();
 		instances_list.remove_from_list();
 	}
+
+	// Values still on the frame when the function was never resumed.
+	_clear_stack();
+	_free_frame();
+}
+
+bool GDScriptFunctionStateCallable::compare_equal(const CallableCustom *p_a, const CallableCustom *p_b) {
+	return p_a == p_b;
+}
+
+bool GDScriptFunctionStateCallable::compare_less(const CallableCustom *p_a, const CallableCustom *p_b) {
+	return p_a < p_b;
+}
+
+uint32_t GDScriptFunctionStateCallable::hash() const {
+	return hash_one_uint64(state->get_instance_id());
+}
+
+String GDScriptFunctionStateCallable::get_as_text() const {
+	return "GDScriptFunctionState::resume";
+}
+
+CallableCustom::CompareEqualFunc GDScriptFunctionStateCallable::get_compare_equal_func() const {
+	return compare_equal;
+}
+
+CallableCustom::CompareLessFunc GDScriptFunctionStateCallable::get_compare_less_func() const {
+	return compare_less;
+}
+
+ObjectID GDScriptFunctionStateCallable::get_object() const {
+	return state->get_instance_id();
+}
+
+void GDScriptFunctionStateCallable::call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const {
+	r_call_error.error = Callable::CallError::CALL_OK;
+	if (state->function == nullptr) {
+		// Already resumed, or the script or instance is gone.
+		r_return_value = Variant();
+		return;
+	}
+
+	Ref<GDScriptFunctionState> keep_alive = state;
+	r_return_value = keep_alive->resume(GDScriptFunctionState::_get_signal_result(p_arguments, p_argcount));
+}
+
+GDScriptFunctionStateCallable::GDScriptFunctionStateCallable(const Ref<GDScriptFunctionState> &p_state) :
+		state(p_state) {
 }
@@ -35,14 +35,18 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
 
 class GDScriptInstance;
 class GDScript;
+struct GDScriptAOTFrame;
 
 class GDScriptDataType {
 public:
@@ -265,9 +269,11 @@ public:
 		OPCODE_SET_KEYED,
 		OPCODE_SET_KEYED_VALIDATED,
 		OPCODE_SET_INDEXED_VALIDATED,
+		OPCODE_SET_INDEXED_PACKED,
 		OPCODE_GET_KEYED,
 		OPCODE_GET_KEYED_VALIDATED,
 		OPCODE_GET_INDEXED_VALIDATED,
+		OPCODE_GET_INDEXED_PACKED,
 		OPCODE_SET_NAMED,
 		OPCODE_SET_NAMED_VALIDATED,
 		OPCODE_GET_NAMED,
@@ -317,6 +323,7 @@ public:
 		OPCODE_JUMP,
 		OPCODE_JUMP_IF,
 		OPCODE_JUMP_IF_NOT,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
 		OPCODE_JUMP_TO_DEF_ARGUMENT,
 		OPCODE_JUMP_IF_SHARED,
 		OPCODE_RETURN,
@@ -440,11 +447,66 @@ public:
 		StringName identifier;
 	};
 
+	// Remembers how the last few receivers of an untyped named access or call were resolved, so
+	// the VM can skip the generic lookup when the same kind of receiver comes back. Receivers are
+	// keyed by builtin type, native class or GDScript, and entries are only trusted while their
+	// epoch matches the global one, which changes whenever a script is reloaded or freed.
+	// Several threads may run the same function, so entries are guarded by a sequence lock and
+	// writers that don't get it simply don't cache.
+	struct InlineCache {
+		enum Kind {
+			KIND_NONE,
+			KIND_BUILTIN_GETTER,
+			KIND_BUILTIN_SETTER,
+			KIND_MEMBER,
+			KIND_SCRIPT_FUNCTION,
+			KIND_METHOD_BIND,
+		};
+
+		static constexpr int ENTRY_COUNT = 4;
+
+		struct Entry {
+			std::atomic<const void *> key{ nullptr };
+			std::atomic<uint32_t> epoch{ 0 };
+			std::atomic<uint32_t> kind{ KIND_NONE };
+			std::atomic<uintptr_t> data{ 0 };
+			std::atomic<uintptr_t> aux{ 0 };
+		};
+
+		std::atomic<uint32_t> version{ 0 };
+		Entry entries[ENTRY_COUNT];
+
+		_FORCE_INLINE_ bool lookup(const void *p_key, uint32_t p_epoch, Kind &r_kind, uintptr_t &r_data, uintptr_t &r_aux) const {
+			uint32_t v = version.load(std::memory_order_acquire);
+			if (v & 1) {
+				return false; // Being written.
+			}
+			bool found = false;
+			for (int i = 0; i < ENTRY_COUNT; i++) {
+				const Entry &e = entries[i];
+				if (e.key.load(std::memory_order_relaxed) == p_key && e.epoch.load(std::memory_order_relaxed) == p_epoch) {
+					r_kind = Kind(e.kind.load(std::memory_order_relaxed));
+					r_data = e.data.load(std::memory_order_relaxed);
+					r_aux = e.aux.load(std::memory_order_relaxed);
+					found = true;
+					break;
+				}
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return found && version.load(std::memory_order_relaxed) == v;
+		}
+
+		void store(const void *p_key, uint32_t p_epoch, Kind p_kind, uintptr_t p_data, uintptr_t p_aux);
+	};
+
 private:
 	friend class GDScript;
+	friend class GDScriptAOT;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
+	friend class GDScriptSamplingProfiler;
 
 	StringName name;
 	StringName source;
@@ -460,6 +522,9 @@ private:
 	int _stack_size = 0;
 	int _instruction_args_size = 0;
 
+	// Assigned the first time the function runs while the sampling profiler is active.
+	mutable std::atomic<uint32_t> _sampling_id = { 0 };
+
 	SelfList<GDScriptFunction> function_list{ this };
 	mutable Variant nil;
 	HashMap<int, Variant::Type> temporary_slots;
@@ -519,6 +584,15 @@ private:
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
 
+	InlineCache *_inline_caches_ptr = nullptr;
+	int _inline_caches_count = 0;
+
+	// Changes whenever cached resolutions may have become stale.
+	static SafeNumeric<uint32_t> inline_cache_epoch;
+
+	// Native translation of the bytecode, see GDScriptAOT.
+	int (*_aot_function)(GDScriptAOTFrame &p_frame) = nullptr;
+
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
 	const char *_func_cname = nullptr;
@@ -553,6 +627,10 @@ private:
 #endif
 
 	_FORCE_INLINE_ String _get_call_error(const String &p_where, const Variant **p_argptrs, const Variant &p_ret, const Callable::CallError &p_err) const;
+	static const void *_get_inline_cache_key(const Variant *p_base, Object *&r_object, GDScriptInstance *&r_instance);
+	static bool _get_named_cached(InlineCache &p_cache, const Variant *p_src, const StringName &p_name, Variant *p_dst);
+	static bool _set_named_cached(InlineCache &p_cache, Variant *p_dst, const StringName &p_name, const Variant *p_value);
+	static bool _call_named_cached(InlineCache &p_cache, Variant *p_base, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
 public:
@@ -565,7 +643,7 @@ public:
 		StringName function_name;
 		String script_path;
 #endif
-		Vector<uint8_t> stack;
+		uint8_t *stack = nullptr; // Frame storage, owned by the function state.
 		int stack_size = 0;
 		uint32_t alloca_size = 0;
 		int ip = 0;
@@ -589,6 +667,8 @@ public:
 	Variant call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state = nullptr);
 	void debug_get_stack_member_state(int p_line, List<Pair<StringName, int>> *r_stackvars) const;
 
+	static void invalidate_inline_caches() { inline_cache_epoch.increment(); }
+
 #ifdef DEBUG_ENABLED
 	void _profile_native_call(uint64_t p_t_taken, const String &p_function_name, const String &p_instance_class_name = String());
 	void disassemble(const Vector<String> &p_code_lines) const;
@@ -601,6 +681,7 @@ public:
 class GDScriptFunctionState : public RefCounted {
 	GDCLASS(GDScriptFunctionState, RefCounted);
 	friend class GDScriptFunction;
+	friend class GDScriptFunctionStateCallable;
 	GDScriptFunction *function = nullptr;
 	GDScriptFunction::CallState state;
 	Variant _signal_callback(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
@@ -609,6 +690,24 @@ class GDScriptFunctionState : public RefCounted {
 	SelfList<GDScriptFunctionState> scripts_list;
 	SelfList<GDScriptFunctionState> instances_list;
 
+	// Small frames are stored in the state itself, bigger ones are reused
+	// from a pool with one bucket per power of two size.
+	static constexpr uint32_t INLINE_FRAME_SIZE = 512;
+	static constexpr uint32_t FRAME_POOL_MIN_SHIFT = 10;
+	static constexpr int FRAME_POOL_BUCKETS = 7;
+	static constexpr uint32_t FRAME_POOL_MAX_FREE = 64;
+
+	static BinaryMutex frame_pool_mutex;
+	static LocalVector<uint8_t *> frame_pool[FRAME_POOL_BUCKETS];
+
+	alignas(Variant) uint8_t inline_frame[INLINE_FRAME_SIZE];
+	int frame_bucket = -1; // -1 for the inline frame, `FRAME_POOL_BUCKETS` for frames too big to pool.
+
+	uint8_t *_allocate_frame(uint32_t p_size);
+	void _free_frame();
+
+	static Variant _get_signal_result(const Variant **p_args, int p_argcount);
+
 protected:
 	static void _bind_methods();
 
@@ -619,8 +718,29 @@ public:
 	void _clear_stack();
 	void _clear_connections();
 
+	static void clear_frame_pool();
+
 	GDScriptFunctionState();
 	~GDScriptFunctionState();
 };
 
+// Resumes a function state when the awaited signal is emitted, without
+// binding the state to a method callable.
+class GDScriptFunctionStateCallable : public CallableCustom {
+	Ref<GDScriptFunctionState> state;
+
+	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b);
+	static bool compare_less(const CallableCustom *p_a, const CallableCustom *p_b);
+
+public:
+	uint32_t hash() const override;
+	String get_as_text() const override;
+	CompareEqualFunc get_compare_equal_func() const override;
+	CompareLessFunc get_compare_less_func() const override;
+	ObjectID get_object() const override;
+	void call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const override;
+
+	GDScriptFunctionStateCallable(const Ref<GDScriptFunctionState> &p_state);
+};
+
 #endif // GDSCRIPT_FUNCTION_H
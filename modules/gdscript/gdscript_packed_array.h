@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  gdscript_packed_array.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_PACKED_ARRAY_H
+#define GDSCRIPT_PACKED_ARRAY_H
+
+#include "core/object/class_db.h"
+#include "core/variant/variant_internal.h"
+
+// Element access for packed arrays of numbers and math types, used instead of the generic
+// validated indexed getters and setters when both the array and the index are typed.
+// Elements are read and written in place: `ptrw()` only copies the array when it's shared,
+// so writes to an array owned by a single variable don't allocate.
+class GDScriptPackedArray {
+	template <typename T, typename E>
+	static _FORCE_INLINE_ bool _get(const Variant *p_array, int64_t p_index, Variant *r_value) {
+		const Vector<T> *array = VariantGetInternalPtr<Vector<T>>::get_ptr(p_array);
+		const int64_t size = array->size();
+		if (p_index < 0) {
+			p_index += size;
+		}
+		if (unlikely(p_index < 0 || p_index >= size)) {
+			return false;
+		}
+		VariantTypeChanger<E>::change(r_value);
+		*VariantGetInternalPtr<E>::get_ptr(r_value) = E(array->ptr()[p_index]);
+		return true;
+	}
+
+	template <typename T, typename E>
+	static _FORCE_INLINE_ bool _set(Variant *p_array, int64_t p_index, const Variant *p_value) {
+		Vector<T> *array = VariantGetInternalPtr<Vector<T>>::get_ptr(p_array);
+		const int64_t size = array->size();
+		if (p_index < 0) {
+			p_index += size;
+		}
+		if (unlikely(p_index < 0 || p_index >= size)) {
+			return false;
+		}
+		array->ptrw()[p_index] = T(*VariantGetInternalPtr<E>::get_ptr(p_value));
+		return true;
+	}
+
+public:
+	static _FORCE_INLINE_ bool is_supported(Variant::Type p_type) {
+		switch (p_type) {
+			case Variant::PACKED_BYTE_ARRAY:
+			case Variant::PACKED_INT32_ARRAY:
+			case Variant::PACKED_INT64_ARRAY:
+			case Variant::PACKED_FLOAT32_ARRAY:
+			case Variant::PACKED_FLOAT64_ARRAY:
+			case Variant::PACKED_VECTOR2_ARRAY:
+			case Variant::PACKED_VECTOR3_ARRAY:
+			case Variant::PACKED_COLOR_ARRAY:
+			case Variant::PACKED_VECTOR4_ARRAY:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	// Return `false` if the index is out of bounds. The type must be supported.
+	static _FORCE_INLINE_ bool get(Variant::Type p_type, const Variant *p_array, int64_t p_index, Variant *r_value) {
+		switch (p_type) {
+			case Variant::PACKED_BYTE_ARRAY:
+				return _get<uint8_t, int64_t>(p_array, p_index, r_value);
+			case Variant::PACKED_INT32_ARRAY:
+				return _get<int32_t, int64_t>(p_array, p_index, r_value);
+			case Variant::PACKED_INT64_ARRAY:
+				return _get<int64_t, int64_t>(p_array, p_index, r_value);
+			case Variant::PACKED_FLOAT32_ARRAY:
+				return _get<float, double>(p_array, p_index, r_value);
+			case Variant::PACKED_FLOAT64_ARRAY:
+				return _get<double, double>(p_array, p_index, r_value);
+			case Variant::PACKED_VECTOR2_ARRAY:
+				return _get<Vector2, Vector2>(p_array, p_index, r_value);
+			case Variant::PACKED_VECTOR3_ARRAY:
+				return _get<Vector3, Vector3>(p_array, p_index, r_value);
+			case Variant::PACKED_COLOR_ARRAY:
+				return _get<Color, Color>(p_array, p_index, r_value);
+			case Variant::PACKED_VECTOR4_ARRAY:
+				return _get<Vector4, Vector4>(p_array, p_index, r_value);
+			default:
+				return false;
+		}
+	}
+
+	static _FORCE_INLINE_ bool set(Variant::Type p_type, Variant *p_array, int64_t p_index, const Variant *p_value) {
+		switch (p_type) {
+			case Variant::PACKED_BYTE_ARRAY:
+				return _set<uint8_t, int64_t>(p_array, p_index, p_value);
+			case Variant::PACKED_INT32_ARRAY:
+				return _set<int32_t, int64_t>(p_array, p_index, p_value);
+			case Variant::PACKED_INT64_ARRAY:
+				return _set<int64_t, int64_t>(p_array, p_index, p_value);
+			case Variant::PACKED_FLOAT32_ARRAY:
+				return _set<float, double>(p_array, p_index, p_value);
+			case Variant::PACKED_FLOAT64_ARRAY:
+				return _set<double, double>(p_array, p_index, p_value);
+			case Variant::PACKED_VECTOR2_ARRAY:
+				return _set<Vector2, Vector2>(p_array, p_index, p_value);
+			case Variant::PACKED_VECTOR3_ARRAY:
+				return _set<Vector3, Vector3>(p_array, p_index, p_value);
+			case Variant::PACKED_COLOR_ARRAY:
+				return _set<Color, Color>(p_array, p_index, p_value);
+			case Variant::PACKED_VECTOR4_ARRAY:
+				return _set<Vector4, Vector4>(p_array, p_index, p_value);
+			default:
+				return false;
+		}
+	}
+};
+
+#endif // GDSCRIPT_PACKED_ARRAY_H
@@ -762,6 +762,48 @@ const HashMap<String, Ref<GDScriptParserRef>> &GDScriptParser::get_depended_pars
 	return depended_parsers;
 }
 
+Vector<String> GDScriptParser::_get_script_paths(const LocalVector<String> &p_paths, const HashSet<StringName> &p_names) const {
+	HashSet<String> paths;
+
+	for (const String &E : p_paths) {
+		// Resolved like the analyzer does for `extends` and `preload()`.
+		String path = E;
+		if (path.is_relative_path()) {
+			path = script_path.get_base_dir().path_join(path);
+		}
+		paths.insert(path.simplify_path());
+	}
+
+	for (const StringName &E : p_names) {
+		if (ScriptServer::is_global_class(E)) {
+			paths.insert(ScriptServer::get_global_class_path(E));
+		}
+	}
+
+	Vector<String> result;
+	for (const String &E : paths) {
+		if (E != script_path && E.get_extension().to_lower() == "gd") {
+			result.push_back(E);
+		}
+	}
+	return result;
+}
+
+Vector<String> GDScriptParser::get_referenced_script_paths() const {
+	return _get_script_paths(referenced_paths, referenced_names);
+}
+
+Vector<String> GDScriptParser::get_interface_script_paths() const {
+	return _get_script_paths(interface_referenced_paths, interface_referenced_names);
+}
+
+void GDScriptParser::_add_referenced_path(const String &p_path) {
+	referenced_paths.push_back(p_path);
+	if (current_function == nullptr) {
+		interface_referenced_paths.push_back(p_path);
+	}
+}
+
 GDScriptParser::ClassNode *GDScriptParser::find_class(const String &p_qualified_name) const {
 	String first = p_qualified_name.get_slice("::", 0);
 
@@ -887,6 +929,7 @@ void GDScriptParser::parse_extends() {
 			push_error(vformat(R"(Only strings or identifiers can be used after "extends", found "%s" instead.)", Variant::get_type_name(previous.literal.get_type())));
 		}
 		current_class->extends_path = previous.literal;
+		_add_referenced_path(current_class->extends_path);
 
 		if (!match(GDScriptTokenizer::Token::PERIOD)) {
 			return;
@@ -1574,6 +1617,27 @@ void GDScriptParser::parse_function_signature(FunctionNode *p_function, SuiteNod
 		current_class->has_static_data = true;
 	}
 
+	if (!p_function->source_lambda) {
+		// Only the types are needed to resolve the signature, default values are analyzed with the body.
+		auto add_type_names = [this](const TypeNode *p_type) {
+			if (p_type == nullptr) {
+				return;
+			}
+			if (!p_type->type_chain.is_empty()) {
+				interface_referenced_names.insert(p_type->type_chain[0]->name);
+			}
+			for (const TypeNode *container_type : p_type->container_types) {
+				if (!container_type->type_chain.is_empty()) {
+					interface_referenced_names.insert(container_type->type_chain[0]->name);
+				}
+			}
+		};
+		for (const ParameterNode *parameter : p_function->parameters) {
+			add_type_names(parameter->datatype_specifier);
+		}
+		add_type_names(p_function->return_type);
+	}
+
 	// TODO: Improve token consumption so it synchronizes to a statement boundary. This way we can get into the function body with unrecognized tokens.
 	consume(GDScriptTokenizer::Token::COLON, vformat(R"(Expected ":" after %s declaration.)", p_type));
 }
@@ -2555,6 +2619,10 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_identifier(ExpressionNode
 	if (identifier->name.operator String().is_empty()) {
 		print_line("Empty identifier found.");
 	}
+	referenced_names.insert(identifier->name);
+	if (current_function == nullptr) {
+		interface_referenced_names.insert(identifier->name);
+	}
 	identifier->suite = current_suite;
 
 	if (current_suite != nullptr && current_suite->has_local(identifier->name)) {
@@ -3397,6 +3465,8 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_preload(ExpressionNode *p_
 
 	if (preload->path == nullptr) {
 		push_error(R"(Expected resource path after "(".)");
+	} else if (preload->path->type == Node::LITERAL && static_cast<LiteralNode *>(preload->path)->value.get_type() == Variant::STRING) {
+		_add_referenced_path(static_cast<LiteralNode *>(preload->path)->value);
 	}
 
 	pop_completion_call();
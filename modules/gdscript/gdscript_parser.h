@@ -44,7 +44,9 @@
 #include "core/string/string_name.h"
 #include "core/string/ustring.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/vector.h"
 #include "core/variant/variant.h"
@@ -1326,6 +1328,7 @@ public:
 
 private:
 	friend class GDScriptAnalyzer;
+	friend class GDScriptCache;
 	friend class GDScriptParserRef;
 
 	bool _is_tool = false;
@@ -1338,6 +1341,17 @@ private:
 	List<bool> multiline_stack;
 	HashMap<String, Ref<GDScriptParserRef>> depended_parsers;
 
+	Vector<String> _get_script_paths(const LocalVector<String> &p_paths, const HashSet<StringName> &p_names) const;
+	void _add_referenced_path(const String &p_path);
+
+	// Paths and names the script refers to at parse time, so the scripts it depends on
+	// can be parsed before the analysis needs them. Names may include locals and members.
+	// The interface ones are referred to outside of function bodies, or in function signatures.
+	LocalVector<String> referenced_paths;
+	HashSet<StringName> referenced_names;
+	LocalVector<String> interface_referenced_paths;
+	HashSet<StringName> interface_referenced_names;
+
 	ClassNode *head = nullptr;
 	Node *list = nullptr;
 	List<ParserError> errors;
@@ -1589,6 +1603,12 @@ public:
 		// TODO: Keep track of deps.
 		return List<String>();
 	}
+	// Returns the scripts that are likely needed to analyze this one: paths used by `extends` and
+	// `preload()`, and global classes referenced by name. Doesn't include the script itself.
+	Vector<String> get_referenced_script_paths() const;
+	// Same as `get_referenced_script_paths()`, limited to what is needed to resolve the interface
+	// of this script: its base, constants, member and signal types, and function signatures.
+	Vector<String> get_interface_script_paths() const;
 #ifdef DEBUG_ENABLED
 	const List<GDScriptWarning> &get_warnings() const { return warnings; }
 	const HashSet<int> &get_unsafe_lines() const { return unsafe_lines; }
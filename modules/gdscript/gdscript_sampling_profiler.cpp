@@ -0,0 +1,335 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#include "gdscript_function.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+GDScriptSamplingProfiler *GDScriptSamplingProfiler::singleton = nullptr;
+
+SafeFlag GDScriptSamplingProfiler::active;
+thread_local GDScriptSamplingProfiler::ThreadRecord *GDScriptSamplingProfiler::thread_record = nullptr;
+thread_local GDScriptSamplingProfiler::ThreadRecordOwner GDScriptSamplingProfiler::thread_record_owner;
+
+Mutex GDScriptSamplingProfiler::records_mutex;
+LocalVector<GDScriptSamplingProfiler::ThreadRecord *> GDScriptSamplingProfiler::records;
+
+Mutex GDScriptSamplingProfiler::symbols_mutex;
+LocalVector<GDScriptSamplingProfiler::Symbol> GDScriptSamplingProfiler::symbols;
+// Ids start at 1, so 0 means the function was never registered.
+std::atomic<uint32_t> GDScriptSamplingProfiler::first_symbol_id = { 1 };
+uint32_t GDScriptSamplingProfiler::next_symbol_id = 1;
+
+GDScriptSamplingProfiler::ThreadRecordOwner::~ThreadRecordOwner() {
+	if (!record) {
+		return;
+	}
+	MutexLock lock(records_mutex);
+	records.erase(record);
+	memdelete(record);
+	record = nullptr;
+	thread_record = nullptr;
+}
+
+bool GDScriptSamplingProfiler::StackKey::operator==(const StackKey &p_other) const {
+	if (hash != p_other.hash || frames.size() != p_other.frames.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < frames.size(); i++) {
+		if (frames[i] != p_other.frames[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32_t GDScriptSamplingProfiler::_register_function(const GDScriptFunction *p_function) {
+	MutexLock lock(symbols_mutex);
+
+	// Another thread may have registered it while waiting for the lock.
+	uint32_t id = p_function->_sampling_id.load(std::memory_order_relaxed);
+	if (id >= first_symbol_id.load(std::memory_order_relaxed)) {
+		return id;
+	}
+
+	Symbol symbol;
+	symbol.function = String(p_function->get_name()).replace(";", "_");
+	symbol.source = String(p_function->get_source()).replace(";", "_");
+	symbol.initial_line = p_function->_initial_line;
+	symbols.push_back(symbol);
+
+	id = next_symbol_id++;
+	p_function->_sampling_id.store(id, std::memory_order_relaxed);
+	return id;
+}
+
+void GDScriptSamplingProfiler::_reset_symbols() {
+	MutexLock lock(symbols_mutex);
+	symbols.reset();
+	first_symbol_id.store(next_symbol_id, std::memory_order_relaxed);
+}
+
+void GDScriptSamplingProfiler::_compact_symbols() {
+	MutexLock data_lock(data_mutex);
+	MutexLock symbols_lock(symbols_mutex);
+
+	// Moves the symbols still referred to by a stack to a new range of ids. Functions
+	// registered before aren't touched, and register again the next time they run.
+	const uint32_t first = first_symbol_id.load(std::memory_order_relaxed);
+	const uint32_t new_first = next_symbol_id;
+	HashMap<uint32_t, uint32_t> remap;
+	LocalVector<Symbol> kept;
+	HashMap<StackKey, uint64_t, StackKeyHasher> remapped_stacks;
+
+	for (const KeyValue<StackKey, uint64_t> &E : stacks) {
+		StackKey key = E.key;
+		for (uint64_t &frame : key.frames) {
+			const uint32_t id = frame >> 32;
+			uint32_t new_id = 0;
+			if (id >= first && id < next_symbol_id) {
+				HashMap<uint32_t, uint32_t>::Iterator R = remap.find(id);
+				if (R) {
+					new_id = R->value;
+				} else {
+					new_id = new_first + kept.size();
+					kept.push_back(symbols[id - first]);
+					remap.insert(id, new_id);
+				}
+			}
+			frame = ((uint64_t)new_id << 32) | (frame & 0xFFFFFFFF);
+		}
+		key.hash = hash_murmur3_buffer(key.frames.ptr(), key.frames.size() * sizeof(uint64_t));
+		remapped_stacks[key] += E.value;
+	}
+
+	symbols = kept;
+	first_symbol_id.store(new_first, std::memory_order_relaxed);
+	next_symbol_id = new_first + kept.size();
+	stacks = remapped_stacks;
+}
+
+GDScriptSamplingProfiler::ThreadRecord *GDScriptSamplingProfiler::_create_thread_record() {
+	ThreadRecord *record = memnew(ThreadRecord);
+	{
+		MutexLock lock(records_mutex);
+		records.push_back(record);
+	}
+	thread_record_owner.record = record;
+	thread_record = record;
+	return record;
+}
+
+bool GDScriptSamplingProfiler::_enter(const GDScriptFunction *p_function, int p_line) {
+	ThreadRecord *record = thread_record;
+	if (unlikely(!record)) {
+		record = _create_thread_record();
+	}
+
+	uint32_t id = p_function->_sampling_id.load(std::memory_order_relaxed);
+	if (unlikely(id < first_symbol_id.load(std::memory_order_relaxed))) {
+		id = _register_function(p_function);
+	}
+
+	// Deeper frames are still counted, so returning from them keeps the depth right,
+	// but only the outermost ones are recorded.
+	const uint32_t depth = record->depth.load(std::memory_order_relaxed);
+	if (likely(depth < MAX_RECORDED_DEPTH)) {
+		record->frames[depth].function_id.store(id, std::memory_order_relaxed);
+		record->frames[depth].line.store(p_line, std::memory_order_relaxed);
+	}
+	record->depth.store(depth + 1, std::memory_order_release);
+	return true;
+}
+
+void GDScriptSamplingProfiler::_thread_func(void *p_user) {
+	GDScriptSamplingProfiler *profiler = static_cast<GDScriptSamplingProfiler *>(p_user);
+	Thread::set_name("GDScript Sampling Profiler");
+
+	StackKey key;
+	while (!profiler->exit_thread.is_set()) {
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+		profiler->_take_sample(key);
+	}
+}
+
+void GDScriptSamplingProfiler::_take_sample(StackKey &r_key) {
+	MutexLock records_lock(records_mutex);
+
+	for (ThreadRecord *record : records) {
+		const uint32_t depth = MIN(record->depth.load(std::memory_order_acquire), (uint32_t)MAX_RECORDED_DEPTH);
+		if (depth == 0) {
+			// Not running script code.
+			continue;
+		}
+
+		// The thread keeps running while it is read, so the copy may mix two stacks that
+		// share the same base. That's rare enough to not matter statistically.
+		r_key.frames.resize(depth);
+		for (uint32_t i = 0; i < depth; i++) {
+			const uint64_t id = record->frames[i].function_id.load(std::memory_order_relaxed);
+			const int line = record->frames[i].line.load(std::memory_order_relaxed);
+			r_key.frames[i] = (id << 32) | (uint32_t)line;
+		}
+		r_key.hash = hash_murmur3_buffer(r_key.frames.ptr(), depth * sizeof(uint64_t));
+
+		MutexLock data_lock(data_mutex);
+		HashMap<StackKey, uint64_t, StackKeyHasher>::Iterator E = stacks.find(r_key);
+		if (E) {
+			E->value++;
+		} else {
+			stacks.insert(r_key, 1);
+		}
+		sample_count++;
+	}
+}
+
+String GDScriptSamplingProfiler::_get_frame_name(uint64_t p_frame, bool p_include_lines) const {
+	const uint32_t id = p_frame >> 32;
+	const uint32_t first = first_symbol_id.load(std::memory_order_relaxed);
+	if (id < first || id - first >= symbols.size()) {
+		return "<unknown>";
+	}
+
+	const Symbol &symbol = symbols[id - first];
+	const int line = p_include_lines ? (int)(uint32_t)(p_frame & 0xFFFFFFFF) : symbol.initial_line;
+	return vformat("%s (%s:%d)", symbol.function, symbol.source, line);
+}
+
+void GDScriptSamplingProfiler::start(int p_interval_usec) {
+	ERR_FAIL_COND_MSG(p_interval_usec <= 0, "The sampling interval must be greater than zero.");
+	if (thread.is_started()) {
+		stop();
+	}
+
+	interval_usec = p_interval_usec;
+	exit_thread.clear();
+	active.set();
+	thread.start(_thread_func, this);
+}
+
+void GDScriptSamplingProfiler::stop() {
+	if (!thread.is_started()) {
+		return;
+	}
+
+	// Threads keep popping the functions they entered while active, so their records stay valid.
+	active.clear();
+	exit_thread.set();
+	thread.wait_to_finish();
+
+	_compact_symbols();
+}
+
+bool GDScriptSamplingProfiler::is_running() const {
+	return thread.is_started();
+}
+
+void GDScriptSamplingProfiler::clear() {
+	{
+		MutexLock lock(data_mutex);
+		stacks.clear();
+		sample_count = 0;
+	}
+	if (!thread.is_started()) {
+		_reset_symbols();
+	}
+}
+
+uint64_t GDScriptSamplingProfiler::get_sample_count() {
+	MutexLock lock(data_mutex);
+	return sample_count;
+}
+
+String GDScriptSamplingProfiler::get_collapsed_stacks(bool p_include_lines) {
+	// Without lines, different lines of the same stack are merged together.
+	HashMap<String, uint64_t> collapsed;
+	{
+		MutexLock data_lock(data_mutex);
+		MutexLock symbols_lock(symbols_mutex);
+
+		for (const KeyValue<StackKey, uint64_t> &E : stacks) {
+			String stack;
+			for (uint32_t i = 0; i < E.key.frames.size(); i++) {
+				if (i > 0) {
+					stack += ";";
+				}
+				stack += _get_frame_name(E.key.frames[i], p_include_lines);
+			}
+			collapsed[stack] += E.value;
+		}
+	}
+
+	Vector<String> lines;
+	lines.resize(collapsed.size());
+	int index = 0;
+	for (const KeyValue<String, uint64_t> &E : collapsed) {
+		lines.write[index++] = E.key + " " + itos(E.value);
+	}
+	lines.sort();
+
+	String result;
+	for (const String &line : lines) {
+		result += line + "\n";
+	}
+	return result;
+}
+
+Error GDScriptSamplingProfiler::save_collapsed_stacks(const String &p_path, bool p_include_lines) {
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat(R"(Cannot open "%s" to save the sampled call stacks.)", p_path));
+
+	file->store_string(get_collapsed_stacks(p_include_lines));
+	return OK;
+}
+
+void GDScriptSamplingProfiler::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("start", "interval_usec"), &GDScriptSamplingProfiler::start, DEFVAL(1000));
+	ClassDB::bind_method(D_METHOD("stop"), &GDScriptSamplingProfiler::stop);
+	ClassDB::bind_method(D_METHOD("is_running"), &GDScriptSamplingProfiler::is_running);
+	ClassDB::bind_method(D_METHOD("clear"), &GDScriptSamplingProfiler::clear);
+	ClassDB::bind_method(D_METHOD("get_sample_count"), &GDScriptSamplingProfiler::get_sample_count);
+	ClassDB::bind_method(D_METHOD("get_collapsed_stacks", "include_lines"), &GDScriptSamplingProfiler::get_collapsed_stacks, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("save_collapsed_stacks", "path", "include_lines"), &GDScriptSamplingProfiler::save_collapsed_stacks, DEFVAL(false));
+}
+
+GDScriptSamplingProfiler::GDScriptSamplingProfiler() {
+	singleton = this;
+}
+
+GDScriptSamplingProfiler::~GDScriptSamplingProfiler() {
+	stop();
+	if (singleton == this) {
+		singleton = nullptr;
+	}
+}
@@ -0,0 +1,177 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#include "core/object/class_db.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+#include <atomic>
+
+class GDScriptFunction;
+
+// Statistical profiler for GDScript, cheap enough to keep running on live builds.
+//
+// Every thread running script code owns a call stack record that the VM updates on
+// function entry and exit, and on each new line of a recorded function, with plain
+// atomic stores, without locking. A sampler thread
+// wakes up at a fixed interval, copies the records of all threads and counts how
+// often each call stack was seen. The result is exported in the collapsed stack
+// format read by flame graph tools (`frame;frame;frame count` per line).
+//
+// Functions are referred to by a numeric id assigned the first time they run while
+// the profiler is active, so the sampler never dereferences a function that may have
+// been freed by a script reload in the meantime. Ids keep increasing across sessions:
+// stopping the profiler keeps only the symbols the recorded stacks refer to, under new
+// ids, and clearing it drops them all, so functions holding an older id register again.
+class GDScriptSamplingProfiler : public Object {
+	GDCLASS(GDScriptSamplingProfiler, Object);
+
+public:
+	static constexpr int MAX_RECORDED_DEPTH = 128;
+
+private:
+	struct Frame {
+		std::atomic<uint32_t> function_id = { 0 };
+		std::atomic<int> line = { 0 };
+	};
+
+	// Written only by its own thread. Frames above `depth` may be stale.
+	struct ThreadRecord {
+		std::atomic<uint32_t> depth = { 0 };
+		Frame frames[MAX_RECORDED_DEPTH];
+	};
+
+	struct ThreadRecordOwner {
+		ThreadRecord *record = nullptr;
+		~ThreadRecordOwner();
+	};
+
+	struct Symbol {
+		String function;
+		String source;
+		int initial_line = 0;
+	};
+
+	struct StackKey {
+		// Function id in the upper half, line in the lower half, from root to leaf.
+		LocalVector<uint64_t> frames;
+		uint32_t hash = 0;
+
+		bool operator==(const StackKey &p_other) const;
+	};
+
+	struct StackKeyHasher {
+		static _FORCE_INLINE_ uint32_t hash(const StackKey &p_key) { return p_key.hash; }
+	};
+
+	static GDScriptSamplingProfiler *singleton;
+
+	static SafeFlag active;
+	static thread_local ThreadRecord *thread_record;
+	static thread_local ThreadRecordOwner thread_record_owner;
+
+	// Guards the list of thread records. Held by the sampler while it reads them, and by
+	// threads registering or releasing their record.
+	static Mutex records_mutex;
+	static LocalVector<ThreadRecord *> records;
+
+	// `symbols[i]` describes the function with id `first_symbol_id + i`.
+	static Mutex symbols_mutex;
+	static LocalVector<Symbol> symbols;
+	static std::atomic<uint32_t> first_symbol_id;
+	static uint32_t next_symbol_id;
+
+	Thread thread;
+	SafeFlag exit_thread;
+	uint32_t interval_usec = 1000;
+
+	Mutex data_mutex;
+	HashMap<StackKey, uint64_t, StackKeyHasher> stacks;
+	uint64_t sample_count = 0;
+
+	static uint32_t _register_function(const GDScriptFunction *p_function);
+	static ThreadRecord *_create_thread_record();
+	static bool _enter(const GDScriptFunction *p_function, int p_line);
+	static void _reset_symbols();
+	void _compact_symbols();
+
+	static void _thread_func(void *p_user);
+	void _take_sample(StackKey &r_key);
+
+	String _get_frame_name(uint64_t p_frame, bool p_include_lines) const;
+
+protected:
+	static void _bind_methods();
+
+public:
+	static GDScriptSamplingProfiler *get_singleton() { return singleton; }
+
+	// Called by the VM when a function starts running. Returns `true` if the function was
+	// pushed to the call stack record, in which case `exit()` must be called when it returns.
+	_FORCE_INLINE_ static bool enter(const GDScriptFunction *p_function, int p_line) {
+		if (likely(!active.is_set())) {
+			return false;
+		}
+		return _enter(p_function, p_line);
+	}
+
+	// Called by the VM when a function for which `enter()` returned `true` reaches a new line.
+	_FORCE_INLINE_ static void set_line(int p_line) {
+		const uint32_t depth = thread_record->depth.load(std::memory_order_relaxed);
+		if (likely(depth <= MAX_RECORDED_DEPTH)) {
+			thread_record->frames[depth - 1].line.store(p_line, std::memory_order_relaxed);
+		}
+	}
+
+	_FORCE_INLINE_ static void exit() {
+		thread_record->depth.store(thread_record->depth.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+	}
+
+	void start(int p_interval_usec = 1000);
+	void stop();
+	bool is_running() const;
+
+	void clear();
+	uint64_t get_sample_count();
+
+	String get_collapsed_stacks(bool p_include_lines = false);
+	Error save_collapsed_stacks(const String &p_path, bool p_include_lines = false);
+
+	GDScriptSamplingProfiler();
+	~GDScriptSamplingProfiler();
+};
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
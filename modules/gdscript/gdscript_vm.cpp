@@ -29,10 +29,13 @@
 /**************************************************************************/
 
 #include "gdscript.h"
+#include "gdscript_aot.h"
 #include "gdscript_function.h"
 #include "gdscript_lambda_callable.h"
+#include "gdscript_sampling_profiler.h"
 
 #include "core/os/os.h"
+#include "scene/scene_string_names.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -227,6 +230,229 @@ void (*type_init_function_table[])(Variant *) = {
 	&VariantInitializer<PackedVector4Array>::init, // PACKED_VECTOR4_ARRAY.
 };
 
+// Returns what inline caches are keyed by for the given receiver: the builtin type, the GDScript
+// of an instance or the native class of any other object. Receivers that can't be cached (null
+// objects, other script languages, placeholders) return `nullptr`.
+const void *GDScriptFunction::_get_inline_cache_key(const Variant *p_base, Object *&r_object, GDScriptInstance *&r_instance) {
+	r_object = nullptr;
+	r_instance = nullptr;
+	if (p_base->get_type() != Variant::OBJECT) {
+		return (const void *)(uintptr_t(p_base->get_type()) + 1);
+	}
+	r_object = p_base->get_validated_object();
+	if (unlikely(!r_object)) {
+		return nullptr;
+	}
+	ScriptInstance *si = r_object->get_script_instance();
+	if (!si) {
+		return &r_object->get_class_name();
+	}
+	if (si->get_language() != GDScriptLanguage::get_singleton() || si->is_placeholder()) {
+		return nullptr;
+	}
+	r_instance = static_cast<GDScriptInstance *>(si);
+	return r_instance->script.ptr();
+}
+
+bool GDScriptFunction::_get_named_cached(InlineCache &p_cache, const Variant *p_src, const StringName &p_name, Variant *p_dst) {
+	Object *obj;
+	GDScriptInstance *instance;
+	const void *key = _get_inline_cache_key(p_src, obj, instance);
+	if (unlikely(!key)) {
+		return false;
+	}
+
+	const uint32_t epoch = inline_cache_epoch.get();
+	InlineCache::Kind kind;
+	uintptr_t data;
+	uintptr_t aux;
+	if (!p_cache.lookup(key, epoch, kind, data, aux)) {
+		kind = InlineCache::KIND_NONE;
+		data = 0;
+		aux = 0;
+		if (!obj) {
+			Variant::ValidatedGetter getter = Variant::get_member_validated_getter(p_src->get_type(), p_name);
+			if (getter) {
+				kind = InlineCache::KIND_BUILTIN_GETTER;
+				data = uintptr_t(getter);
+				aux = Variant::get_member_type(p_src->get_type(), p_name);
+			}
+		} else if (instance) {
+			HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = instance->script->member_indices.find(p_name);
+			if (E && !E->value.getter) {
+				kind = InlineCache::KIND_MEMBER;
+				data = E->value.index;
+			}
+		}
+		// Native properties go through `_get()` overrides first, so they are always looked up.
+		p_cache.store(key, epoch, kind, data, aux);
+	}
+
+	switch (kind) {
+		case InlineCache::KIND_BUILTIN_GETTER: {
+			Variant::ValidatedGetter getter = Variant::ValidatedGetter(data);
+			if (p_dst != p_src && p_dst->get_type() == Variant::Type(aux)) {
+				getter(p_src, p_dst);
+			} else {
+				Variant ret;
+				type_init_function_table[aux](&ret);
+				getter(p_src, &ret);
+				*p_dst = ret;
+			}
+			return true;
+		}
+		case InlineCache::KIND_MEMBER: {
+			if (unlikely(data >= uintptr_t(instance->members.size()))) {
+				return false;
+			}
+			*p_dst = instance->members[data];
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+bool GDScriptFunction::_set_named_cached(InlineCache &p_cache, Variant *p_dst, const StringName &p_name, const Variant *p_value) {
+	Object *obj;
+	GDScriptInstance *instance;
+	const void *key = _get_inline_cache_key(p_dst, obj, instance);
+	if (unlikely(!key)) {
+		return false;
+	}
+
+	const uint32_t epoch = inline_cache_epoch.get();
+	InlineCache::Kind kind;
+	uintptr_t data;
+	uintptr_t aux;
+	if (!p_cache.lookup(key, epoch, kind, data, aux)) {
+		kind = InlineCache::KIND_NONE;
+		data = 0;
+		aux = 0;
+		if (!obj) {
+			Variant::ValidatedSetter setter = Variant::get_member_validated_setter(p_dst->get_type(), p_name);
+			if (setter) {
+				kind = InlineCache::KIND_BUILTIN_SETTER;
+				data = uintptr_t(setter);
+				aux = Variant::get_member_type(p_dst->get_type(), p_name);
+			}
+		}
+#ifndef TOOLS_ENABLED
+		// Object::set() flags the object as edited in tools builds, that has to go the long way.
+		else if (instance) {
+			HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = instance->script->member_indices.find(p_name);
+			if (E && !E->value.setter) {
+				kind = InlineCache::KIND_MEMBER;
+				data = E->value.index;
+				aux = uintptr_t(&E->value.data_type);
+			}
+		}
+#endif
+		p_cache.store(key, epoch, kind, data, aux);
+	}
+
+	switch (kind) {
+		case InlineCache::KIND_BUILTIN_SETTER: {
+			if (p_value->get_type() != Variant::Type(aux)) {
+				return false; // Let the generic setter convert or fail.
+			}
+			Variant::ValidatedSetter setter = Variant::ValidatedSetter(data);
+			setter(p_dst, p_value);
+			return true;
+		}
+		case InlineCache::KIND_MEMBER: {
+			const GDScriptDataType *data_type = (const GDScriptDataType *)aux;
+			if (unlikely(data >= uintptr_t(instance->members.size())) || (data_type->has_type && !data_type->is_type(*p_value))) {
+				return false;
+			}
+			instance->members.write[data] = *p_value;
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+bool GDScriptFunction::_call_named_cached(InlineCache &p_cache, Variant *p_base, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	Object *obj;
+	GDScriptInstance *instance;
+	const void *key = _get_inline_cache_key(p_base, obj, instance);
+	if (!obj) {
+		return false; // Builtin methods and null instances take the generic path.
+	}
+	if (unlikely(!key)) {
+		return false;
+	}
+
+	const uint32_t epoch = inline_cache_epoch.get();
+	InlineCache::Kind kind;
+	uintptr_t data;
+	uintptr_t aux;
+	if (p_cache.lookup(key, epoch, kind, data, aux)) {
+		switch (kind) {
+			case InlineCache::KIND_SCRIPT_FUNCTION: {
+				r_err.error = Callable::CallError::CALL_OK;
+				r_ret = ((GDScriptFunction *)data)->call(instance, p_args, p_argcount, r_err);
+				return true;
+			}
+			case InlineCache::KIND_METHOD_BIND: {
+				if ((const StringName *)aux != &obj->get_class_name()) {
+					return false; // A script attached to an object of a derived class.
+				}
+				r_err.error = Callable::CallError::CALL_OK;
+				r_ret = ((MethodBind *)data)->call(obj, p_args, p_argcount, r_err);
+				return true;
+			}
+			default:
+				return false;
+		}
+	}
+
+	// Object::callp() gives these special treatment.
+	if (p_name == CoreStringName(free_) || p_name == SceneStringName(_ready)) {
+		p_cache.store(key, epoch, InlineCache::KIND_NONE, 0, 0);
+		return false;
+	}
+
+	kind = InlineCache::KIND_NONE;
+	data = 0;
+	if (instance) {
+		for (GDScript *sptr = instance->script.ptr(); sptr; sptr = sptr->_base) {
+			if (!sptr->valid) {
+				continue;
+			}
+			HashMap<StringName, GDScriptFunction *>::Iterator E = sptr->member_functions.find(p_name);
+			if (E) {
+				kind = InlineCache::KIND_SCRIPT_FUNCTION;
+				data = uintptr_t(E->value);
+				break;
+			}
+		}
+	}
+	if (kind == InlineCache::KIND_NONE) {
+		MethodBind *method = ClassDB::get_method_cached(obj->get_class_name(), p_name);
+		if (method) {
+			kind = InlineCache::KIND_METHOD_BIND;
+			data = uintptr_t(method);
+		}
+	}
+	if (kind == InlineCache::KIND_NONE) {
+		p_cache.store(key, epoch, kind, 0, 0);
+		return false;
+	}
+
+	r_err.error = Callable::CallError::CALL_OK;
+	if (kind == InlineCache::KIND_SCRIPT_FUNCTION) {
+		r_ret = ((GDScriptFunction *)data)->call(instance, p_args, p_argcount, r_err);
+	} else {
+		r_ret = ((MethodBind *)data)->call(obj, p_args, p_argcount, r_err);
+	}
+	if (r_err.error == Callable::CallError::CALL_OK) {
+		p_cache.store(key, epoch, kind, data, uintptr_t(&obj->get_class_name()));
+	}
+	return true;
+}
+
 #if defined(__GNUC__) || defined(__clang__)
 #define OPCODES_TABLE                                    \
 	static const void *switch_table_ops[] = {            \
@@ -240,9 +466,11 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_SET_KEYED,                              \
 		&&OPCODE_SET_KEYED_VALIDATED,                    \
 		&&OPCODE_SET_INDEXED_VALIDATED,                  \
+		&&OPCODE_SET_INDEXED_PACKED,                     \
 		&&OPCODE_GET_KEYED,                              \
 		&&OPCODE_GET_KEYED_VALIDATED,                    \
 		&&OPCODE_GET_INDEXED_VALIDATED,                  \
+		&&OPCODE_GET_INDEXED_PACKED,                     \
 		&&OPCODE_SET_NAMED,                              \
 		&&OPCODE_SET_NAMED_VALIDATED,                    \
 		&&OPCODE_GET_NAMED,                              \
@@ -292,6 +520,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_JUMP,                                   \
 		&&OPCODE_JUMP_IF,                                \
 		&&OPCODE_JUMP_IF_NOT,                            \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,         \
 		&&OPCODE_JUMP_TO_DEF_ARGUMENT,                   \
 		&&OPCODE_JUMP_IF_SHARED,                         \
 		&&OPCODE_RETURN,                                 \
@@ -520,11 +749,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 	if (p_state) {
 		//use existing (supplied) state (awaited)
-		stack = (Variant *)p_state->stack.ptr();
-		instruction_args = (Variant **)&p_state->stack.ptr()[sizeof(Variant) * p_state->stack_size]; //ptr() to avoid bounds check
+		stack = (Variant *)p_state->stack;
+		instruction_args = (Variant **)&p_state->stack[sizeof(Variant) * p_state->stack_size];
 		line = p_state->line;
 		ip = p_state->ip;
-		alloca_size = p_state->stack.size();
+		alloca_size = p_state->alloca_size;
 		script = p_state->script;
 		p_instance = p_state->instance;
 		defarg = p_state->defarg;
@@ -621,7 +850,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	memnew_placement(&stack[ADDR_STACK_CLASS], Variant(script));
 	memnew_placement(&stack[ADDR_STACK_NIL], Variant);
 
+	const bool sampled = GDScriptSamplingProfiler::enter(this, line);
+
 	String err_text;
+	bool frame_moved = false; // Set when the frame was moved to a function state by `await`.
 
 #ifdef DEBUG_ENABLED
 
@@ -706,6 +938,25 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 	Variant *variant_addresses[ADDR_TYPE_MAX] = { stack, _constants_ptr, p_instance ? p_instance->members.ptrw() : nullptr };
 
+	bool run_aot = _aot_function && !p_state;
+#ifdef DEBUG_ENABLED
+	// Translated functions neither stop at breakpoints nor time native calls.
+	run_aot = run_aot && !EngineDebugger::is_active() && !GDScriptLanguage::get_singleton()->profiling;
+#endif
+	if (run_aot) {
+		GDScriptAOTFrame frame;
+		frame.function = this;
+		frame.stack = stack;
+		frame.members = variant_addresses[ADDR_TYPE_MEMBER];
+		frame.retvalue = &retvalue;
+		frame.defarg = defarg;
+#ifdef DEBUG_ENABLED
+		frame.line = &line;
+#endif
+		// Resumes at the end of the function, or at the instruction that needs the VM to report an error.
+		ip = _aot_function(frame);
+	}
+
 #ifdef DEBUG_ENABLED
 	OPCODE_WHILE(ip < _code_size) {
 		int last_opcode = _code_ptr[ip];
@@ -1057,6 +1308,28 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_SET_INDEXED_PACKED) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(dst, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(value, 2);
+
+				Variant::Type array_type = (Variant::Type)_code_ptr[ip + 4];
+				GD_ERR_BREAK(!GDScriptPackedArray::is_supported(array_type));
+
+#ifdef DEBUG_ENABLED
+				if (!GDScriptPackedArray::set(array_type, dst, *VariantInternal::get_int(index), value)) {
+					err_text = "Out of bounds set index '" + index->operator String() + "' (on base: '" + _get_var_type(dst) + "')";
+					OPCODE_BREAK;
+				}
+#else
+				GDScriptPackedArray::set(array_type, dst, *VariantInternal::get_int(index), value);
+#endif
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_GET_KEYED) {
 				CHECK_SPACE(3);
 
@@ -1161,8 +1434,30 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_GET_INDEXED_PACKED) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(src, 0);
+				GET_VARIANT_PTR(index, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				Variant::Type array_type = (Variant::Type)_code_ptr[ip + 4];
+				GD_ERR_BREAK(!GDScriptPackedArray::is_supported(array_type));
+
+#ifdef DEBUG_ENABLED
+				if (!GDScriptPackedArray::get(array_type, src, *VariantInternal::get_int(index), dst)) {
+					err_text = "Out of bounds get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "')";
+					OPCODE_BREAK;
+				}
+#else
+				GDScriptPackedArray::get(array_type, src, *VariantInternal::get_int(index), dst);
+#endif
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1172,8 +1467,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-				dst->set_named(*index, *value, valid);
+				int indexcache = _code_ptr[ip + 4];
+				GD_ERR_BREAK(indexcache < 0 || indexcache >= _inline_caches_count);
+
+				bool valid = _set_named_cached(_inline_caches_ptr[indexcache], dst, *index, value);
+				if (!valid) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1194,7 +1494,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1214,7 +1514,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1224,6 +1524,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int indexcache = _code_ptr[ip + 4];
+				GD_ERR_BREAK(indexcache < 0 || indexcache >= _inline_caches_count);
+
+				if (_get_named_cached(_inline_caches_ptr[indexcache], src, *index, dst)) {
+					ip += 5;
+					DISPATCH_OPCODE;
+				}
+
 				bool valid;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
@@ -1239,7 +1547,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 				*dst = ret;
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1858,7 +2166,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1885,15 +2193,24 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				Variant temp_ret;
 				Callable::CallError err;
+				bool cached = false;
+#ifndef DEBUG_ENABLED
+				// Object::callp() also takes the debug lock in debug builds, so only release builds skip it.
+				int indexcache = _code_ptr[ip + 3];
+				GD_ERR_BREAK(indexcache < 0 || indexcache >= _inline_caches_count);
+				cached = _call_named_cached(_inline_caches_ptr[indexcache], base, *methodname, (const Variant **)argptrs, argc, temp_ret, err);
+#endif
+				if (!cached) {
+					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+				}
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
 						if (base_type == Variant::OBJECT) {
 							if (base_obj) {
-								MethodBind *method = ClassDB::get_method(base_class, *methodname);
+								MethodBind *method = ClassDB::get_method_cached(base_class, *methodname);
 								if (*methodname == CoreStringName(free_) || (method && !method->has_return())) {
 									err_text = R"(Trying to get a return value of a method that returns "void")";
 									OPCODE_BREAK;
@@ -1916,8 +2233,6 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
-				} else {
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
 				}
 #ifdef DEBUG_ENABLED
 
@@ -1967,7 +2282,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2533,12 +2848,15 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
-
-					// First 3 stack addresses are special, so we just skip them here.
-					for (int i = 3; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
+					// Variants can be relocated with a plain copy, so the frame is moved to the state instead
+					// of copying every value. First 3 stack addresses are special, so we just skip them here.
+					gdfs->state.stack = gdfs->_allocate_frame(alloca_size);
+					memcpy((void *)&gdfs->state.stack[sizeof(Variant) * FIXED_ADDRESSES_MAX], (const void *)&stack[FIXED_ADDRESSES_MAX], sizeof(Variant) * (_stack_size - FIXED_ADDRESSES_MAX));
+					if (p_state) {
+						// The frame of the resumed state doesn't own these values anymore.
+						p_state->stack_size = 0;
 					}
+					frame_moved = true;
 					gdfs->state.stack_size = _stack_size;
 					gdfs->state.alloca_size = alloca_size;
 					gdfs->state.ip = ip + 2;
@@ -2563,7 +2881,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 					retvalue = gdfs;
 
-					Error err = sig.connect(Callable(gdfs.ptr(), "_signal_callback").bind(retvalue), Object::CONNECT_ONE_SHOT);
+					// Every await is a regular one-shot connection, timers included. There is no fast path
+					// calling the state back without a connection: it hid awaiters from the connection list
+					// and resumed them out of connection order.
+					Error err = sig.connect(Callable(memnew(GDScriptFunctionStateCallable(gdfs))), Object::CONNECT_ONE_SHOT);
 					if (err != OK) {
 						err_text = "Error connecting to signal: " + sig.get_name() + " during await.";
 						OPCODE_BREAK;
@@ -2700,6 +3021,29 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				if (!*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_JUMP_TO_DEF_ARGUMENT) {
 				CHECK_SPACE(2);
 				ip = _default_arg_ptr[defarg];
@@ -3778,6 +4122,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				line = _code_ptr[ip + 1];
 				ip += 2;
 
+				if (unlikely(sampled)) {
+					GDScriptSamplingProfiler::set_line(line);
+				}
+
 				if (EngineDebugger::is_active()) {
 					// line
 					bool do_break = false;
@@ -3880,9 +4228,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		}
 #endif
 
-		// Free stack, except reserved addresses.
-		for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
-			stack[i].~Variant();
+		// Free stack, except reserved addresses, unless it was moved to a function state.
+		if (!frame_moved) {
+			for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
+				stack[i].~Variant();
+			}
+			if (p_state) {
+				p_state->stack_size = 0;
+			}
 		}
 #ifdef DEBUG_ENABLED
 	}
@@ -3893,6 +4246,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		stack[i].~Variant();
 	}
 
+	if (sampled) {
+		GDScriptSamplingProfiler::exit();
+	}
+
 	call_depth--;
 
 	return retvalue;
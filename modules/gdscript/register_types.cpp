@@ -32,7 +32,10 @@
 
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_aot.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_utility_functions.h"
@@ -50,6 +53,7 @@
 #include "tests/test_gdscript.h"
 #endif
 
+#include "core/config/engine.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
@@ -60,10 +64,6 @@
 #include "editor/editor_settings.h"
 #include "editor/editor_translation_parser.h"
 #include "editor/export/editor_export.h"
-
-#ifndef GDSCRIPT_NO_LSP
-#include "core/config/engine.h"
-#endif
 #endif // TOOLS_ENABLED
 
 #ifdef TESTS_ENABLED
@@ -74,6 +74,9 @@ GDScriptLanguage *script_language_gd = nullptr;
 Ref<ResourceFormatLoaderGDScript> resource_loader_gd;
 Ref<ResourceFormatSaverGDScript> resource_saver_gd;
 GDScriptCache *gdscript_cache = nullptr;
+GDScriptBytecodeCache *gdscript_bytecode_cache = nullptr;
+GDScriptAOT *gdscript_aot = nullptr;
+GDScriptSamplingProfiler *gdscript_sampling_profiler = nullptr;
 
 #ifdef TOOLS_ENABLED
 
@@ -155,6 +158,16 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 		ResourceSaver::add_resource_format_saver(resource_saver_gd);
 
 		gdscript_cache = memnew(GDScriptCache);
+		gdscript_bytecode_cache = memnew(GDScriptBytecodeCache);
+
+		gdscript_aot = memnew(GDScriptAOT);
+#ifdef GDSCRIPT_AOT_ENABLED
+		register_gdscript_aot_functions();
+#endif
+
+		GDREGISTER_CLASS(GDScriptSamplingProfiler);
+		gdscript_sampling_profiler = memnew(GDScriptSamplingProfiler);
+		Engine::get_singleton()->add_singleton(Engine::Singleton("GDScriptSamplingProfiler", gdscript_sampling_profiler));
 
 		GDScriptUtilityFunctions::register_functions();
 	}
@@ -180,10 +193,25 @@ void uninitialize_gdscript_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SERVERS) {
 		ScriptServer::unregister_language(script_language_gd);
 
+		if (gdscript_sampling_profiler) {
+			Engine::get_singleton()->remove_singleton("GDScriptSamplingProfiler");
+			memdelete(gdscript_sampling_profiler);
+		}
+
 		if (gdscript_cache) {
 			memdelete(gdscript_cache);
 		}
 
+		if (gdscript_bytecode_cache) {
+			gdscript_bytecode_cache->save();
+			memdelete(gdscript_bytecode_cache);
+		}
+
+		if (gdscript_aot) {
+			gdscript_aot->save_generated_code();
+			memdelete(gdscript_aot);
+		}
+
 		if (script_language_gd) {
 			memdelete(script_language_gd);
 		}
@@ -227,9 +255,14 @@ void test_bytecode() {
 	GDScriptTests::test(GDScriptTests::TestType::TEST_BYTECODE);
 }
 
+void test_benchmark() {
+	GDScriptTests::test(GDScriptTests::TestType::TEST_BENCHMARK);
+}
+
 REGISTER_TEST_COMMAND("gdscript-tokenizer", &test_tokenizer);
 REGISTER_TEST_COMMAND("gdscript-tokenizer-buffer", &test_tokenizer_buffer);
 REGISTER_TEST_COMMAND("gdscript-parser", &test_parser);
 REGISTER_TEST_COMMAND("gdscript-compiler", &test_compiler);
 REGISTER_TEST_COMMAND("gdscript-bytecode", &test_bytecode);
+REGISTER_TEST_COMMAND("gdscript-benchmark", &test_benchmark);
 #endif
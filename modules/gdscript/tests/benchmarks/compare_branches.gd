@@ -0,0 +1,27 @@
+# Typed comparisons that decide a branch right after being computed.
+
+static func bench_collatz() -> int:
+	var longest: int = 0
+	var n: int = 1
+	while n < 20000:
+		var value: int = n
+		var steps: int = 0
+		while value != 1:
+			if value % 2 == 0:
+				value = value / 2
+			else:
+				value = value * 3 + 1
+			steps = steps + 1
+		if steps > longest:
+			longest = steps
+		n = n + 1
+	return longest
+
+static func bench_clamp_count() -> int:
+	var inside: int = 0
+	var x: float = -500.0
+	while x < 500.0:
+		if x > -100.0 and x < 100.0:
+			inside = inside + 1
+		x = x + 0.01
+	return inside
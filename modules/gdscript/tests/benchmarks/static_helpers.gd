@@ -0,0 +1,32 @@
+# Small static helpers called through their class in hot loops.
+
+class Math:
+	static func square(x: float) -> float:
+		return x * x
+
+	static func lerp_to(from: float, to: float, weight: float) -> float:
+		return from + (to - from) * weight
+
+	static func is_even(n: int) -> bool:
+		return n % 2 == 0
+
+static func bench_sum_of_squares() -> float:
+	var total: float = 0.0
+	var x: float = 0.0
+	while x < 1000.0:
+		total = total + Math.square(x)
+		x = x + 0.01
+	return total
+
+static func bench_smoothing() -> float:
+	var value: float = 0.0
+	for i in 200000:
+		value = Math.lerp_to(value, float(i % 100), 0.1)
+	return value
+
+static func bench_count_even() -> int:
+	var count: int = 0
+	for i in 200000:
+		if Math.is_even(i):
+			count = count + 1
+	return count
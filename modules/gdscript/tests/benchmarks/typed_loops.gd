@@ -0,0 +1,26 @@
+# Typed arithmetic on locals and parameters inside `while` loops.
+
+static func bench_sum_while() -> int:
+	var sum: int = 0
+	var i: int = 0
+	while i < 1000000:
+		sum = sum + i
+		i = i + 1
+	return sum
+
+static func bench_float_accumulate() -> float:
+	var total: float = 0.0
+	var x: float = 0.0
+	while x < 100000.0:
+		total = total + x * 0.5
+		x = x + 0.25
+	return total
+
+static func bench_vector_steps() -> Vector2:
+	var position := Vector2.ZERO
+	var velocity := Vector2(1.5, -0.5)
+	var i: int = 0
+	while i < 200000:
+		position = position + velocity * 0.016
+		i = i + 1
+	return position
@@ -0,0 +1,57 @@
+# Locals survive awaits, whether the frame fits in the function state or not.
+
+signal step(value)
+
+func small(tag: String) -> String:
+	var first = await step
+	var second = await step
+	return "%s %s %s" % [tag, first, second]
+
+func large() -> int:
+	var v0 := 0
+	var v1 := 1
+	var v2 := 2
+	var v3 := 3
+	var v4 := 4
+	var v5 := 5
+	var v6 := 6
+	var v7 := 7
+	var v8 := 8
+	var v9 := 9
+	var v10 := 10
+	var v11 := 11
+	var v12 := 12
+	var v13 := 13
+	var v14 := 14
+	var v15 := 15
+	var v16 := 16
+	var v17 := 17
+	var v18 := 18
+	var v19 := 19
+	var v20 := 20
+	var v21 := 21
+	var v22 := 22
+	var v23 := 23
+	var v24 := 24
+	var v25 := 25
+	var v26 := 26
+	var v27 := 27
+	var v28 := 28
+	var v29 := 29
+	var received: int = await step
+	v0 += received
+	var again: int = await step
+	v29 += again
+	return v0 + v1 + v2 + v3 + v4 + v5 + v6 + v7 + v8 + v9 + v10 + v11 + v12 + v13 + v14 + v15 + v16 + v17 + v18 + v19 + v20 + v21 + v22 + v23 + v24 + v25 + v26 + v27 + v28 + v29
+
+func chained():
+	print(await small("chained"))
+
+func run_large():
+	print(await large())
+
+func test():
+	chained()
+	run_large()
+	step.emit(1)
+	step.emit(2)
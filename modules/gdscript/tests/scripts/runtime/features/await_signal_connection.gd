@@ -0,0 +1,17 @@
+# Awaiting a signal connects to it like any other listener, so it resumes in connection order.
+
+signal done
+
+func waiter():
+	await done
+	print("awaiter")
+
+func handler():
+	print("handler")
+
+func test():
+	waiter()
+	done.connect(handler)
+	print(done.get_connections().size())
+	done.emit()
+	print(done.get_connections().size())
@@ -0,0 +1,70 @@
+# Operator results written straight into typed locals and parameters,
+# comparisons fused with the following jump, and inlined static functions.
+
+class Math:
+	static func square(x: int) -> int:
+		return x * x
+
+	static func middle(a, b):
+		return (a + b) / 2
+
+	static func sign_of(x: float) -> float:
+		return 1.0 if x > 0.0 else (-1.0 if x < 0.0 else 0.0)
+
+	static func hypot_squared(v: Vector2i) -> int:
+		return v.x * v.x + v.y * v.y
+
+	static func longest(a: String, b: String) -> int:
+		return maxi(a.length(), b.length())
+
+static func twice(x: int) -> int:
+	return x * 2
+
+func count_down(n: int) -> int:
+	var steps: int = 0
+	while n > 0:
+		n = n - 3
+		steps = steps + 1
+	return steps
+
+func test():
+	var sum: int = 0
+	var i: int = 0
+	while i < 10:
+		sum = sum + i
+		i = i + 1
+	print(sum)
+
+	var total: float = 0.0
+	for _j in 5:
+		total = total + 0.5
+		if total > 1.0:
+			total = total - 0.25
+	print(total)
+
+	print(count_down(10))
+
+	var v := Vector2i(1, 2)
+	v = v * 2 + v
+	print(v)
+
+	var flag: bool = false
+	flag = not flag
+	print(flag)
+
+	var text: String = "a"
+	text = text + "b"
+	text = text + text
+	print(text)
+
+	print(Math.square(7))
+	print(Math.square(i) + Math.square(-3))
+	print(Math.middle(3, 8))
+	print(Math.middle(3.0, 8))
+	print(Math.sign_of(-2.5), " ", Math.sign_of(0.0), " ", Math.sign_of(4.0))
+	print(Math.hypot_squared(Vector2i(3, 4)))
+	print(Math.longest("abc", "de"))
+
+	var untyped = 6
+	print(Math.square(untyped))
+	print(twice(21))
@@ -0,0 +1,8 @@
+const A = preload("parallel_dependency_parsing_a.notest.gd")
+const B = preload("./parallel_dependency_parsing_b.notest.gd")
+
+func test():
+	print(A.value())
+	print(B.value())
+	print(A.Shared == B.Shared)
+	print(B.body_value())
@@ -0,0 +1,4 @@
+const Shared = preload("parallel_dependency_parsing_shared.notest.gd")
+
+static func value() -> int:
+	return Shared.BASE + 1
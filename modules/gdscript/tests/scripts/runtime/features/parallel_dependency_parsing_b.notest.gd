@@ -0,0 +1,7 @@
+const Shared = preload("parallel_dependency_parsing_shared.notest.gd")
+
+static func value() -> int:
+	return Shared.BASE + 2
+
+static func body_value() -> int:
+	return preload("parallel_dependency_parsing_body.notest.gd").BASE
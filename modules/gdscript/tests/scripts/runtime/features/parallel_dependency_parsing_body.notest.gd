@@ -0,0 +1,2 @@
+# Only preloaded from a function body, so it is parsed when the analyzer reaches it.
+const BASE = 100
@@ -0,0 +1 @@
+const BASE = 10
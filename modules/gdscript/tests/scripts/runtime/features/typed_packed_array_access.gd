@@ -0,0 +1,40 @@
+func test():
+	var floats := PackedFloat32Array([1.0, 2.0, 3.0, 4.0, 5.0])
+	var sum := 0.0
+	for i in floats.size():
+		floats[i] = floats[i] * 2.0
+		sum += floats[i]
+	print(sum)
+	print(floats[-1])
+	floats[-2] = 0.5
+	print(floats)
+
+	var vectors := PackedVector3Array([Vector3(1, 2, 3), Vector3(4, 5, 6)])
+	vectors[1] = vectors[0] + Vector3.ONE
+	print(vectors)
+
+	var a := PackedFloat32Array([1.0, 2.0, 3.0, 4.0, 5.0, 6.0])
+	var b := PackedFloat32Array([6.0, 5.0, 4.0, 3.0, 2.0, 1.0])
+	print(a.dot(b))
+	a.add_elementwise(b)
+	print(a)
+	a.multiply_elementwise(b)
+	print(a)
+	a.scale(0.5)
+	print(a)
+	a.add_scaled(b, 2.0)
+	print(a)
+	a.lerp(b, 0.5)
+	print(a)
+
+	var c := PackedVector3Array([Vector3(1, 2, 3), Vector3(-1, 0, 1)])
+	var d := PackedVector3Array([Vector3(2, 2, 2), Vector3(4, 5, 6)])
+	print(c.dot_elementwise(d))
+	c.add_scaled(d, 0.5)
+	print(c)
+	c.multiply_elementwise(d)
+	print(c)
+
+	var copy := floats
+	copy[0] = 100.0
+	print(floats[0])
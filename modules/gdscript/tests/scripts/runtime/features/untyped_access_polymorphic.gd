@@ -0,0 +1,56 @@
+# The same untyped access or call sites see receivers of different kinds.
+
+class A:
+	var value = 1
+	func describe():
+		return "A %s" % value
+
+class B extends A:
+	var extra = 10
+	func describe():
+		return "B %s %s" % [value, extra]
+
+class C:
+	var value: int = 0:
+		set(v):
+			value = v * 2
+		get:
+			return value + 1
+	func describe():
+		return "C %s" % value
+
+class D:
+	var value: float = 0.5
+	func describe():
+		return "D %s" % value
+
+func get_value(obj):
+	return obj.value
+
+func set_value(obj, v):
+	obj.value = v
+
+func describe(obj):
+	return obj.describe()
+
+func test():
+	var receivers = [A.new(), B.new(), C.new(), D.new(), Vector2(3, 4), RefCounted.new()]
+	for i in 2:
+		for obj in receivers:
+			if obj is Vector2:
+				print(obj.x, " ", obj.y)
+				obj.x = 5
+				print(obj.x)
+				continue
+			if obj is Object and obj.get_script() == null:
+				print(obj.get_class())
+				continue
+			set_value(obj, 3)
+			print(get_value(obj))
+			print(describe(obj))
+
+	# Typed members still convert what they are given.
+	var d = D.new()
+	set_value(d, 2)
+	print(typeof(get_value(d)) == TYPE_FLOAT)
+	print(get_value(d))
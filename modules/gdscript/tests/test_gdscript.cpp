@@ -252,6 +252,79 @@ static void test_compiler(const String &p_code, const String &p_script_path, con
 	recursively_disassemble_functions(script, p_lines);
 }
 
+static Ref<GDScript> compile_for_benchmark(const String &p_code, const String &p_script_path, bool p_optimize) {
+	GDScriptParser parser;
+	Error err = parser.parse(p_code, p_script_path, false);
+	if (err == OK) {
+		GDScriptAnalyzer analyzer(&parser);
+		err = analyzer.analyze();
+	}
+	if (err != OK) {
+		print_line("Error in parser or analyzer:");
+		const List<GDScriptParser::ParserError> &errors = parser.get_errors();
+		for (const GDScriptParser::ParserError &error : errors) {
+			print_line(vformat("%02d:%02d: %s", error.line, error.column, error.message));
+		}
+		return Ref<GDScript>();
+	}
+
+	GDScriptCompiler compiler;
+	compiler.set_optimizations_enabled(p_optimize);
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_path(p_script_path);
+
+	err = compiler.compile(&parser, script.ptr(), false);
+	if (err) {
+		print_line("Error in compiler:");
+		print_line(vformat("%02d:%02d: %s", compiler.get_error_line(), compiler.get_error_column(), compiler.get_error()));
+		return Ref<GDScript>();
+	}
+	return script;
+}
+
+// Runs every static `bench_*` function of the script, compiled without and with optimizations.
+static void test_benchmark(const String &p_code, const String &p_script_path) {
+	const int iterations = 5;
+
+	Ref<GDScript> scripts[2] = {
+		compile_for_benchmark(p_code, p_script_path, false),
+		compile_for_benchmark(p_code, p_script_path, true),
+	};
+	if (scripts[0].is_null() || scripts[1].is_null()) {
+		return;
+	}
+
+	List<StringName> names;
+	for (const KeyValue<StringName, GDScriptFunction *> &E : scripts[0]->get_member_functions()) {
+		if (E.value->is_static() && String(E.key).begins_with("bench_") && E.value->get_argument_count() == 0) {
+			names.push_back(E.key);
+		}
+	}
+	names.sort_custom<StringName::AlphCompare>();
+
+	for (const StringName &name : names) {
+		uint64_t best[2] = { UINT64_MAX, UINT64_MAX };
+		Variant results[2];
+		for (int i = 0; i < 2; i++) {
+			Object *script_obj = scripts[i].ptr();
+			for (int j = 0; j < iterations; j++) {
+				Callable::CallError ce;
+				const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+				results[i] = script_obj->callp(name, nullptr, 0, ce);
+				best[i] = MIN(best[i], OS::get_singleton()->get_ticks_usec() - begin);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					print_line(vformat("%s: call failed.", name));
+					return;
+				}
+			}
+		}
+
+		const String check = results[0] == results[1] ? "" : vformat(" (results differ: %s != %s)", results[0], results[1]);
+		print_line(vformat("%s: %d usec unoptimized, %d usec optimized, %.2fx%s", name, best[0], best[1], best[1] > 0 ? double(best[0]) / double(best[1]) : 0.0, check));
+	}
+}
+
 void test(TestType p_type) {
 	List<String> cmdlargs = OS::get_singleton()->get_cmdline_args();
 
@@ -318,6 +391,10 @@ void test(TestType p_type) {
 			break;
 		case TEST_BYTECODE:
 			print_line("Not implemented.");
+			break;
+		case TEST_BENCHMARK:
+			test_benchmark(code, test);
+			break;
 	}
 
 	finish_language();
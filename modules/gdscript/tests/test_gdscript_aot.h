@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*  test_gdscript_aot.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_GDSCRIPT_AOT_H
+#define TEST_GDSCRIPT_AOT_H
+
+#include "../gdscript.h"
+#include "../gdscript_aot.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+// Running the tests with `--gdscript-aot-output` and building the result in makes the
+// script loaded from this path run translated, while the copy is always run by the VM.
+static const char *AOT_TEST_SCRIPT_PATH = "res://gdscript_aot_test.gd";
+
+static const char *AOT_TEST_SCRIPT_SOURCE = R"(
+static func int_operators(a: int, b: int) -> int:
+	var result := a * b + a - b
+	if result > 10:
+		result = result % 7
+	return result
+
+static func float_loop(count: int) -> float:
+	var total := 0.0
+	for i in count:
+		total += i * 0.5
+	return total
+
+static func builtin_calls(x: float, y: float) -> float:
+	var vector := Vector2(x, y)
+	return vector.length() + absf(x - y)
+)";
+
+static Ref<GDScript> compile_aot_test_script(const String &p_path) {
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_path(p_path, true);
+	script->set_source_code(AOT_TEST_SCRIPT_SOURCE);
+	Error err = script->reload();
+	CHECK_MESSAGE(err == OK, "The AOT test script should compile.");
+	return script;
+}
+
+TEST_CASE("[Modules][GDScript][AOT] Typed functions are translated and match the VM") {
+	Ref<GDScript> script = compile_aot_test_script(AOT_TEST_SCRIPT_PATH);
+	Ref<GDScript> vm_script = compile_aot_test_script("res://gdscript_aot_test_vm.gd");
+	REQUIRE(script->is_valid());
+	REQUIRE(vm_script->is_valid());
+
+	const char *function_names[] = { "int_operators", "float_loop", "builtin_calls" };
+	for (const char *name : function_names) {
+		GDScriptFunction *function = script->get_member_functions()[StringName(name)];
+		REQUIRE(function != nullptr);
+		String code;
+		CHECK_MESSAGE(GDScriptAOT::generate_function_code(function, code), vformat("\"%s\" should be translated.", name));
+		CHECK_FALSE(code.is_empty());
+	}
+
+	const Vector<Vector<Variant>> int_arguments = { { 2, 3 }, { 7, 4 }, { -5, 9 }, { 0, 0 } };
+	for (const Vector<Variant> &arguments : int_arguments) {
+		const Variant result = script->call(SNAME("int_operators"), arguments[0], arguments[1]);
+		CHECK(result.get_type() == Variant::INT);
+		CHECK(result == vm_script->call(SNAME("int_operators"), arguments[0], arguments[1]));
+	}
+
+	for (int count : { 0, 1, 10, 1000 }) {
+		const Variant result = script->call(SNAME("float_loop"), count);
+		CHECK(result.get_type() == Variant::FLOAT);
+		CHECK(result == vm_script->call(SNAME("float_loop"), count));
+	}
+
+	const Vector<Vector<Variant>> float_arguments = { { 3.0, 4.0 }, { -1.5, 2.25 }, { 0.0, 0.0 } };
+	for (const Vector<Variant> &arguments : float_arguments) {
+		const Variant result = script->call(SNAME("builtin_calls"), arguments[0], arguments[1]);
+		CHECK(result.get_type() == Variant::FLOAT);
+		CHECK(result == vm_script->call(SNAME("builtin_calls"), arguments[0], arguments[1]));
+	}
+}
+
+} // namespace GDScriptTests
+
+#endif // TEST_GDSCRIPT_AOT_H
@@ -0,0 +1,224 @@
+/**************************************************************************/
+/*  test_gdscript_bytecode_cache.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_GDSCRIPT_BYTECODE_CACHE_H
+#define TEST_GDSCRIPT_BYTECODE_CACHE_H
+
+#include "../gdscript.h"
+#include "../gdscript_bytecode_cache.h"
+#include "../gdscript_tokenizer_buffer.h"
+
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace GDScriptTests {
+
+static Vector<uint8_t> write_binary_script(const String &p_path, const String &p_code) {
+	const Vector<uint8_t> tokens = GDScriptTokenizerBuffer::parse_code_string(p_code, GDScriptTokenizerBuffer::COMPRESS_NONE);
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	f->store_buffer(tokens);
+	// Scripts are only read once per run, unless removed from the cache.
+	GDScriptBytecodeCache::remove_script(p_path);
+	return tokens;
+}
+
+TEST_CASE("[Modules][GDScript][BytecodeCache] Script hash covers the scripts it depends on") {
+	const String dir = TestUtils::get_temp_path("gdscript_bytecode_cache");
+	REQUIRE(DirAccess::make_dir_recursive_absolute(dir) == OK);
+	const String grandparent_path = dir.path_join("grandparent.gdc");
+	const String parent_path = dir.path_join("parent.gdc");
+	const String constants_path = dir.path_join("constants.gdc");
+	const String unrelated_path = dir.path_join("unrelated.gdc");
+	const String script_path = dir.path_join("script.gdc");
+
+	write_binary_script(grandparent_path, "var a = 1\n");
+	write_binary_script(parent_path, "extends \"grandparent.gdc\"\nvar b = 2\n");
+	write_binary_script(constants_path, "const VALUE = 3\n");
+	write_binary_script(unrelated_path, "const VALUE = 4\n");
+	const Vector<uint8_t> tokens = write_binary_script(script_path, "extends \"parent.gdc\"\nconst Constants = preload(\"constants.gdc\")\nfunc get_value():\n\treturn Constants.VALUE + b\n");
+
+	const uint32_t hash = GDScriptBytecodeCache::hash_script(script_path, tokens);
+	CHECK(GDScriptBytecodeCache::hash_script(script_path, tokens) == hash);
+
+	// Scripts not referenced don't matter.
+	write_binary_script(unrelated_path, "const VALUE = 5\n");
+	CHECK(GDScriptBytecodeCache::hash_script(script_path, tokens) == hash);
+
+	// Constants of preloaded scripts are folded into the bytecode.
+	write_binary_script(constants_path, "const VALUE = 6\n");
+	const uint32_t constants_changed_hash = GDScriptBytecodeCache::hash_script(script_path, tokens);
+	CHECK(constants_changed_hash != hash);
+
+	// Member indices of every base class are too.
+	write_binary_script(grandparent_path, "var z = 0\nvar a = 1\n");
+	CHECK(GDScriptBytecodeCache::hash_script(script_path, tokens) != constants_changed_hash);
+}
+
+static const char *BYTECODE_CACHE_TEST_SCRIPT_SOURCE = R"(
+static func sum_doubled(count):
+	var total = 0
+	for i in count:
+		total += i * 2
+	return total
+
+static func apply_lambda(value):
+	var add_one = func(x): return x + 1
+	return add_one.call(value) * 3
+)";
+
+static Ref<GDScript> compile_binary_script(const String &p_path, const Vector<uint8_t> &p_tokens) {
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_path(p_path, true);
+	script->set_binary_tokens_source(p_tokens);
+	CHECK_MESSAGE(script->reload() == OK, "The script should compile.");
+	return script;
+}
+
+// Enables the cache with its file in the temporary directory, and compiles the test script once so its bytecode is saved.
+static Vector<uint8_t> prepare_bytecode_cache(const String &p_cache_path, const String &p_script_path) {
+	ProjectSettings::get_singleton()->set_setting("application/run/cache_gdscript_bytecode", true);
+	GDScriptBytecodeCache::get_singleton()->set_cache_path(p_cache_path);
+
+	const Vector<uint8_t> tokens = write_binary_script(p_script_path, BYTECODE_CACHE_TEST_SCRIPT_SOURCE);
+	Ref<GDScript> script = compile_binary_script(p_script_path, tokens);
+	CHECK(int(script->call(SNAME("sum_doubled"), 10)) == 90);
+	CHECK(GDScriptBytecodeCache::get_singleton()->save() == OK);
+
+	// Forget what is in memory, so the file is read again.
+	GDScriptBytecodeCache::get_singleton()->set_cache_path(p_cache_path);
+	return tokens;
+}
+
+static void restore_bytecode_cache_defaults() {
+	ProjectSettings::get_singleton()->set_setting("application/run/cache_gdscript_bytecode", false);
+	GDScriptBytecodeCache::get_singleton()->set_cache_path("user://gdscript_bytecode.cache");
+}
+
+TEST_CASE("[Modules][GDScript][BytecodeCache] Cached bytecode is restored and runs") {
+	const String dir = TestUtils::get_temp_path("gdscript_bytecode_cache");
+	REQUIRE(DirAccess::make_dir_recursive_absolute(dir) == OK);
+	const String cache_path = dir.path_join("round_trip.cache");
+	const String script_path = dir.path_join("round_trip.gdc");
+	const Vector<uint8_t> tokens = prepare_bytecode_cache(cache_path, script_path);
+
+	const uint32_t hash = GDScriptBytecodeCache::hash_script(script_path, tokens);
+	bool complete = false;
+	const Dictionary classes = GDScriptBytecodeCache::get_script_bytecode(script_path, hash, complete);
+	REQUIRE_FALSE(classes.is_empty());
+	CHECK(complete);
+
+	Ref<GDScript> script = compile_binary_script(script_path, tokens);
+	CHECK(int(script->call(SNAME("sum_doubled"), 10)) == 90);
+	CHECK(int(script->call(SNAME("sum_doubled"), 0)) == 0);
+	CHECK(int(script->call(SNAME("apply_lambda"), 4)) == 15);
+
+	// Restoring failures drop the entry, so it still being there means the functions were restored.
+	CHECK_FALSE(GDScriptBytecodeCache::get_script_bytecode(script_path, hash, complete).is_empty());
+
+	SUBCASE("Invalid bytecode is rejected") {
+		const Dictionary functions = classes[script->get_fully_qualified_name()];
+		const Dictionary data = functions["sum_doubled"];
+
+		GDScriptFunction *function = GDScriptBytecodeCache::restore_function(data, script.ptr(), script.ptr());
+		REQUIRE(function != nullptr);
+		memdelete(function);
+
+		// Each replaces the final `OPCODE_END` with instructions that don't fit the function.
+		const int stack_size = data["stack_size"];
+		const int constant_count = Array(data["constants"]).size();
+		const int name_count = Array(data["global_names"]).size();
+		const Vector<Vector<int>> invalid_code = {
+			{ GDScriptFunction::OPCODE_RETURN, stack_size | (GDScriptFunction::ADDR_TYPE_STACK << GDScriptFunction::ADDR_BITS), GDScriptFunction::OPCODE_END },
+			{ GDScriptFunction::OPCODE_RETURN, constant_count | (GDScriptFunction::ADDR_TYPE_CONSTANT << GDScriptFunction::ADDR_BITS), GDScriptFunction::OPCODE_END },
+			{ GDScriptFunction::OPCODE_RETURN, GDScriptFunction::ADDR_TYPE_MAX << GDScriptFunction::ADDR_BITS, GDScriptFunction::OPCODE_END },
+			{ GDScriptFunction::OPCODE_RETURN },
+			{ GDScriptFunction::OPCODE_GET_MEMBER, GDScriptFunction::ADDR_NIL, name_count, GDScriptFunction::OPCODE_END },
+			{ GDScriptFunction::OPCODE_STORE_GLOBAL, GDScriptFunction::ADDR_NIL, GDScriptLanguage::get_singleton()->get_global_array_size(), GDScriptFunction::OPCODE_END },
+			{ GDScriptFunction::OPCODE_JUMP, 1 << 20, GDScriptFunction::OPCODE_END },
+			{ GDScriptFunction::OPCODE_JUMP, -1, GDScriptFunction::OPCODE_END },
+			{ GDScriptFunction::OPCODE_END + 1 },
+		};
+		for (const Vector<int> &instructions : invalid_code) {
+			PackedInt32Array code = data["code"];
+			code.resize(code.size() - 1);
+			code.append_array(instructions);
+			Dictionary invalid_data = data.duplicate();
+			invalid_data["code"] = code;
+			CHECK(GDScriptBytecodeCache::restore_function(invalid_data, script.ptr(), script.ptr()) == nullptr);
+		}
+	}
+
+	restore_bytecode_cache_defaults();
+}
+
+TEST_CASE("[Modules][GDScript][BytecodeCache] Corrupted cache files are ignored") {
+	const String dir = TestUtils::get_temp_path("gdscript_bytecode_cache");
+	REQUIRE(DirAccess::make_dir_recursive_absolute(dir) == OK);
+	const String cache_path = dir.path_join("corrupted.cache");
+	const String script_path = dir.path_join("corrupted.gdc");
+	const Vector<uint8_t> tokens = prepare_bytecode_cache(cache_path, script_path);
+	const uint32_t hash = GDScriptBytecodeCache::hash_script(script_path, tokens);
+
+	Vector<uint8_t> file = FileAccess::get_file_as_bytes(cache_path);
+	REQUIRE(file.size() > 64);
+
+	SUBCASE("Flipped byte") {
+		file.write[file.size() / 2] ^= 0x5a;
+	}
+	SUBCASE("Truncated") {
+		file.resize(file.size() - 16);
+	}
+
+	{
+		Ref<FileAccess> f = FileAccess::open(cache_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(file);
+	}
+	GDScriptBytecodeCache::get_singleton()->set_cache_path(cache_path);
+
+	bool complete = true;
+	CHECK(GDScriptBytecodeCache::get_script_bytecode(script_path, hash, complete).is_empty());
+	CHECK_FALSE(complete);
+
+	// Compiled again from the tokens instead.
+	Ref<GDScript> script = compile_binary_script(script_path, tokens);
+	CHECK(int(script->call(SNAME("sum_doubled"), 10)) == 90);
+	CHECK(int(script->call(SNAME("apply_lambda"), 4)) == 15);
+
+	restore_bytecode_cache_defaults();
+}
+
+} // namespace GDScriptTests
+
+#endif // TEST_GDSCRIPT_BYTECODE_CACHE_H
@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  test_gdscript_sampling_profiler.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_GDSCRIPT_SAMPLING_PROFILER_H
+#define TEST_GDSCRIPT_SAMPLING_PROFILER_H
+
+#include "../gdscript.h"
+#include "../gdscript_sampling_profiler.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+static const char *SAMPLING_TEST_SCRIPT_PATH = "res://gdscript_sampling_profiler_test.gd";
+
+// Line numbers are checked below, the first line being the empty one.
+static const char *SAMPLING_TEST_SCRIPT_SOURCE = R"(
+static func busy(duration_usec: int) -> int:
+	var start := Time.get_ticks_usec()
+	var count := 0
+	while Time.get_ticks_usec() - start < duration_usec:
+		count += 1
+	return count
+
+static func run(duration_usec: int) -> int:
+	return busy(duration_usec)
+)";
+
+// Returns the number of samples of the `run;busy` stack. Lines of `busy` are accepted
+// anywhere in its body, as the samples land on whichever line is running.
+static uint64_t count_sampled_busy_stacks(const String &p_collapsed, bool p_include_lines) {
+	const String run_frame = vformat("run (%s:%d)", SAMPLING_TEST_SCRIPT_PATH, p_include_lines ? 10 : 9);
+
+	uint64_t count = 0;
+	for (const String &line : p_collapsed.split("\n", false)) {
+		const Vector<String> parts = line.rsplit(" ", false, 1);
+		REQUIRE(parts.size() == 2);
+		CHECK(parts[1].is_valid_int());
+
+		const Vector<String> frames = parts[0].split(";");
+		if (frames.size() != 2 || frames[0] != run_frame) {
+			continue;
+		}
+		bool valid_line = false;
+		if (p_include_lines) {
+			for (int busy_line = 2; busy_line <= 7; busy_line++) {
+				valid_line = valid_line || frames[1] == vformat("busy (%s:%d)", SAMPLING_TEST_SCRIPT_PATH, busy_line);
+			}
+		} else {
+			valid_line = frames[1] == vformat("busy (%s:2)", SAMPLING_TEST_SCRIPT_PATH);
+		}
+		CHECK_MESSAGE(valid_line, vformat("Unexpected frame: %s", frames[1]));
+		count += parts[1].to_int();
+	}
+	return count;
+}
+
+TEST_CASE("[Modules][GDScript] Sampling profiler records running scripts") {
+	GDScriptSamplingProfiler *profiler = GDScriptSamplingProfiler::get_singleton();
+	REQUIRE(profiler != nullptr);
+	REQUIRE_FALSE(profiler->is_running());
+
+	Ref<GDScript> script;
+	script.instantiate();
+	script->set_path(SAMPLING_TEST_SCRIPT_PATH, true);
+	script->set_source_code(SAMPLING_TEST_SCRIPT_SOURCE);
+	REQUIRE(script->reload() == OK);
+
+	profiler->start(100);
+	CHECK(profiler->is_running());
+	script->call(SNAME("run"), 200000);
+	profiler->stop();
+	CHECK_FALSE(profiler->is_running());
+
+	const uint64_t sample_count = profiler->get_sample_count();
+	CHECK(sample_count > 0);
+
+	const uint64_t without_lines = count_sampled_busy_stacks(profiler->get_collapsed_stacks(false), false);
+	CHECK(without_lines > 0);
+	CHECK(without_lines <= sample_count);
+#ifdef DEBUG_ENABLED
+	// Line opcodes are only emitted in debug builds.
+	CHECK(count_sampled_busy_stacks(profiler->get_collapsed_stacks(true), true) == without_lines);
+#endif
+
+	SUBCASE("Restarting keeps previous samples") {
+		// Stopping renumbered the symbols, so the functions register again and their new
+		// samples are merged with the previous ones.
+		profiler->start(100);
+		script->call(SNAME("run"), 100000);
+		profiler->stop();
+		CHECK(profiler->get_sample_count() > sample_count);
+		CHECK(count_sampled_busy_stacks(profiler->get_collapsed_stacks(false), false) > without_lines);
+	}
+
+	SUBCASE("Clearing while stopped drops samples and symbols") {
+		profiler->clear();
+		CHECK(profiler->get_sample_count() == 0);
+		CHECK(profiler->get_collapsed_stacks().is_empty());
+	}
+
+	profiler->clear();
+}
+
+} // namespace GDScriptTests
+
+#endif // TEST_GDSCRIPT_SAMPLING_PROFILER_H
@@ -175,6 +175,11 @@ void GodotCollisionObject2D::_update_shapes() {
 		shape_aabb.grow_by((s.aabb_cache.size.x + s.aabb_cache.size.y) * 0.5 * 0.05);
 		s.aabb_cache = shape_aabb;
 
+		if (space->is_broadphase_move_deferred()) {
+			broadphase_move_pending = true;
+			continue;
+		}
+
 		if (s.bpid == 0) {
 			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
@@ -202,6 +207,11 @@ void GodotCollisionObject2D::_update_shapes_with_motion(const Vector2 &p_motion)
 		shape_aabb = shape_aabb.merge(Rect2(shape_aabb.position + p_motion, shape_aabb.size)); //use motion
 		s.aabb_cache = shape_aabb;
 
+		if (space->is_broadphase_move_deferred()) {
+			broadphase_move_pending = true;
+			continue;
+		}
+
 		if (s.bpid == 0) {
 			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
@@ -211,6 +221,31 @@ void GodotCollisionObject2D::_update_shapes_with_motion(const Vector2 &p_motion)
 	}
 }
 
+void GodotCollisionObject2D::flush_broadphase_moves() {
+	if (!broadphase_move_pending) {
+		return;
+	}
+	broadphase_move_pending = false;
+
+	if (!space) {
+		return;
+	}
+
+	for (int i = 0; i < shapes.size(); i++) {
+		Shape &s = shapes.write[i];
+		if (s.disabled) {
+			continue;
+		}
+
+		if (s.bpid == 0) {
+			s.bpid = space->get_broadphase()->create(this, i, s.aabb_cache, _static);
+			space->get_broadphase()->set_static(s.bpid, _static);
+		}
+
+		space->get_broadphase()->move(s.bpid, s.aabb_cache);
+	}
+}
+
 void GodotCollisionObject2D::_set_space(GodotSpace2D *p_space) {
 	GodotSpace2D *old_space = space;
 	space = p_space;
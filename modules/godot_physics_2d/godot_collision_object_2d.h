@@ -74,6 +74,7 @@ private:
 	bool _static = true;
 
 	SelfList<GodotCollisionObject2D> pending_shape_update_list;
+	bool broadphase_move_pending = false;
 
 	void _update_shapes();
 
@@ -102,6 +103,8 @@ public:
 	_FORCE_INLINE_ void set_instance_id(const ObjectID &p_instance_id) { instance_id = p_instance_id; }
 	_FORCE_INLINE_ ObjectID get_instance_id() const { return instance_id; }
 
+	void flush_broadphase_moves();
+
 	_FORCE_INLINE_ void set_canvas_instance_id(const ObjectID &p_canvas_instance_id) { canvas_instance_id = p_canvas_instance_id; }
 	_FORCE_INLINE_ ObjectID get_canvas_instance_id() const { return canvas_instance_id; }
 
@@ -39,6 +39,23 @@
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
 
+void GodotStep2D::_gather_active_bodies(const SelfList<GodotBody2D>::List *p_body_list) {
+	active_bodies.clear();
+	const SelfList<GodotBody2D> *b = p_body_list->first();
+	while (b) {
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+}
+
+void GodotStep2D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep2D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
 void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
 
@@ -142,13 +159,26 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
-
-	const SelfList<GodotBody2D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	_gather_active_bodies(body_list);
+	int active_count = active_bodies.size();
+
+	// Dispatching group tasks costs more than integrating a few bodies on this thread.
+	const uint32_t parallel_body_threshold = p_space->get_parallel_integration_body_threshold();
+	WorkerThreadPool::GroupID group_task;
+	if (parallel_body_threshold > 0 && active_bodies.size() >= parallel_body_threshold) {
+		// Broadphase moves are applied afterwards, in the order of the body list.
+		p_space->set_broadphase_move_deferred(true);
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_forces, nullptr, active_bodies.size(), -1, true, SNAME("Physics2DIntegrateForces"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		p_space->set_broadphase_move_deferred(false);
+
+		for (GodotBody2D *body : active_bodies) {
+			body->flush_broadphase_moves();
+		}
+	} else {
+		for (GodotBody2D *body : active_bodies) {
+			body->integrate_forces(delta);
+		}
 	}
 
 	p_space->set_active_objects(active_count);
@@ -192,7 +222,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	const SelfList<GodotBody2D> *b = body_list->first();
 
 	uint32_t body_island_count = 0;
 
@@ -240,7 +270,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -271,11 +301,23 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<GodotBody2D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n; // in case it shuts itself down
+	// Bodies can be woken up by the constraints, gather them again.
+	_gather_active_bodies(body_list);
+
+	if (parallel_body_threshold > 0 && active_bodies.size() >= parallel_body_threshold) {
+		p_space->set_broadphase_move_deferred(true);
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_velocities, nullptr, active_bodies.size(), -1, true, SNAME("Physics2DIntegrateVelocities"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		p_space->set_broadphase_move_deferred(false);
+	} else {
+		for (GodotBody2D *body : active_bodies) {
+			body->integrate_velocities(delta);
+		}
+	}
+
+	// Kinematic bodies can leave the active list here, which is why the bodies were gathered first.
+	for (GodotBody2D *body : active_bodies) {
+		body->finish_integrate_velocities();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  test_godot_step_2d.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#ifndef TEST_GODOT_STEP_2D_H
+#define TEST_GODOT_STEP_2D_H
+
+#include "../godot_physics_server_2d.h"
+
+#include "core/config/project_settings.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotStep2D {
+
+// Throws a grid of boxes through a row of areas. The boxes don't collide with each other, so the
+// only broadphase pairs are between boxes and areas. Returns the final transforms of the boxes, and
+// the number of broadphase pairs after each step.
+static void simulate_crossing_boxes(int p_parallel_threshold, Vector<Transform2D> &r_transforms, Vector<int> &r_pair_counts) {
+	GodotPhysicsServer2D *server = memnew(GodotPhysicsServer2D);
+	server->init();
+
+	const String threshold_setting = "physics/2d/solver/parallel_integration_body_threshold";
+	const Variant previous_threshold = GLOBAL_GET(threshold_setting);
+	ProjectSettings::get_singleton()->set_setting(threshold_setting, p_parallel_threshold);
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+	server->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY, 9.8);
+	server->area_set_param(space, PhysicsServer2D::AREA_PARAM_GRAVITY_VECTOR, Vector2(0, 1));
+
+	RID area_shape = server->rectangle_shape_create();
+	server->shape_set_data(area_shape, Vector2(1, 1));
+
+	Vector<RID> areas;
+	for (int x = 0; x < 16; x++) {
+		RID area = server->area_create();
+		server->area_add_shape(area, area_shape);
+		server->area_set_transform(area, Transform2D(0, Vector2(x * 4, 10)));
+		server->area_set_collision_layer(area, 0);
+		server->area_set_collision_mask(area, 2);
+		server->area_set_space(area, space);
+		areas.push_back(area);
+	}
+
+	RID box_shape = server->rectangle_shape_create();
+	server->shape_set_data(box_shape, Vector2(0.5, 0.5));
+
+	Vector<RID> boxes;
+	for (int y = 0; y < 8; y++) {
+		for (int x = 0; x < 32; x++) {
+			const real_t i = boxes.size();
+			RID box = server->body_create();
+			server->body_add_shape(box, box_shape);
+			server->body_set_collision_layer(box, 2);
+			server->body_set_collision_mask(box, 0);
+			server->body_set_state(box, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(x * 2, -y * 2)));
+			server->body_set_space(box, space);
+			server->body_set_state(box, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, Vector2(Math::sin(i * 0.7) * 3, Math::cos(i * 1.3) * 2));
+			server->body_set_state(box, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, Math::cos(i * 0.5));
+			boxes.push_back(box);
+		}
+	}
+
+	r_pair_counts.clear();
+	for (int i = 0; i < 120; i++) {
+		server->step(1.0 / 60.0);
+		r_pair_counts.push_back(server->get_process_info(PhysicsServer2D::INFO_COLLISION_PAIRS));
+	}
+
+	r_transforms.clear();
+	for (const RID &box : boxes) {
+		r_transforms.push_back(server->body_get_state(box, PhysicsServer2D::BODY_STATE_TRANSFORM));
+		server->free(box);
+	}
+	for (const RID &area : areas) {
+		server->free(area);
+	}
+	server->free(box_shape);
+	server->free(area_shape);
+	server->free(space);
+
+	ProjectSettings::get_singleton()->set_setting(threshold_setting, previous_threshold);
+
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[GodotPhysics2D] Integrating bodies in parallel matches serial integration") {
+	// A threshold of 1 always integrates on the worker threads, 0 never does.
+	Vector<Transform2D> parallel_transforms;
+	Vector<int> parallel_pair_counts;
+	simulate_crossing_boxes(1, parallel_transforms, parallel_pair_counts);
+
+	Vector<Transform2D> serial_transforms;
+	Vector<int> serial_pair_counts;
+	simulate_crossing_boxes(0, serial_transforms, serial_pair_counts);
+
+	REQUIRE(parallel_transforms.size() == 256);
+	REQUIRE(serial_transforms.size() == parallel_transforms.size());
+	for (int i = 0; i < parallel_transforms.size(); i++) {
+		CHECK_MESSAGE(parallel_transforms[i] == serial_transforms[i], "Bodies should end up exactly where serial integration puts them.");
+	}
+
+	REQUIRE(serial_pair_counts.size() == parallel_pair_counts.size());
+	bool had_pairs = false;
+	for (int i = 0; i < parallel_pair_counts.size(); i++) {
+		CHECK_MESSAGE(parallel_pair_counts[i] == serial_pair_counts[i], "The broadphase should find the same pairs at every step.");
+		had_pairs = had_pairs || parallel_pair_counts[i] > 0;
+	}
+	CHECK_MESSAGE(had_pairs, "The boxes should go through some of the areas.");
+}
+
+} // namespace TestGodotStep2D
+
+#endif // TEST_GODOT_STEP_2D_H
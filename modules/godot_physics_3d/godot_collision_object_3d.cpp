@@ -173,6 +173,11 @@ void GodotCollisionObject3D::_update_shapes() {
 		Vector3 scale = xform.get_basis().get_scale();
 		s.area_cache = s.shape->get_volume() * scale.x * scale.y * scale.z;
 
+		if (space->is_broadphase_move_deferred()) {
+			broadphase_move_pending = true;
+			continue;
+		}
+
 		if (s.bpid == 0) {
 			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
@@ -200,6 +205,11 @@ void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion)
 		shape_aabb.merge_with(AABB(shape_aabb.position + p_motion, shape_aabb.size)); //use motion
 		s.aabb_cache = shape_aabb;
 
+		if (space->is_broadphase_move_deferred()) {
+			broadphase_move_pending = true;
+			continue;
+		}
+
 		if (s.bpid == 0) {
 			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
@@ -209,6 +219,31 @@ void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion)
 	}
 }
 
+void GodotCollisionObject3D::flush_broadphase_moves() {
+	if (!broadphase_move_pending) {
+		return;
+	}
+	broadphase_move_pending = false;
+
+	if (!space) {
+		return;
+	}
+
+	for (int i = 0; i < shapes.size(); i++) {
+		Shape &s = shapes.write[i];
+		if (s.disabled) {
+			continue;
+		}
+
+		if (s.bpid == 0) {
+			s.bpid = space->get_broadphase()->create(this, i, s.aabb_cache, _static);
+			space->get_broadphase()->set_static(s.bpid, _static);
+		}
+
+		space->get_broadphase()->move(s.bpid, s.aabb_cache);
+	}
+}
+
 void GodotCollisionObject3D::_set_space(GodotSpace3D *p_space) {
 	GodotSpace3D *old_space = space;
 	space = p_space;
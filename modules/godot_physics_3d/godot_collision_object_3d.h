@@ -78,6 +78,7 @@ private:
 	bool _static = true;
 
 	SelfList<GodotCollisionObject3D> pending_shape_update_list;
+	bool broadphase_move_pending = false;
 
 	void _update_shapes();
 
@@ -113,6 +114,8 @@ public:
 	_FORCE_INLINE_ void set_instance_id(const ObjectID &p_instance_id) { instance_id = p_instance_id; }
 	_FORCE_INLINE_ ObjectID get_instance_id() const { return instance_id; }
 
+	void flush_broadphase_moves();
+
 	void _shape_changed() override;
 
 	_FORCE_INLINE_ Type get_type() const { return type; }
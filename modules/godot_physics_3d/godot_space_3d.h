@@ -94,6 +94,8 @@ private:
 	GodotArea3D *area = nullptr;
 
 	int solver_iterations = 0;
+	uint32_t parallel_island_constraint_threshold = 0;
+	uint32_t parallel_integration_body_threshold = 0;
 
 	real_t contact_recycle_radius = 0.0;
 	real_t contact_max_separation = 0.0;
@@ -112,6 +114,7 @@ private:
 	real_t body_time_to_sleep = 0.0;
 
 	bool locked = false;
+	bool broadphase_move_deferred = false;
 
 	real_t last_step = 0.001;
 
@@ -161,6 +164,8 @@ public:
 	const HashSet<GodotCollisionObject3D *> &get_objects() const;
 
 	_FORCE_INLINE_ int get_solver_iterations() const { return solver_iterations; }
+	_FORCE_INLINE_ uint32_t get_parallel_island_constraint_threshold() const { return parallel_island_constraint_threshold; }
+	_FORCE_INLINE_ uint32_t get_parallel_integration_body_threshold() const { return parallel_integration_body_threshold; }
 	_FORCE_INLINE_ real_t get_contact_recycle_radius() const { return contact_recycle_radius; }
 	_FORCE_INLINE_ real_t get_contact_max_separation() const { return contact_max_separation; }
 	_FORCE_INLINE_ real_t get_contact_max_allowed_penetration() const { return contact_max_allowed_penetration; }
@@ -177,6 +182,11 @@ public:
 	void lock();
 	void unlock();
 
+	// While set, shape moves are recorded by the collision objects instead of being sent to the broadphase,
+	// which isn't thread-safe. They are applied with `GodotCollisionObject3D::flush_broadphase_moves()`.
+	_FORCE_INLINE_ void set_broadphase_move_deferred(bool p_deferred) { broadphase_move_deferred = p_deferred; }
+	_FORCE_INLINE_ bool is_broadphase_move_deferred() const { return broadphase_move_deferred; }
+
 	real_t get_last_step() const { return last_step; }
 	void set_last_step(real_t p_step) { last_step = p_step; }
 
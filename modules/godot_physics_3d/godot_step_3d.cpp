@@ -40,6 +40,37 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define CONSTRAINT_COLOR_COUNT 64
+#define CONSTRAINT_BATCH_PARALLEL_MIN 32
+
+static uint32_t _keep_priority_constraints(LocalVector<GodotConstraint3D *> &p_constraints, int p_priority) {
+	uint32_t priority_constraint_count = 0;
+	for (uint32_t constraint_index = 0; constraint_index < p_constraints.size(); ++constraint_index) {
+		GodotConstraint3D *constraint = p_constraints[constraint_index];
+		if (constraint->get_priority() >= p_priority) {
+			p_constraints[priority_constraint_count++] = constraint;
+		}
+	}
+	p_constraints.resize(priority_constraint_count);
+	return priority_constraint_count;
+}
+
+void GodotStep3D::_gather_active_bodies(const SelfList<GodotBody3D>::List *p_body_list) {
+	active_bodies.clear();
+	const SelfList<GodotBody3D> *b = p_body_list->first();
+	while (b) {
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+}
+
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep3D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
 
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -133,6 +164,10 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
 
+	if (parallel_island_threshold > 0 && constraint_island.size() >= parallel_island_threshold) {
+		return; // Solved in color batches by `_solve_island_colored`.
+	}
+
 	int current_priority = 1;
 
 	uint32_t constraint_count = constraint_island.size();
@@ -158,6 +193,97 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_color_island(const LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	for (LocalVector<GodotConstraint3D *> &batch : constraint_colors) {
+		batch.clear();
+	}
+	overflow_constraints.clear();
+	body_color_masks.clear();
+
+	// Greedy coloring: each constraint takes the lowest color not used yet by any of its rigid bodies.
+	for (GodotConstraint3D *constraint : p_constraint_island) {
+		if (constraint->get_soft_body_count() > 0) {
+			// Soft body constraints touch many nodes, solve them serially.
+			overflow_constraints.push_back(constraint);
+			continue;
+		}
+
+		GodotBody3D **bodies = constraint->get_body_ptr();
+		int body_count = constraint->get_body_count();
+
+		uint64_t used_colors = 0;
+		for (int i = 0; i < body_count; i++) {
+			// Static and kinematic bodies are only read by the solver, constraints can share them.
+			if (bodies[i]->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				const uint64_t *body_colors = body_color_masks.getptr(bodies[i]);
+				if (body_colors) {
+					used_colors |= *body_colors;
+				}
+			}
+		}
+
+		if (used_colors == UINT64_MAX) {
+			overflow_constraints.push_back(constraint);
+			continue;
+		}
+
+		uint32_t color = 0;
+		while (used_colors & (uint64_t(1) << color)) {
+			color++;
+		}
+		if (constraint_colors.size() <= color) {
+			constraint_colors.resize(color + 1);
+		}
+		constraint_colors[color].push_back(constraint);
+
+		for (int i = 0; i < body_count; i++) {
+			if (bodies[i]->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+				body_color_masks[bodies[i]] |= uint64_t(1) << color;
+			}
+		}
+	}
+}
+
+void GodotStep3D::_solve_constraint_batch(uint32_t p_constraint_index, void *p_userdata) {
+	(*solving_batch)[p_constraint_index]->solve(delta);
+}
+
+void GodotStep3D::_solve_island_colored(const LocalVector<GodotConstraint3D *> &p_constraint_island) {
+	_color_island(p_constraint_island);
+
+	int current_priority = 1;
+
+	uint32_t constraint_count = p_constraint_island.size();
+	while (constraint_count > 0) {
+		for (int i = 0; i < iterations; i++) {
+			// Colors are solved one after the other, the constraints of a color in parallel.
+			for (const LocalVector<GodotConstraint3D *> &batch : constraint_colors) {
+				if (batch.size() < CONSTRAINT_BATCH_PARALLEL_MIN) {
+					for (GodotConstraint3D *constraint : batch) {
+						constraint->solve(delta);
+					}
+					continue;
+				}
+				solving_batch = &batch;
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_constraint_batch, nullptr, batch.size(), -1, true, SNAME("Physics3DConstraintSolveBatch"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			}
+			for (GodotConstraint3D *constraint : overflow_constraints) {
+				constraint->solve(delta);
+			}
+		}
+
+		// Check priority to keep only higher priority constraints.
+		++current_priority;
+		constraint_count = _keep_priority_constraints(overflow_constraints, current_priority);
+		for (LocalVector<GodotConstraint3D *> &batch : constraint_colors) {
+			constraint_count += _keep_priority_constraints(batch, current_priority);
+		}
+	}
+
+	solving_batch = nullptr;
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -201,13 +327,26 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
-
-	const SelfList<GodotBody3D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	_gather_active_bodies(body_list);
+	int active_count = active_bodies.size();
+
+	// Dispatching group tasks costs more than integrating a few bodies on this thread.
+	const uint32_t parallel_body_threshold = p_space->get_parallel_integration_body_threshold();
+	WorkerThreadPool::GroupID group_task;
+	if (parallel_body_threshold > 0 && active_bodies.size() >= parallel_body_threshold) {
+		// Broadphase moves are applied afterwards, in the order of the body list.
+		p_space->set_broadphase_move_deferred(true);
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_forces, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateForces"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		p_space->set_broadphase_move_deferred(false);
+
+		for (GodotBody3D *body : active_bodies) {
+			body->flush_broadphase_moves();
+		}
+	} else {
+		for (GodotBody3D *body : active_bodies) {
+			body->integrate_forces(delta);
+		}
 	}
 
 	/* UPDATE SOFT BODY MOTION */
@@ -260,7 +399,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	const SelfList<GodotBody3D> *b = body_list->first();
 
 	uint32_t body_island_count = 0;
 
@@ -344,7 +483,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -362,9 +501,25 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
+	// Islands with at least this many constraints are too big to be solved by a single thread,
+	// they are split into color batches solved in parallel while the other islands are processed.
+	parallel_island_threshold = p_space->get_parallel_island_constraint_threshold();
+	if (WorkerThreadPool::get_singleton()->get_thread_count() < 2) {
+		parallel_island_threshold = 0;
+	}
+
 	// WARNING: `_solve_island` modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
+
+	if (parallel_island_threshold > 0) {
+		for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
+			if (constraint_islands[island_index].size() >= parallel_island_threshold) {
+				_solve_island_colored(constraint_islands[island_index]);
+			}
+		}
+	}
+
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -375,11 +530,23 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<GodotBody3D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n;
+	// Bodies can be woken up by the constraints, gather them again.
+	_gather_active_bodies(body_list);
+
+	if (parallel_body_threshold > 0 && active_bodies.size() >= parallel_body_threshold) {
+		p_space->set_broadphase_move_deferred(true);
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_velocities, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateVelocities"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		p_space->set_broadphase_move_deferred(false);
+	} else {
+		for (GodotBody3D *body : active_bodies) {
+			body->integrate_velocities(delta);
+		}
+	}
+
+	// Kinematic bodies can leave the active list here, which is why the bodies were gathered first.
+	for (GodotBody3D *body : active_bodies) {
+		body->finish_integrate_velocities();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
@@ -412,6 +579,7 @@ GodotStep3D::GodotStep3D() {
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
+	constraint_colors.reserve(CONSTRAINT_COLOR_COUNT);
 }
 
 GodotStep3D::~GodotStep3D() {
@@ -33,6 +33,7 @@
 
 #include "godot_space_3d.h"
 
+#include "core/templates/a_hash_map.h"
 #include "core/templates/local_vector.h"
 
 class GodotStep3D {
@@ -40,16 +41,30 @@ class GodotStep3D {
 
 	int iterations = 0;
 	real_t delta = 0.0;
+	uint32_t parallel_island_threshold = 0;
 
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
+	LocalVector<GodotBody3D *> active_bodies;
 
+	// Color batches of the large island being solved, constraints of the same color don't share any rigid body.
+	LocalVector<LocalVector<GodotConstraint3D *>> constraint_colors;
+	LocalVector<GodotConstraint3D *> overflow_constraints;
+	AHashMap<const GodotBody3D *, uint64_t> body_color_masks;
+	const LocalVector<GodotConstraint3D *> *solving_batch = nullptr;
+
+	void _gather_active_bodies(const SelfList<GodotBody3D>::List *p_body_list);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
+	void _color_island(const LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _solve_constraint_batch(uint32_t p_constraint_index, void *p_userdata = nullptr);
+	void _solve_island_colored(const LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
 
 public:
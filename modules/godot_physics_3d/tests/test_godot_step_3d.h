@@ -0,0 +1,246 @@
+/**************************************************************************/
+/*  test_godot_step_3d.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GODOT_STEP_3D_H
+#define TEST_GODOT_STEP_3D_H
+
+#include "../godot_physics_server_3d.h"
+
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotStep3D {
+
+// Drops a grid of box columns on the floor, with touching columns so all the boxes form a single island.
+// Returns the final positions of the boxes.
+static Vector<Vector3> simulate_box_pile(int p_columns, int p_height, int p_steps, int p_parallel_threshold, uint64_t *r_usec = nullptr) {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+	server->init();
+
+	const String threshold_setting = "physics/3d/solver/parallel_island_constraint_threshold";
+	const Variant previous_threshold = GLOBAL_GET(threshold_setting);
+	ProjectSettings::get_singleton()->set_setting(threshold_setting, p_parallel_threshold);
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+	server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+	server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+
+	RID floor_shape = server->shape_create(PhysicsServer3D::SHAPE_WORLD_BOUNDARY);
+	server->shape_set_data(floor_shape, Plane(Vector3(0, 1, 0), 0));
+	RID floor = server->body_create();
+	server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	server->body_add_shape(floor, floor_shape);
+	server->body_set_space(floor, space);
+
+	RID box_shape = server->shape_create(PhysicsServer3D::SHAPE_BOX);
+	server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	Vector<RID> boxes;
+	for (int y = 0; y < p_height; y++) {
+		for (int z = 0; z < p_columns; z++) {
+			for (int x = 0; x < p_columns; x++) {
+				RID box = server->body_create();
+				server->body_add_shape(box, box_shape);
+				server->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(x * 0.99, 0.5 + y, z * 0.99)));
+				server->body_set_space(box, space);
+				boxes.push_back(box);
+			}
+		}
+	}
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_steps; i++) {
+		server->step(1.0 / 60.0);
+	}
+	if (r_usec) {
+		*r_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	}
+
+	Vector<Vector3> positions;
+	for (const RID &box : boxes) {
+		positions.push_back(Transform3D(server->body_get_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin);
+		server->free(box);
+	}
+	server->free(floor);
+	server->free(box_shape);
+	server->free(floor_shape);
+	server->free(space);
+
+	ProjectSettings::get_singleton()->set_setting(threshold_setting, previous_threshold);
+
+	server->finish();
+	memdelete(server);
+	return positions;
+}
+
+TEST_CASE("[GodotPhysics3D] Large islands solved in color batches keep a pile stable") {
+	const int columns = 6;
+	const int height = 4;
+
+	// A threshold of 1 solves every island in color batches.
+	Vector<Vector3> batched = simulate_box_pile(columns, height, 120, 1);
+	Vector<Vector3> serial = simulate_box_pile(columns, height, 120, 0);
+	REQUIRE(batched.size() == columns * columns * height);
+	REQUIRE(serial.size() == batched.size());
+
+	for (int i = 0; i < batched.size(); i++) {
+		const Vector3 &position = batched[i];
+		const real_t start_height = 0.5 + i / (columns * columns);
+		CHECK_MESSAGE(position.is_finite(), "Box positions should be finite.");
+		CHECK_MESSAGE(position.y > 0.25, "Boxes shouldn't sink into the floor.");
+		CHECK_MESSAGE(Math::abs(position.y - start_height) < 0.25, "The pile shouldn't collapse or explode.");
+		CHECK_MESSAGE(Math::abs(position.y - serial[i].y) < 0.1, "The batched solver should match the serial solver closely.");
+	}
+}
+
+// Throws a grid of boxes through a grid of areas. The boxes don't collide with each other, so the
+// only broadphase pairs are between boxes and areas. Returns the final transforms of the boxes, and
+// the number of broadphase pairs after each step.
+static void simulate_crossing_boxes(int p_parallel_threshold, Vector<Transform3D> &r_transforms, Vector<int> &r_pair_counts) {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+	server->init();
+
+	const String threshold_setting = "physics/3d/solver/parallel_integration_body_threshold";
+	const Variant previous_threshold = GLOBAL_GET(threshold_setting);
+	ProjectSettings::get_singleton()->set_setting(threshold_setting, p_parallel_threshold);
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+	server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+	server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+
+	RID area_shape = server->shape_create(PhysicsServer3D::SHAPE_BOX);
+	server->shape_set_data(area_shape, Vector3(1, 1, 1));
+
+	Vector<RID> areas;
+	for (int z = 0; z < 8; z++) {
+		for (int x = 0; x < 8; x++) {
+			RID area = server->area_create();
+			server->area_add_shape(area, area_shape);
+			server->area_set_transform(area, Transform3D(Basis(), Vector3(x * 4, -10, z * 4)));
+			server->area_set_collision_layer(area, 0);
+			server->area_set_collision_mask(area, 2);
+			server->area_set_space(area, space);
+			areas.push_back(area);
+		}
+	}
+
+	RID box_shape = server->shape_create(PhysicsServer3D::SHAPE_BOX);
+	server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	Vector<RID> boxes;
+	for (int z = 0; z < 16; z++) {
+		for (int x = 0; x < 16; x++) {
+			const real_t i = boxes.size();
+			RID box = server->body_create();
+			server->body_add_shape(box, box_shape);
+			server->body_set_collision_layer(box, 2);
+			server->body_set_collision_mask(box, 0);
+			server->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(x * 2, 0, z * 2)));
+			server->body_set_space(box, space);
+			server->body_set_state(box, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(Math::sin(i * 0.7) * 3, Math::cos(i * 1.3) * 2, Math::sin(i * 0.3) * 3));
+			server->body_set_state(box, PhysicsServer3D::BODY_STATE_ANGULAR_VELOCITY, Vector3(Math::cos(i * 0.5), Math::sin(i * 0.9), 0.5));
+			boxes.push_back(box);
+		}
+	}
+
+	r_pair_counts.clear();
+	for (int i = 0; i < 120; i++) {
+		server->step(1.0 / 60.0);
+		r_pair_counts.push_back(server->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS));
+	}
+
+	r_transforms.clear();
+	for (const RID &box : boxes) {
+		r_transforms.push_back(server->body_get_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM));
+		server->free(box);
+	}
+	for (const RID &area : areas) {
+		server->free(area);
+	}
+	server->free(box_shape);
+	server->free(area_shape);
+	server->free(space);
+
+	ProjectSettings::get_singleton()->set_setting(threshold_setting, previous_threshold);
+
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[GodotPhysics3D] Integrating bodies in parallel matches serial integration") {
+	// A threshold of 1 always integrates on the worker threads, 0 never does.
+	Vector<Transform3D> parallel_transforms;
+	Vector<int> parallel_pair_counts;
+	simulate_crossing_boxes(1, parallel_transforms, parallel_pair_counts);
+
+	Vector<Transform3D> serial_transforms;
+	Vector<int> serial_pair_counts;
+	simulate_crossing_boxes(0, serial_transforms, serial_pair_counts);
+
+	REQUIRE(parallel_transforms.size() == 256);
+	REQUIRE(serial_transforms.size() == parallel_transforms.size());
+	for (int i = 0; i < parallel_transforms.size(); i++) {
+		CHECK_MESSAGE(parallel_transforms[i] == serial_transforms[i], "Bodies should end up exactly where serial integration puts them.");
+	}
+
+	REQUIRE(serial_pair_counts.size() == parallel_pair_counts.size());
+	bool had_pairs = false;
+	for (int i = 0; i < parallel_pair_counts.size(); i++) {
+		CHECK_MESSAGE(parallel_pair_counts[i] == serial_pair_counts[i], "The broadphase should find the same pairs at every step.");
+		had_pairs = had_pairs || parallel_pair_counts[i] > 0;
+	}
+	CHECK_MESSAGE(had_pairs, "The boxes should go through some of the areas.");
+}
+
+TEST_CASE("[GodotPhysics3D][Benchmark] Solving a large box pile" * doctest::skip()) {
+	// Run with `--test --no-skip --test-case="*Benchmark*"`.
+	const int columns = 20;
+	const int height = 5;
+	const int steps = 120;
+
+	print_line(vformat("%d boxes, %d steps, %d worker threads:", columns * columns * height, steps, WorkerThreadPool::get_singleton()->get_thread_count()));
+
+	uint64_t serial_usec = 0;
+	simulate_box_pile(columns, height, steps, 0, &serial_usec);
+	print_line(vformat("  single-threaded island: %d usec", serial_usec));
+
+	uint64_t batched_usec = 0;
+	simulate_box_pile(columns, height, steps, 256, &batched_usec);
+	print_line(vformat("  color batches: %d usec, %.2fx", batched_usec, batched_usec > 0 ? double(serial_usec) / double(batched_usec) : 0.0));
+}
+
+} // namespace TestGodotStep3D
+
+#endif // TEST_GODOT_STEP_3D_H
@@ -536,7 +536,7 @@ bool SceneTree::physics_process(double p_time) {
 	}
 	physics_process_time = p_time;
 
-	emit_signal(SNAME("physics_frame"));
+	emit_signal(physics_frame_signal);
 
 	call_group(SNAME("_picking_viewports"), SNAME("_process_picking"));
 
@@ -579,7 +579,7 @@ bool SceneTree::process(double p_time) {
 		}
 	}
 
-	emit_signal(SNAME("process_frame"));
+	emit_signal(process_frame_signal);
 
 	MessageQueue::get_singleton()->flush(); //small little hack
 
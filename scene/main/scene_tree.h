@@ -153,6 +153,8 @@ private:
 	StringName node_added_name = "node_added";
 	StringName node_removed_name = "node_removed";
 	StringName node_renamed_name = "node_renamed";
+	SignalHandle physics_frame_signal = SignalHandle("physics_frame");
+	SignalHandle process_frame_signal = SignalHandle("process_frame");
 
 	int64_t current_frame = 0;
 	int nodes_in_tree_count = 0;
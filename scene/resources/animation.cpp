@@ -35,6 +35,7 @@
 #include "core/math/geometry_3d.h"
 
 bool Animation::_set(const StringName &p_name, const Variant &p_value) {
+	_load_lazy_payload_if_needed();
 	String prop_name = p_name;
 
 	if (p_name == SNAME("_compression")) {
@@ -462,6 +463,7 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 }
 
 bool Animation::_get(const StringName &p_name, Variant &r_ret) const {
+	_load_lazy_payload_if_needed();
 	String prop_name = p_name;
 
 	if (p_name == SNAME("_compression")) {
@@ -865,6 +867,7 @@ bool Animation::_get(const StringName &p_name, Variant &r_ret) const {
 }
 
 void Animation::_get_property_list(List<PropertyInfo> *p_list) const {
+	_load_lazy_payload_if_needed();
 	if (compression.enabled) {
 		p_list->push_back(PropertyInfo(Variant::DICTIONARY, "_compression", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 	}
@@ -892,6 +895,7 @@ void Animation::reset_state() {
 }
 
 int Animation::add_track(TrackType p_type, int p_at_pos) {
+	_load_lazy_payload_if_needed();
 	if (p_at_pos < 0 || p_at_pos >= tracks.size()) {
 		p_at_pos = tracks.size();
 	}
@@ -942,6 +946,7 @@ int Animation::add_track(TrackType p_type, int p_at_pos) {
 }
 
 void Animation::remove_track(int p_track) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 
@@ -1004,6 +1009,7 @@ void Animation::remove_track(int p_track) {
 }
 
 bool Animation::is_capture_included() const {
+	_load_lazy_payload_if_needed();
 	return capture_included;
 }
 
@@ -1021,15 +1027,18 @@ void Animation::_check_capture_included() {
 }
 
 int Animation::get_track_count() const {
+	_load_lazy_payload_if_needed();
 	return tracks.size();
 }
 
 Animation::TrackType Animation::track_get_type(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), TYPE_VALUE);
 	return tracks[p_track]->type;
 }
 
 void Animation::track_set_path(int p_track, const NodePath &p_path) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	tracks[p_track]->path = p_path;
 	_track_update_hash(p_track);
@@ -1037,11 +1046,13 @@ void Animation::track_set_path(int p_track, const NodePath &p_path) {
 }
 
 NodePath Animation::track_get_path(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), NodePath());
 	return tracks[p_track]->path;
 }
 
 int Animation::find_track(const NodePath &p_path, const TrackType p_type) const {
+	_load_lazy_payload_if_needed();
 	for (int i = 0; i < tracks.size(); i++) {
 		if (tracks[i]->path == p_path && tracks[i]->type == p_type) {
 			return i;
@@ -1067,28 +1078,33 @@ void Animation::_track_update_hash(int p_track) {
 }
 
 Animation::TypeHash Animation::track_get_type_hash(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), 0);
 	return tracks[p_track]->thash;
 }
 
 void Animation::track_set_interpolation_type(int p_track, InterpolationType p_interp) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	tracks[p_track]->interpolation = p_interp;
 	emit_changed();
 }
 
 Animation::InterpolationType Animation::track_get_interpolation_type(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), INTERPOLATION_NEAREST);
 	return tracks[p_track]->interpolation;
 }
 
 void Animation::track_set_interpolation_loop_wrap(int p_track, bool p_enable) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	tracks[p_track]->loop_wrap = p_enable;
 	emit_changed();
 }
 
 bool Animation::track_get_interpolation_loop_wrap(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), INTERPOLATION_NEAREST);
 	return tracks[p_track]->loop_wrap;
 }
@@ -1146,6 +1162,7 @@ void Animation::_clear(T &p_keys) {
 ////
 
 int Animation::position_track_insert_key(int p_track, double p_time, const Vector3 &p_position) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_POSITION_3D, -1);
@@ -1164,6 +1181,7 @@ int Animation::position_track_insert_key(int p_track, double p_time, const Vecto
 }
 
 Error Animation::position_track_get_key(int p_track, int p_key, Vector3 *r_position) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 
@@ -1190,6 +1208,7 @@ Error Animation::position_track_get_key(int p_track, int p_key, Vector3 *r_posit
 }
 
 Error Animation::try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_POSITION_3D, ERR_INVALID_PARAMETER);
@@ -1216,6 +1235,7 @@ Error Animation::try_position_track_interpolate(int p_track, double p_time, Vect
 }
 
 Vector3 Animation::position_track_interpolate(int p_track, double p_time, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	Vector3 ret = Vector3(0, 0, 0);
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ret);
 	bool err = try_position_track_interpolate(p_track, p_time, &ret, p_backward);
@@ -1226,6 +1246,7 @@ Vector3 Animation::position_track_interpolate(int p_track, double p_time, bool p
 ////
 
 int Animation::rotation_track_insert_key(int p_track, double p_time, const Quaternion &p_rotation) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_3D, -1);
@@ -1244,6 +1265,7 @@ int Animation::rotation_track_insert_key(int p_track, double p_time, const Quate
 }
 
 Error Animation::rotation_track_get_key(int p_track, int p_key, Quaternion *r_rotation) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 
@@ -1270,6 +1292,7 @@ Error Animation::rotation_track_get_key(int p_track, int p_key, Quaternion *r_ro
 }
 
 Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_3D, ERR_INVALID_PARAMETER);
@@ -1296,6 +1319,7 @@ Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quat
 }
 
 Quaternion Animation::rotation_track_interpolate(int p_track, double p_time, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	Quaternion ret = Quaternion(0, 0, 0, 1);
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ret);
 	bool err = try_rotation_track_interpolate(p_track, p_time, &ret, p_backward);
@@ -1306,6 +1330,7 @@ Quaternion Animation::rotation_track_interpolate(int p_track, double p_time, boo
 ////
 
 int Animation::scale_track_insert_key(int p_track, double p_time, const Vector3 &p_scale) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_SCALE_3D, -1);
@@ -1324,6 +1349,7 @@ int Animation::scale_track_insert_key(int p_track, double p_time, const Vector3
 }
 
 Error Animation::scale_track_get_key(int p_track, int p_key, Vector3 *r_scale) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 
@@ -1350,6 +1376,7 @@ Error Animation::scale_track_get_key(int p_track, int p_key, Vector3 *r_scale) c
 }
 
 Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_SCALE_3D, ERR_INVALID_PARAMETER);
@@ -1376,6 +1403,7 @@ Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3
 }
 
 Vector3 Animation::scale_track_interpolate(int p_track, double p_time, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	Vector3 ret = Vector3(1, 1, 1);
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ret);
 	bool err = try_scale_track_interpolate(p_track, p_time, &ret, p_backward);
@@ -1386,6 +1414,7 @@ Vector3 Animation::scale_track_interpolate(int p_track, double p_time, bool p_ba
 ////
 
 int Animation::blend_shape_track_insert_key(int p_track, double p_time, float p_blend_shape) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BLEND_SHAPE, -1);
@@ -1404,6 +1433,7 @@ int Animation::blend_shape_track_insert_key(int p_track, double p_time, float p_
 }
 
 Error Animation::blend_shape_track_get_key(int p_track, int p_key, float *r_blend_shape) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 
@@ -1430,6 +1460,7 @@ Error Animation::blend_shape_track_get_key(int p_track, int p_key, float *r_blen
 }
 
 Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BLEND_SHAPE, ERR_INVALID_PARAMETER);
@@ -1456,6 +1487,7 @@ Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, f
 }
 
 float Animation::blend_shape_track_interpolate(int p_track, double p_time, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	float ret = 0;
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ret);
 	bool err = try_blend_shape_track_interpolate(p_track, p_time, &ret, p_backward);
@@ -1472,6 +1504,7 @@ void Animation::track_remove_key_at_time(int p_track, double p_time) {
 }
 
 void Animation::track_remove_key(int p_track, int p_idx) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 
@@ -1548,6 +1581,7 @@ void Animation::track_remove_key(int p_track, int p_idx) {
 }
 
 int Animation::track_find_key(int p_track, double p_time, FindMode p_find_mode, bool p_limit, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 
@@ -1726,6 +1760,7 @@ int Animation::track_find_key(int p_track, double p_time, FindMode p_find_mode,
 }
 
 int Animation::track_insert_key(int p_track, double p_time, const Variant &p_key, real_t p_transition) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 
@@ -1843,6 +1878,7 @@ int Animation::track_insert_key(int p_track, double p_time, const Variant &p_key
 }
 
 int Animation::track_get_key_count(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 
@@ -1902,6 +1938,7 @@ int Animation::track_get_key_count(int p_track) const {
 }
 
 Variant Animation::track_get_key_value(int p_track, int p_key_idx) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), Variant());
 	Track *t = tracks[p_track];
 
@@ -1979,6 +2016,7 @@ Variant Animation::track_get_key_value(int p_track, int p_key_idx) const {
 }
 
 double Animation::track_get_key_time(int p_track, int p_key_idx) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 
@@ -2067,6 +2105,7 @@ double Animation::track_get_key_time(int p_track, int p_key_idx) const {
 }
 
 void Animation::track_set_key_time(int p_track, int p_key_idx, double p_time) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 
@@ -2162,6 +2201,7 @@ void Animation::track_set_key_time(int p_track, int p_key_idx, double p_time) {
 }
 
 real_t Animation::track_get_key_transition(int p_track, int p_key_idx) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 
@@ -2225,6 +2265,7 @@ real_t Animation::track_get_key_transition(int p_track, int p_key_idx) const {
 }
 
 bool Animation::track_is_compressed(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
 	Track *t = tracks[p_track];
 
@@ -2252,6 +2293,7 @@ bool Animation::track_is_compressed(int p_track) const {
 }
 
 void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p_value) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 
@@ -2354,6 +2396,7 @@ void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p
 }
 
 void Animation::track_set_key_transition(int p_track, int p_key_idx, real_t p_transition) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 
@@ -2730,6 +2773,7 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 }
 
 Variant Animation::value_track_interpolate(int p_track, double p_time, bool p_backward) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), 0);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_VALUE, Variant());
@@ -2747,6 +2791,7 @@ Variant Animation::value_track_interpolate(int p_track, double p_time, bool p_ba
 }
 
 void Animation::value_track_set_update_mode(int p_track, UpdateMode p_mode) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_VALUE);
@@ -2760,6 +2805,7 @@ void Animation::value_track_set_update_mode(int p_track, UpdateMode p_mode) {
 }
 
 Animation::UpdateMode Animation::value_track_get_update_mode(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), UPDATE_CONTINUOUS);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_VALUE, UPDATE_CONTINUOUS);
@@ -2823,6 +2869,7 @@ void Animation::_track_get_key_indices_in_range(const Vector<T> &p_array, double
 }
 
 void Animation::track_get_key_indices_in_range(int p_track, double p_time, double p_delta, List<int> *p_indices, Animation::LoopedFlag p_looped_flag) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 
 	if (p_delta == 0) {
@@ -3215,6 +3262,7 @@ void Animation::track_get_key_indices_in_range(int p_track, double p_time, doubl
 }
 
 void Animation::add_marker(const StringName &p_name, double p_time) {
+	_load_lazy_payload_if_needed();
 	int idx = _find(marker_names, p_time);
 
 	if (idx >= 0 && idx < marker_names.size() && Math::is_equal_approx(p_time, marker_names[idx].time)) {
@@ -3231,6 +3279,7 @@ void Animation::add_marker(const StringName &p_name, double p_time) {
 }
 
 void Animation::remove_marker(const StringName &p_name) {
+	_load_lazy_payload_if_needed();
 	HashMap<StringName, double>::Iterator E = marker_times.find(p_name);
 	ERR_FAIL_COND(!E);
 	int idx = _find(marker_names, E->value);
@@ -3242,10 +3291,12 @@ void Animation::remove_marker(const StringName &p_name) {
 }
 
 bool Animation::has_marker(const StringName &p_name) const {
+	_load_lazy_payload_if_needed();
 	return marker_times.has(p_name);
 }
 
 StringName Animation::get_marker_at_time(double p_time) const {
+	_load_lazy_payload_if_needed();
 	int idx = _find(marker_names, p_time);
 
 	if (idx >= 0 && idx < marker_names.size() && Math::is_equal_approx(marker_names[idx].time, p_time)) {
@@ -3256,6 +3307,7 @@ StringName Animation::get_marker_at_time(double p_time) const {
 }
 
 StringName Animation::get_next_marker(double p_time) const {
+	_load_lazy_payload_if_needed();
 	int idx = _find(marker_names, p_time);
 
 	if (idx >= -1 && idx < marker_names.size() - 1) {
@@ -3267,6 +3319,7 @@ StringName Animation::get_next_marker(double p_time) const {
 }
 
 StringName Animation::get_prev_marker(double p_time) const {
+	_load_lazy_payload_if_needed();
 	int idx = _find(marker_names, p_time);
 
 	if (idx >= 0 && idx < marker_names.size()) {
@@ -3276,11 +3329,13 @@ StringName Animation::get_prev_marker(double p_time) const {
 }
 
 double Animation::get_marker_time(const StringName &p_name) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_COND_V(!marker_times.has(p_name), -1);
 	return marker_times.get(p_name);
 }
 
 PackedStringArray Animation::get_marker_names() const {
+	_load_lazy_payload_if_needed();
 	PackedStringArray names;
 	// We iterate on marker_names so the result is sorted by time.
 	for (const MarkerKey &marker_name : marker_names) {
@@ -3290,15 +3345,18 @@ PackedStringArray Animation::get_marker_names() const {
 }
 
 Color Animation::get_marker_color(const StringName &p_name) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_COND_V(!marker_colors.has(p_name), Color());
 	return marker_colors[p_name];
 }
 
 void Animation::set_marker_color(const StringName &p_name, const Color &p_color) {
+	_load_lazy_payload_if_needed();
 	marker_colors[p_name] = p_color;
 }
 
 Vector<Variant> Animation::method_track_get_params(int p_track, int p_key_idx) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), Vector<Variant>());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_METHOD, Vector<Variant>());
@@ -3313,6 +3371,7 @@ Vector<Variant> Animation::method_track_get_params(int p_track, int p_key_idx) c
 }
 
 StringName Animation::method_track_get_name(int p_track, int p_key_idx) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), StringName());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_METHOD, StringName());
@@ -3325,6 +3384,7 @@ StringName Animation::method_track_get_name(int p_track, int p_key_idx) const {
 }
 
 Array Animation::make_default_bezier_key(float p_value) {
+	_load_lazy_payload_if_needed();
 	const double max_width = length / 2.0;
 	Array new_point;
 	new_point.resize(5);
@@ -3339,6 +3399,7 @@ Array Animation::make_default_bezier_key(float p_value) {
 }
 
 int Animation::bezier_track_insert_key(int p_track, double p_time, real_t p_value, const Vector2 &p_in_handle, const Vector2 &p_out_handle) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BEZIER, -1);
@@ -3365,6 +3426,7 @@ int Animation::bezier_track_insert_key(int p_track, double p_time, real_t p_valu
 }
 
 void Animation::bezier_track_set_key_value(int p_track, int p_index, real_t p_value) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_BEZIER);
@@ -3379,6 +3441,7 @@ void Animation::bezier_track_set_key_value(int p_track, int p_index, real_t p_va
 }
 
 void Animation::bezier_track_set_key_in_handle(int p_track, int p_index, const Vector2 &p_handle, real_t p_balanced_value_time_ratio) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_BEZIER);
@@ -3414,6 +3477,7 @@ void Animation::bezier_track_set_key_in_handle(int p_track, int p_index, const V
 }
 
 void Animation::bezier_track_set_key_out_handle(int p_track, int p_index, const Vector2 &p_handle, real_t p_balanced_value_time_ratio) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_BEZIER);
@@ -3449,6 +3513,7 @@ void Animation::bezier_track_set_key_out_handle(int p_track, int p_index, const
 }
 
 real_t Animation::bezier_track_get_key_value(int p_track, int p_index) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), 0);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BEZIER, 0);
@@ -3461,6 +3526,7 @@ real_t Animation::bezier_track_get_key_value(int p_track, int p_index) const {
 }
 
 Vector2 Animation::bezier_track_get_key_in_handle(int p_track, int p_index) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), Vector2());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BEZIER, Vector2());
@@ -3473,6 +3539,7 @@ Vector2 Animation::bezier_track_get_key_in_handle(int p_track, int p_index) cons
 }
 
 Vector2 Animation::bezier_track_get_key_out_handle(int p_track, int p_index) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), Vector2());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BEZIER, Vector2());
@@ -3486,6 +3553,7 @@ Vector2 Animation::bezier_track_get_key_out_handle(int p_track, int p_index) con
 
 #ifdef TOOLS_ENABLED
 void Animation::bezier_track_set_key_handle_mode(int p_track, int p_index, HandleMode p_mode, HandleSetMode p_set_mode) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_BEZIER);
@@ -3575,6 +3643,7 @@ void Animation::bezier_track_set_key_handle_mode(int p_track, int p_index, Handl
 }
 
 Animation::HandleMode Animation::bezier_track_get_key_handle_mode(int p_track, int p_index) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), HANDLE_MODE_FREE);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BEZIER, HANDLE_MODE_FREE);
@@ -3588,6 +3657,7 @@ Animation::HandleMode Animation::bezier_track_get_key_handle_mode(int p_track, i
 #endif // TOOLS_ENABLED
 
 real_t Animation::bezier_track_interpolate(int p_track, double p_time) const {
+	_load_lazy_payload_if_needed();
 	//this uses a different interpolation scheme
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), 0);
 	Track *track = tracks[p_track];
@@ -3653,6 +3723,7 @@ real_t Animation::bezier_track_interpolate(int p_track, double p_time) const {
 }
 
 int Animation::audio_track_insert_key(int p_track, double p_time, const Ref<Resource> &p_stream, real_t p_start_offset, real_t p_end_offset) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_AUDIO, -1);
@@ -3679,6 +3750,7 @@ int Animation::audio_track_insert_key(int p_track, double p_time, const Ref<Reso
 }
 
 void Animation::audio_track_set_key_stream(int p_track, int p_key, const Ref<Resource> &p_stream) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_AUDIO);
@@ -3693,6 +3765,7 @@ void Animation::audio_track_set_key_stream(int p_track, int p_key, const Ref<Res
 }
 
 void Animation::audio_track_set_key_start_offset(int p_track, int p_key, real_t p_offset) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_AUDIO);
@@ -3711,6 +3784,7 @@ void Animation::audio_track_set_key_start_offset(int p_track, int p_key, real_t
 }
 
 void Animation::audio_track_set_key_end_offset(int p_track, int p_key, real_t p_offset) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_AUDIO);
@@ -3729,6 +3803,7 @@ void Animation::audio_track_set_key_end_offset(int p_track, int p_key, real_t p_
 }
 
 Ref<Resource> Animation::audio_track_get_key_stream(int p_track, int p_key) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), Ref<Resource>());
 	const Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_AUDIO, Ref<Resource>());
@@ -3741,6 +3816,7 @@ Ref<Resource> Animation::audio_track_get_key_stream(int p_track, int p_key) cons
 }
 
 real_t Animation::audio_track_get_key_start_offset(int p_track, int p_key) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), 0);
 	const Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_AUDIO, 0);
@@ -3753,6 +3829,7 @@ real_t Animation::audio_track_get_key_start_offset(int p_track, int p_key) const
 }
 
 real_t Animation::audio_track_get_key_end_offset(int p_track, int p_key) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), 0);
 	const Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_AUDIO, 0);
@@ -3765,6 +3842,7 @@ real_t Animation::audio_track_get_key_end_offset(int p_track, int p_key) const {
 }
 
 void Animation::audio_track_set_use_blend(int p_track, bool p_enable) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_AUDIO);
@@ -3776,6 +3854,7 @@ void Animation::audio_track_set_use_blend(int p_track, bool p_enable) {
 }
 
 bool Animation::audio_track_is_use_blend(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_AUDIO, false);
@@ -3788,6 +3867,7 @@ bool Animation::audio_track_is_use_blend(int p_track) const {
 //
 
 int Animation::animation_track_insert_key(int p_track, double p_time, const StringName &p_animation) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), -1);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_ANIMATION, -1);
@@ -3806,6 +3886,7 @@ int Animation::animation_track_insert_key(int p_track, double p_time, const Stri
 }
 
 void Animation::animation_track_set_key_animation(int p_track, int p_key, const StringName &p_animation) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND(t->type != TYPE_ANIMATION);
@@ -3820,6 +3901,7 @@ void Animation::animation_track_set_key_animation(int p_track, int p_key, const
 }
 
 StringName Animation::animation_track_get_key_animation(int p_track, int p_key) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), StringName());
 	const Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_ANIMATION, StringName());
@@ -3832,6 +3914,7 @@ StringName Animation::animation_track_get_key_animation(int p_track, int p_key)
 }
 
 void Animation::set_length(real_t p_length) {
+	_load_lazy_payload_if_needed();
 	if (p_length < ANIM_MIN_LENGTH) {
 		p_length = ANIM_MIN_LENGTH;
 	}
@@ -3840,40 +3923,48 @@ void Animation::set_length(real_t p_length) {
 }
 
 real_t Animation::get_length() const {
+	_load_lazy_payload_if_needed();
 	return length;
 }
 
 void Animation::set_loop_mode(Animation::LoopMode p_loop_mode) {
+	_load_lazy_payload_if_needed();
 	loop_mode = p_loop_mode;
 	emit_changed();
 }
 
 Animation::LoopMode Animation::get_loop_mode() const {
+	_load_lazy_payload_if_needed();
 	return loop_mode;
 }
 
 void Animation::track_set_imported(int p_track, bool p_imported) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	tracks[p_track]->imported = p_imported;
 }
 
 bool Animation::track_is_imported(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
 	return tracks[p_track]->imported;
 }
 
 void Animation::track_set_enabled(int p_track, bool p_enabled) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	tracks[p_track]->enabled = p_enabled;
 	emit_changed();
 }
 
 bool Animation::track_is_enabled(int p_track) const {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
 	return tracks[p_track]->enabled;
 }
 
 void Animation::track_move_up(int p_track) {
+	_load_lazy_payload_if_needed();
 	if (p_track >= 0 && p_track < (tracks.size() - 1)) {
 		SWAP(tracks.write[p_track], tracks.write[p_track + 1]);
 	}
@@ -3882,6 +3973,7 @@ void Animation::track_move_up(int p_track) {
 }
 
 void Animation::track_move_down(int p_track) {
+	_load_lazy_payload_if_needed();
 	if (p_track > 0 && p_track < tracks.size()) {
 		SWAP(tracks.write[p_track], tracks.write[p_track - 1]);
 	}
@@ -3890,6 +3982,7 @@ void Animation::track_move_down(int p_track) {
 }
 
 void Animation::track_move_to(int p_track, int p_to_index) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	ERR_FAIL_INDEX(p_to_index, tracks.size() + 1);
 	if (p_track == p_to_index || p_track == p_to_index - 1) {
@@ -3905,6 +3998,7 @@ void Animation::track_move_to(int p_track, int p_to_index) {
 }
 
 void Animation::track_swap(int p_track, int p_with_track) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_INDEX(p_track, tracks.size());
 	ERR_FAIL_INDEX(p_with_track, tracks.size());
 	if (p_track == p_with_track) {
@@ -3916,11 +4010,13 @@ void Animation::track_swap(int p_track, int p_with_track) {
 }
 
 void Animation::set_step(real_t p_step) {
+	_load_lazy_payload_if_needed();
 	step = p_step;
 	emit_changed();
 }
 
 real_t Animation::get_step() const {
+	_load_lazy_payload_if_needed();
 	return step;
 }
 
@@ -4096,6 +4192,7 @@ void Animation::_bind_methods() {
 }
 
 void Animation::clear() {
+	_load_lazy_payload_if_needed();
 	for (int i = 0; i < tracks.size(); i++) {
 		memdelete(tracks[i]);
 	}
@@ -4457,6 +4554,7 @@ void Animation::_value_track_optimize(int p_idx, real_t p_allowed_velocity_err,
 }
 
 void Animation::optimize(real_t p_allowed_velocity_err, real_t p_allowed_angular_err, int p_precision) {
+	_load_lazy_payload_if_needed();
 	real_t precision = Math::pow(0.1, p_precision);
 	for (int i = 0; i < tracks.size(); i++) {
 		if (track_is_compressed(i)) {
@@ -4825,6 +4923,7 @@ struct AnimationCompressionBufferBitsRead {
 };
 
 void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tolerance) {
+	_load_lazy_payload_if_needed();
 	ERR_FAIL_COND_MSG(compression.enabled, "This animation is already compressed");
 
 	p_split_tolerance = CLAMP(p_split_tolerance, 1.1, 8.0);
@@ -413,6 +413,7 @@ public:
 	void remove_track(int p_track);
 
 	_FORCE_INLINE_ const Vector<Track *> get_tracks() {
+		_load_lazy_payload_if_needed();
 		return tracks;
 	}
 
@@ -539,6 +540,10 @@ public:
 
 	void clear();
 
+	// Track data is only read through the track count, track lookup and properties, so those
+	// load the deferred properties of lazily loaded animations.
+	virtual bool is_lazy_loadable() const override { return true; }
+
 	void optimize(real_t p_allowed_velocity_err = 0.01, real_t p_allowed_angular_err = 0.01, int p_precision = 3);
 	void compress(uint32_t p_page_size = 8192, uint32_t p_fps = 120, float p_split_tolerance = 4.0); // 4.0 seems to be the split tolerance sweet spot from many tests.
 
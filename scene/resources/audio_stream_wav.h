@@ -179,6 +179,8 @@ public:
 	}
 	virtual Ref<AudioSample> generate_sample() const override;
 
+	virtual uint64_t get_memory_usage_estimate() const override { return data_bytes; }
+
 	AudioStreamWAV();
 	~AudioStreamWAV();
 };
@@ -121,6 +121,10 @@ CompressedTexture2D::TextureFormatRequestCallback CompressedTexture2D::request_3
 CompressedTexture2D::TextureFormatRoughnessRequestCallback CompressedTexture2D::request_roughness_callback = nullptr;
 CompressedTexture2D::TextureFormatRequestCallback CompressedTexture2D::request_normal_callback = nullptr;
 
+uint64_t CompressedTexture2D::get_memory_usage_estimate() const {
+	return data_size;
+}
+
 Image::Format CompressedTexture2D::get_format() const {
 	return format;
 }
@@ -154,6 +158,7 @@ Error CompressedTexture2D::load(const String &p_path) {
 	h = lh;
 	path_to_file = p_path;
 	format = image->get_format();
+	data_size = image->get_data_size();
 
 	if (get_path().is_empty()) {
 		//temporarily set path if no path set for resource, helps find errors
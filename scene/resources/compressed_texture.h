@@ -63,6 +63,7 @@ private:
 	String path_to_file;
 	mutable RID texture;
 	Image::Format format = Image::FORMAT_L8;
+	uint64_t data_size = 0; // Of the image as uploaded, in its actual format.
 	int w = 0;
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
@@ -91,6 +92,7 @@ public:
 	Image::Format get_format() const;
 	Error load(const String &p_path);
 	String get_load_path() const;
+	virtual uint64_t get_memory_usage_estimate() const override;
 
 	int get_width() const override;
 	int get_height() const override;
@@ -88,6 +88,7 @@ void ImageTexture::set_image(const Ref<Image> &p_image) {
 	h = p_image->get_height();
 	format = p_image->get_format();
 	mipmaps = p_image->has_mipmaps();
+	data_size = p_image->get_data_size();
 
 	if (texture.is_null()) {
 		texture = RenderingServer::get_singleton()->texture_2d_create(p_image);
@@ -101,6 +102,10 @@ void ImageTexture::set_image(const Ref<Image> &p_image) {
 	image_stored = true;
 }
 
+uint64_t ImageTexture::get_memory_usage_estimate() const {
+	return data_size;
+}
+
 Image::Format ImageTexture::get_format() const {
 	return format;
 }
@@ -42,6 +42,7 @@ class ImageTexture : public Texture2D {
 	mutable RID texture;
 	Image::Format format = Image::FORMAT_L8;
 	bool mipmaps = false;
+	uint64_t data_size = 0; // Of the image as uploaded, w and h may be overridden.
 	int w = 0;
 	int h = 0;
 	Size2 size_override;
@@ -62,6 +63,7 @@ public:
 	static Ref<ImageTexture> create_from_image(const Ref<Image> &p_image);
 
 	Image::Format get_format() const;
+	virtual uint64_t get_memory_usage_estimate() const override;
 
 	void update(const Ref<Image> &p_image);
 	Ref<Image> get_image() const override;
@@ -44,6 +44,11 @@ int Texture2D::get_height() const {
 	return ret;
 }
 
+uint64_t Texture2D::get_memory_usage_estimate() const {
+	// Textures knowing their format override this; otherwise assume RGBA8 without mipmaps.
+	return uint64_t(get_width()) * get_height() * 4;
+}
+
 Size2 Texture2D::get_size() const {
 	return Size2(get_width(), get_height());
 }
@@ -83,6 +83,7 @@ public:
 	virtual Ref<Image> get_image() const { return Ref<Image>(); }
 
 	virtual Ref<Resource> create_placeholder() const;
+	virtual uint64_t get_memory_usage_estimate() const override;
 
 	Texture2D();
 };
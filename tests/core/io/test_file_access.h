@@ -32,6 +32,7 @@
 #define TEST_FILE_ACCESS_H
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_memory.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -107,6 +108,43 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Mapped contents match buffered reads") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+	REQUIRE(!f.is_null());
+	Vector<uint8_t> buffered = f->get_buffer(f->get_length());
+
+	uint64_t length = 0;
+	const uint8_t *mapped = f->map_read_only(length);
+#ifdef UNIX_ENABLED
+	REQUIRE(mapped != nullptr);
+#endif
+	if (mapped) {
+		CHECK(length == (uint64_t)buffered.size());
+		CHECK(memcmp(mapped, buffered.ptr(), length) == 0);
+	}
+}
+
+TEST_CASE("[FileAccess] Buffer views") {
+	const uint8_t data[] = { 1, 2, 3, 4, 5, 6 };
+	Ref<FileAccessMemory> f;
+	f.instantiate();
+	REQUIRE(f->open_custom(data, sizeof(data)) == OK);
+
+	const uint8_t *view = f->get_buffer_view(4);
+	REQUIRE(view != nullptr);
+	CHECK(view == data);
+	CHECK(f->get_position() == 4);
+
+	// Asking for more than what is left gives no view and keeps the position.
+	CHECK(f->get_buffer_view(3) == nullptr);
+	CHECK(f->get_position() == 4);
+
+	view = f->get_buffer_view(2);
+	REQUIRE(view != nullptr);
+	CHECK(view[0] == 5);
+	CHECK(view[1] == 6);
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
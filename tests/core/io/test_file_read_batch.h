@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*  test_file_read_batch.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FILE_READ_BATCH_H
+#define TEST_FILE_READ_BATCH_H
+
+#include "core/io/file_access_memory.h"
+#include "core/io/file_read_batch.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFileReadBatch {
+
+TEST_CASE("[FileReadBatch] Reads from several files") {
+	uint8_t data_a[256];
+	uint8_t data_b[64];
+	for (int i = 0; i < 256; i++) {
+		data_a[i] = i;
+	}
+	for (int i = 0; i < 64; i++) {
+		data_b[i] = 255 - i;
+	}
+
+	Ref<FileAccessMemory> file_a;
+	file_a.instantiate();
+	REQUIRE(file_a->open_custom(data_a, sizeof(data_a)) == OK);
+	Ref<FileAccessMemory> file_b;
+	file_b.instantiate();
+	REQUIRE(file_b->open_custom(data_b, sizeof(data_b)) == OK);
+
+	uint8_t dst_a_high[16];
+	uint8_t dst_a_low[16];
+	uint8_t dst_b[8];
+
+	FileReadBatch batch;
+	// Added out of offset order on purpose.
+	uint32_t read_a_high = batch.add_read(file_a, 200, dst_a_high, 16);
+	uint32_t read_b = batch.add_read(file_b, 60, dst_b, 8);
+	uint32_t read_a_low = batch.add_read(file_a, 10, dst_a_low, 16);
+	// Reading past the end of a file warns.
+	ERR_PRINT_OFF;
+	batch.submit();
+	batch.wait();
+	ERR_PRINT_ON;
+	CHECK(batch.is_completed());
+
+	CHECK(batch.get_read_length(read_a_high) == 16);
+	CHECK(batch.get_read_length(read_a_low) == 16);
+	for (int i = 0; i < 16; i++) {
+		CHECK(dst_a_high[i] == 200 + i);
+		CHECK(dst_a_low[i] == 10 + i);
+	}
+
+	// Reading past the end only gives what is left.
+	CHECK(batch.get_read_length(read_b) == 4);
+	for (int i = 0; i < 4; i++) {
+		CHECK(dst_b[i] == 255 - 60 - i);
+	}
+}
+
+TEST_CASE("[FileReadBatch] Empty batch") {
+	FileReadBatch batch;
+	batch.submit();
+	CHECK(batch.is_completed());
+	batch.wait();
+}
+
+struct PoolThreadRead {
+	uint8_t data[128];
+	uint8_t dst[128];
+	uint64_t read = 0;
+
+	void read_from_task(void *p_userdata) {
+		Ref<FileAccessMemory> file;
+		file.instantiate();
+		file->open_custom(data, sizeof(data));
+		FileReadBatch batch;
+		uint32_t read_index = batch.add_read(file, 0, dst, sizeof(dst));
+		batch.submit();
+		batch.wait();
+		read = batch.get_read_length(read_index);
+	}
+};
+
+TEST_CASE("[FileReadBatch] Waited for from every pool thread at once") {
+	// Batches waited for from pool threads must not need a free thread to complete.
+	const int task_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	LocalVector<PoolThreadRead> reads;
+	reads.resize(task_count);
+	LocalVector<WorkerThreadPool::TaskID> tasks;
+	for (PoolThreadRead &read : reads) {
+		for (int i = 0; i < 128; i++) {
+			read.data[i] = i * 3;
+		}
+		tasks.push_back(WorkerThreadPool::get_singleton()->add_template_task(&read, &PoolThreadRead::read_from_task, nullptr));
+	}
+	for (WorkerThreadPool::TaskID task_id : tasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	}
+	for (const PoolThreadRead &read : reads) {
+		CHECK(read.read == 128);
+		CHECK(memcmp(read.data, read.dst, 128) == 0);
+	}
+}
+
+} // namespace TestFileReadBatch
+
+#endif // TEST_FILE_READ_BATCH_H
@@ -416,6 +416,158 @@ TEST_CASE("[Image] Custom mipmaps") {
 	}
 }
 
+TEST_CASE("[Image] Processing large images in bands") {
+	// Large enough to be split over the WorkerThreadPool, so band boundaries get exercised.
+	const int size = 512;
+	PackedByteArray source;
+	source.resize(size * size * 4);
+	uint8_t *source_ptr = source.ptrw();
+	for (int y = 0; y < size; y++) {
+		for (int x = 0; x < size; x++) {
+			uint8_t *pixel = &source_ptr[(y * size + x) * 4];
+			pixel[0] = x & 255;
+			pixel[1] = y & 255;
+			pixel[2] = (x * 7 + y * 3) & 255;
+			pixel[3] = 255;
+		}
+	}
+
+	Ref<Image> image = memnew(Image(size, size, false, Image::FORMAT_RGBA8, source));
+	image->generate_mipmaps();
+	REQUIRE(image->has_mipmaps());
+
+	{
+		int64_t mip_offset = 0;
+		int64_t mip_size = 0;
+		image->get_mipmap_offset_and_size(1, mip_offset, mip_size);
+		REQUIRE(mip_size == (size / 2) * (size / 2) * 4);
+
+		PackedByteArray data = image->get_data();
+		const uint8_t *mip_ptr = data.ptr() + mip_offset;
+		bool matches = true;
+		for (int y = 0; y < size / 2 && matches; y++) {
+			for (int x = 0; x < size / 2 && matches; x++) {
+				for (int c = 0; c < 4; c++) {
+					int sum = source_ptr[((y * 2) * size + x * 2) * 4 + c] + source_ptr[((y * 2) * size + x * 2 + 1) * 4 + c] +
+							source_ptr[((y * 2 + 1) * size + x * 2) * 4 + c] + source_ptr[((y * 2 + 1) * size + x * 2 + 1) * 4 + c];
+					if (mip_ptr[(y * (size / 2) + x) * 4 + c] != ((sum + 2) >> 2)) {
+						matches = false;
+					}
+				}
+			}
+		}
+		CHECK_MESSAGE(matches, "Every pixel of the first mipmap should be the average of its 2x2 source block.");
+	}
+
+	Ref<Image> image_resized = memnew(Image(size, size, false, Image::FORMAT_RGBA8, source));
+	image_resized->resize(size / 2, size / 2, Image::INTERPOLATE_NEAREST);
+	{
+		PackedByteArray data = image_resized->get_data();
+		const uint8_t *data_ptr = data.ptr();
+		bool matches = true;
+		for (int y = 0; y < size / 2 && matches; y++) {
+			for (int x = 0; x < size / 2 && matches; x++) {
+				for (int c = 0; c < 4; c++) {
+					if (data_ptr[(y * (size / 2) + x) * 4 + c] != source_ptr[((y * 2) * size + x * 2) * 4 + c]) {
+						matches = false;
+					}
+				}
+			}
+		}
+		CHECK_MESSAGE(matches, "Every pixel of a nearest-neighbor downscale should come from its source pixel.");
+	}
+
+	for (int i = Image::INTERPOLATE_BILINEAR; i <= Image::INTERPOLATE_LANCZOS; i++) {
+		Ref<Image> image_interpolated = memnew(Image(size, size, false, Image::FORMAT_RGBA8, source));
+		image_interpolated->resize(size / 2 + 3, size / 2 + 5, static_cast<Image::Interpolation>(i));
+		CHECK(image_interpolated->get_size() == Vector2(size / 2 + 3, size / 2 + 5));
+		// Alpha is constant, so every interpolation should preserve it everywhere.
+		CHECK(image_interpolated->get_pixel(0, 0).a == doctest::Approx(1.0));
+		CHECK(image_interpolated->get_pixel(size / 4, size / 4).a == doctest::Approx(1.0));
+		CHECK(image_interpolated->get_pixel(size / 2 + 2, size / 2 + 4).a == doctest::Approx(1.0));
+	}
+}
+
+TEST_CASE("[Image] Mipmaps of float images") {
+	// Not a multiple of the vectorized width, so the scalar tail of each row is used as well.
+	const int width = 22;
+	const int height = 6;
+	PackedByteArray source;
+	source.resize(width * height * 4 * sizeof(float));
+	float *source_ptr = reinterpret_cast<float *>(source.ptrw());
+	for (int i = 0; i < width * height * 4; i++) {
+		source_ptr[i] = (i * 37 % 101) * 0.173f - 3.0f;
+	}
+
+	Ref<Image> image = memnew(Image(width, height, false, Image::FORMAT_RGBAF, source));
+	image->generate_mipmaps();
+	REQUIRE(image->has_mipmaps());
+
+	int64_t mip_offset = 0;
+	int64_t mip_size = 0;
+	image->get_mipmap_offset_and_size(1, mip_offset, mip_size);
+	REQUIRE(mip_size == int64_t((width / 2) * (height / 2) * 4 * sizeof(float)));
+
+	PackedByteArray data = image->get_data();
+	const float *mip_ptr = reinterpret_cast<const float *>(data.ptr() + mip_offset);
+	bool matches = true;
+	for (int y = 0; y < height / 2; y++) {
+		for (int x = 0; x < width / 2; x++) {
+			for (int c = 0; c < 4; c++) {
+				float sum = source_ptr[((y * 2) * width + x * 2) * 4 + c] + source_ptr[((y * 2) * width + x * 2 + 1) * 4 + c];
+				sum += source_ptr[((y * 2 + 1) * width + x * 2) * 4 + c];
+				sum += source_ptr[((y * 2 + 1) * width + x * 2 + 1) * 4 + c];
+				const float expected = sum * 0.25f;
+				if (mip_ptr[(y * (width / 2) + x) * 4 + c] != expected) {
+					matches = false;
+				}
+			}
+		}
+	}
+	CHECK_MESSAGE(matches, "Every pixel of the first mipmap should be exactly the average of its 2x2 source block.");
+}
+
+static Ref<Image> benchmark_image(int p_size, Image::Format p_format) {
+	Ref<Image> image = Image::create_empty(p_size, p_size, false, p_format);
+	for (int y = 0; y < p_size; y++) {
+		for (int x = 0; x < p_size; x++) {
+			image->set_pixel(x, y, Color(float(x) / p_size, float(y) / p_size, float((x * 7 + y * 3) % p_size) / p_size, 1.0));
+		}
+	}
+	return image;
+}
+
+TEST_CASE("[Image][Benchmark] Mipmaps and resizing" * doctest::skip()) {
+	// Run with `--test --no-skip --test-case="*Benchmark*"`.
+	const int size = 2048;
+	const int iterations = 5;
+	const Image::Format formats[] = { Image::FORMAT_RGBA8, Image::FORMAT_RGBAH, Image::FORMAT_RGBAF };
+
+	for (const Image::Format format : formats) {
+		const Ref<Image> source = benchmark_image(size, format);
+
+		uint64_t total = 0;
+		for (int i = 0; i < iterations; i++) {
+			Ref<Image> image = source->duplicate();
+			const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			image->generate_mipmaps();
+			total += OS::get_singleton()->get_ticks_usec() - begin;
+		}
+		print_line(vformat("Image %dx%d %s: generate_mipmaps() %d usec.", size, size, Image::format_names[format], total / iterations));
+
+		for (int interpolation = Image::INTERPOLATE_NEAREST; interpolation <= Image::INTERPOLATE_LANCZOS; interpolation++) {
+			total = 0;
+			for (int i = 0; i < iterations; i++) {
+				Ref<Image> image = source->duplicate();
+				const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+				image->resize(size / 2 + 1, size / 2 + 1, static_cast<Image::Interpolation>(interpolation));
+				total += OS::get_singleton()->get_ticks_usec() - begin;
+			}
+			print_line(vformat("Image %dx%d %s: resize() with interpolation %d, %d usec.", size, size, Image::format_names[format], interpolation, total / iterations));
+		}
+	}
+}
+
 TEST_CASE("[Image] Convert image") {
 	for (int format = Image::FORMAT_RF; format < Image::FORMAT_RGBE9995; format++) {
 		for (int new_format = Image::FORMAT_RF; new_format < Image::FORMAT_RGBE9995; new_format++) {
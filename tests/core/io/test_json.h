@@ -32,6 +32,7 @@
 #define TEST_JSON_H
 
 #include "core/io/json.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -232,6 +233,185 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 		ERR_PRINT_ON
 	}
 }
+
+TEST_CASE("[JSON] Parsing UTF-8 bytes") {
+	JSON json;
+
+	const String source = String::utf8("{\"name\": \"Gr\xC3\xBC\xC3\x9F \\u00e9\\ud83d\\ude00\", \"values\": [1, -2.5, 1e3, true, null],\n\"nested\": {\"a\": []}}");
+	CHECK(json.parse_utf8(source.to_utf8_buffer()) == OK);
+	const Variant from_bytes = json.get_data();
+	CHECK(json.parse(source) == OK);
+	CHECK_MESSAGE(
+			from_bytes == json.get_data(),
+			"Parsing UTF-8 bytes should give the same result as parsing the decoded string.");
+	CHECK(String(Dictionary(from_bytes)["name"]) == String::utf8("Gr\xC3\xBC\xC3\x9F \xC3\xA9\xF0\x9F\x98\x80"));
+
+	// The buffer is not null-terminated, so a trailing number must stop at its end.
+	PackedByteArray number = String("12.5e1").to_utf8_buffer();
+	CHECK(json.parse_utf8(number) == OK);
+	CHECK(json.get_data() == Variant(125.0));
+
+	PackedByteArray bom;
+	bom.push_back(0xef);
+	bom.push_back(0xbb);
+	bom.push_back(0xbf);
+	bom.append_array(String("[1]").to_utf8_buffer());
+	CHECK(json.parse_utf8(bom, true) == OK);
+	Array one;
+	one.push_back(1);
+	CHECK(json.get_data() == Variant(one));
+	CHECK(json.get_parsed_text() == "[1]");
+
+	ERR_PRINT_OFF
+	CHECK(json.parse_utf8(String("[1,\n\"unterminated").to_utf8_buffer()) == ERR_PARSE_ERROR);
+	CHECK(json.get_error_line() == 1);
+	CHECK(json.parse_utf8(PackedByteArray()) == ERR_PARSE_ERROR);
+	ERR_PRINT_ON
+}
+
+// Writes the events it receives as text, and can stop after a number of them.
+class JSONEventLog : public JSON::EventHandler {
+	Error _add(const String &p_event) {
+		log += (log.is_empty() ? "" : " ") + p_event;
+		count++;
+		return (stop_after > 0 && count >= stop_after) ? ERR_SKIP : OK;
+	}
+
+public:
+	String log;
+	int count = 0;
+	int stop_after = 0;
+
+	virtual Error begin_object() override { return _add("{"); }
+	virtual Error key(const String &p_key) override { return _add(p_key + ":"); }
+	virtual Error end_object() override { return _add("}"); }
+	virtual Error begin_array() override { return _add("["); }
+	virtual Error end_array() override { return _add("]"); }
+	virtual Error value(const Variant &p_value) override { return _add(p_value.stringify()); }
+};
+
+TEST_CASE("[JSON] Parsing events") {
+	const String source = "{\"a\": [1, \"x\", true, null], \"b\": {}, \"c\": \"A string long enough to span blocks, with an \\u00e9 escape.\"}";
+	const String expected = String("{ a: [ 1 x true <null> ] b: { } c: A string long enough to span blocks, with an ") + String::chr(0xe9) + " escape. }";
+
+	JSONEventLog from_string;
+	CHECK(JSON::parse_events(source, &from_string) == OK);
+	CHECK(from_string.log == expected);
+
+	JSONEventLog from_utf8;
+	const CharString utf8 = source.utf8();
+	CHECK(JSON::parse_utf8_events((const uint8_t *)utf8.get_data(), utf8.length(), &from_utf8) == OK);
+	CHECK(from_utf8.log == expected);
+
+	// Handlers can stop parsing.
+	JSONEventLog stopped;
+	stopped.stop_after = 3;
+	String err_str;
+	CHECK(JSON::parse_events(source, &stopped, &err_str) == ERR_SKIP);
+	CHECK(stopped.log == "{ a: [");
+	CHECK_FALSE(err_str.is_empty());
+
+	JSONEventLog invalid;
+	int err_line = 0;
+	CHECK(JSON::parse_events("[1,\n{\"a\" 2}]", &invalid, &err_str, &err_line) == ERR_PARSE_ERROR);
+	CHECK(err_line == 1);
+	CHECK(invalid.log == "[ 1 {");
+}
+
+class JSONEventCounter : public JSON::EventHandler {
+public:
+	int count = 0;
+
+	virtual Error begin_object() override {
+		count++;
+		return OK;
+	}
+	virtual Error key(const String &p_key) override {
+		count++;
+		return OK;
+	}
+	virtual Error end_object() override {
+		count++;
+		return OK;
+	}
+	virtual Error begin_array() override {
+		count++;
+		return OK;
+	}
+	virtual Error end_array() override {
+		count++;
+		return OK;
+	}
+	virtual Error value(const Variant &p_value) override {
+		count++;
+		return OK;
+	}
+};
+
+TEST_CASE("[JSON][Benchmark] Parsing and stringifying" * doctest::skip()) {
+	// Run with `--test --no-skip --test-case="*Benchmark*"`.
+	Array items;
+	for (int i = 0; i < 20000; i++) {
+		Dictionary item;
+		item["id"] = i;
+		item["name"] = vformat("Item %d, with a description long enough to be worth scanning quickly.", i);
+		item["price"] = i * 0.25;
+		Array tags;
+		tags.push_back("common");
+		tags.push_back(String::utf8("\xC3\xA9quipement"));
+		item["tags"] = tags;
+		items.push_back(item);
+	}
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	const String text = JSON::stringify(items);
+	const uint64_t stringify_usec = OS::get_singleton()->get_ticks_usec() - begin;
+	const PackedByteArray bytes = text.to_utf8_buffer();
+
+	JSON json;
+	begin = OS::get_singleton()->get_ticks_usec();
+	REQUIRE(json.parse(text) == OK);
+	const uint64_t parse_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	const String decoded = String::utf8((const char *)bytes.ptr(), bytes.size());
+	REQUIRE(json.parse(decoded) == OK);
+	const uint64_t decode_parse_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	REQUIRE(json.parse_utf8(bytes) == OK);
+	const uint64_t parse_utf8_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	JSONEventCounter events;
+	begin = OS::get_singleton()->get_ticks_usec();
+	REQUIRE(JSON::parse_utf8_events(bytes.ptr(), bytes.size(), &events) == OK);
+	const uint64_t events_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	print_line(vformat("%d bytes of JSON. stringify: %d usec, parse: %d usec, decode UTF-8 and parse: %d usec, parse_utf8: %d usec, parse_utf8_events: %d usec (%d events).",
+			bytes.size(), stringify_usec, parse_usec, decode_parse_usec, parse_utf8_usec, events_usec, events.count));
+}
+
+TEST_CASE("[JSON] Stringify") {
+	Dictionary inner;
+	Array values;
+	values.push_back(1);
+	values.push_back("two");
+	values.push_back(Variant());
+	inner["b"] = values;
+	Dictionary data;
+	data["z"] = true;
+	data["a"] = inner;
+
+	CHECK(JSON::stringify(data) == "{\"a\":{\"b\":[1,\"two\",null]},\"z\":true}");
+	CHECK(JSON::stringify(data, "\t", false) == "{\n\t\"z\": true,\n\t\"a\": {\n\t\t\"b\": [\n\t\t\t1,\n\t\t\t\"two\",\n\t\t\tnull\n\t\t]\n\t}\n}");
+	CHECK(JSON::stringify(Array()) == "[]");
+
+	Array recursive;
+	recursive.push_back(recursive);
+	ERR_PRINT_OFF
+	CHECK(JSON::stringify(recursive) == "[\"[...]\"]");
+	ERR_PRINT_ON
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -386,6 +386,91 @@ TEST_CASE("[Marshalls] Typed array decoding") {
 	CHECK(array[0] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Schema encoding of integers") {
+	uint8_t buffer[16];
+	int r_len;
+
+	// Zigzag varints: -3 -> 5.
+	CHECK(encode_variant_with_schema(-3, 0, buffer, r_len) == OK);
+	CHECK(r_len == 1);
+	CHECK(buffer[0] == 0x05);
+
+	// 300 -> 600, written in two bytes.
+	CHECK(encode_variant_with_schema(300, 0, buffer, r_len) == OK);
+	CHECK(r_len == 2);
+	CHECK(buffer[0] == 0xd8);
+	CHECK(buffer[1] == 0x04);
+
+	Variant variant;
+	CHECK(decode_variant_with_schema(variant, 0, buffer, r_len, &r_len) == OK);
+	CHECK(r_len == 2);
+	CHECK(variant == Variant(300));
+}
+
+TEST_CASE("[Marshalls] Schema encoding round trip") {
+	Array tags_schema;
+	tags_schema.set_typed(Variant::STRING, StringName(), Variant());
+	Dictionary stats_schema;
+	stats_schema.set_typed(Variant::STRING_NAME, StringName(), Variant(), Variant::FLOAT, StringName(), Variant());
+	Dictionary schema;
+	schema["id"] = 0;
+	schema["name"] = String();
+	schema["position"] = Vector3();
+	schema["color"] = Color();
+	schema["alive"] = false;
+	schema["tags"] = tags_schema;
+	schema["stats"] = stats_schema;
+	schema["samples"] = PackedFloat32Array();
+	schema["anything"] = Variant();
+
+	Array tags = tags_schema.duplicate();
+	tags.push_back("player");
+	tags.push_back(String::utf8("\xC3\xA9quipe"));
+	Dictionary stats = stats_schema.duplicate();
+	stats[StringName("speed")] = 4.5;
+	stats[StringName("armor")] = -1.0;
+	Dictionary value;
+	value["anything"] = Vector2i(3, 4);
+	value["id"] = -123456789;
+	value["name"] = "Hero";
+	value["position"] = Vector3(1.5, -2, 1e6);
+	value["color"] = Color(0.25, 0.5, 0.75, 1);
+	value["alive"] = true;
+	value["tags"] = tags;
+	value["stats"] = stats;
+	value["samples"] = PackedFloat32Array({ 0.5, 1.5, -2.5 });
+
+	int len = 0;
+	CHECK(encode_variant_with_schema(value, schema, nullptr, len) == OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	int written = 0;
+	CHECK(encode_variant_with_schema(value, schema, buffer.ptrw(), written) == OK);
+	CHECK(written == len);
+
+	int tagged_len = 0;
+	CHECK(encode_variant(value, nullptr, tagged_len) == OK);
+	CHECK_MESSAGE(len * 2 < tagged_len, "Schema encoding should be much smaller than tagged encoding.");
+
+	Variant decoded;
+	int read = 0;
+	CHECK(decode_variant_with_schema(decoded, schema, buffer.ptr(), buffer.size(), &read) == OK);
+	CHECK(read == len);
+	CHECK(decoded == Variant(value));
+	// Fields come back in schema order, with the schema's container types.
+	CHECK(Dictionary(decoded).keys() == schema.keys());
+	CHECK(Array(Dictionary(decoded)["tags"]).get_typed_builtin() == Variant::STRING);
+	CHECK(Dictionary(Dictionary(decoded)["stats"]).get_typed_value_builtin() == Variant::FLOAT);
+
+	ERR_PRINT_OFF
+	CHECK(decode_variant_with_schema(decoded, schema, buffer.ptr(), buffer.size() - 1) == ERR_INVALID_DATA);
+	value.erase("name");
+	CHECK(encode_variant_with_schema(value, schema, nullptr, len) == ERR_INVALID_PARAMETER);
+	value["name"] = 5;
+	CHECK(encode_variant_with_schema(value, schema, nullptr, len) == ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON
+}
+
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
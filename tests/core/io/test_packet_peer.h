@@ -110,6 +110,42 @@ TEST_CASE("[PacketPeer][PacketPeerStream] Put a variant to peer") {
 	CHECK_EQ(String(spb->get_var()), godot_rules);
 }
 
+TEST_CASE("[PacketPeer][PacketPeerStream] Put and read a variant with a schema") {
+	Dictionary schema;
+	schema["position"] = Vector2();
+	schema["health"] = 0;
+	schema["name"] = String();
+
+	Dictionary player;
+	player["position"] = Vector2(4, 2);
+	player["health"] = 100;
+	player["name"] = "Godot";
+
+	Ref<StreamPeerBuffer> spb;
+	spb.instantiate();
+
+	Ref<PacketPeerStream> pps;
+	pps.instantiate();
+	pps->set_stream_peer(spb);
+
+	CHECK_EQ(pps->put_var_with_schema(player, schema), Error::OK);
+	const int schema_size = spb->get_size();
+	CHECK_EQ(pps->put_var(player), Error::OK);
+	// The field names and types are left out.
+	CHECK(schema_size < spb->get_size() - schema_size);
+
+	spb->seek(0);
+	Variant value;
+	CHECK_EQ(pps->get_var_with_schema(value, schema), Error::OK);
+	CHECK(Dictionary(value) == player);
+
+	// Values not matching the schema are not sent.
+	player["health"] = "full";
+	ERR_PRINT_OFF;
+	CHECK_EQ(pps->put_var_with_schema(player, schema), Error::ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+}
+
 TEST_CASE("[PacketPeer][PacketPeerStream] Put a variant to peer out of memory failure") {
 	String more_than_1mb = String("*").repeat(1024 + 1);
 
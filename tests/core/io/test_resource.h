@@ -31,6 +31,7 @@
 #ifndef TEST_RESOURCE_H
 #define TEST_RESOURCE_H
 
+#include "core/io/image.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
@@ -112,6 +113,43 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Saving and loading many sub-resources") {
+	// Enough sub-resources for the binary loader to decode them in parallel.
+	const int count = 100;
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Ref<Resource> previous = resource;
+	for (int i = 0; i < count; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(itos(i));
+		PackedInt32Array values;
+		values.push_back(i);
+		values.push_back(i * 2);
+		child->set_meta("values", values);
+		previous->set_meta("next", child);
+		previous = child;
+	}
+
+	const String save_path_binary = TestUtils::get_temp_path("resource_many.res");
+	ResourceSaver::save(resource, save_path_binary);
+
+	Ref<Resource> loaded = ResourceLoader::load(save_path_binary, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "Root");
+
+	Ref<Resource> current = loaded->get_meta("next");
+	for (int i = 0; i < count; i++) {
+		REQUIRE_MESSAGE(current.is_valid(), "The chain of sub-resources should be complete.");
+		CHECK(current->get_name() == itos(i));
+		PackedInt32Array values = current->get_meta("values");
+		REQUIRE(values.size() == 2);
+		CHECK(values[0] == i);
+		CHECK(values[1] == i * 2);
+		current = current->get_meta("next", Ref<Resource>());
+	}
+	CHECK(current.is_null());
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -166,6 +204,78 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[Resource] Retaining released resources within a budget") {
+	// Each image holds 1024 bytes, so the budget fits two of them.
+	ResourceCache::set_retention_budget("Image", 2500);
+	ResourceCache::reset_retention_stats();
+
+	ObjectID ids[3];
+	for (int i = 0; i < 3; i++) {
+		Ref<Image> image = Image::create_empty(16, 16, false, Image::FORMAT_RGBA8);
+		ids[i] = image->get_instance_id();
+		ResourceCache::retain(image, false);
+		// Not charged while referenced here.
+		CHECK(ResourceCache::get_retention_stats().retained_count == uint64_t(MIN(i, 2)));
+	}
+
+	ResourceCache::RetentionStats stats = ResourceCache::get_retention_stats();
+	CHECK(stats.misses == 3);
+	CHECK(stats.evictions == 1);
+	CHECK(stats.retained_count == 2);
+	CHECK(stats.retained_size == 2048);
+	CHECK_MESSAGE(ObjectDB::get_instance(ids[0]) == nullptr, "The least recently used image should be released.");
+	CHECK(ObjectDB::get_instance(ids[1]) != nullptr);
+	CHECK(ObjectDB::get_instance(ids[2]) != nullptr);
+
+	// Types without a budget are not retained.
+	Ref<Resource> resource = memnew(Resource);
+	ResourceCache::retain(resource, false);
+	CHECK(ResourceCache::get_retention_stats().retained_count == 2);
+
+	// Resources in use are kept out of the budget, even when larger than it.
+	Ref<Image> used = Image::create_empty(64, 64, false, Image::FORMAT_RGBA8);
+	const ObjectID used_id = used->get_instance_id();
+	ResourceCache::retain(used, false);
+	stats = ResourceCache::get_retention_stats();
+	CHECK(stats.evictions == 1);
+	CHECK(stats.retained_count == 2);
+	CHECK(stats.retained_size == 2048);
+	CHECK(ObjectDB::get_instance(ids[1]) != nullptr);
+
+	// Once released, it's charged and everything older goes first.
+	used.unref();
+	stats = ResourceCache::get_retention_stats();
+	CHECK(stats.evictions == 4);
+	CHECK(stats.retained_count == 0);
+	CHECK(stats.retained_size == 0);
+	CHECK(ObjectDB::get_instance(ids[1]) == nullptr);
+	CHECK(ObjectDB::get_instance(ids[2]) == nullptr);
+	CHECK(ObjectDB::get_instance(used_id) == nullptr);
+
+	// Loading a released resource again is served from the cache.
+	Ref<Image> saved = Image::create_empty(16, 16, false, Image::FORMAT_RGBA8);
+	const String save_path = TestUtils::get_temp_path("retained_image.res");
+	REQUIRE(ResourceSaver::save(saved, save_path) == OK);
+	saved.unref();
+
+	ObjectID loaded_id = Ref<Image>(ResourceLoader::load(save_path))->get_instance_id();
+	CHECK(ObjectDB::get_instance(loaded_id) != nullptr);
+	Ref<Image> reloaded = ResourceLoader::load(save_path);
+	CHECK(reloaded->get_instance_id() == loaded_id);
+	stats = ResourceCache::get_retention_stats();
+	CHECK(stats.misses == 5);
+	CHECK(stats.hits == 1);
+	CHECK(stats.retained_count == 0);
+	reloaded.unref();
+	CHECK(ResourceCache::get_retention_stats().retained_count == 1);
+	CHECK(ObjectDB::get_instance(loaded_id) != nullptr);
+
+	ResourceCache::set_retention_budget("Image", 0);
+	CHECK(ResourceCache::get_retention_budget("Image") == 0);
+	CHECK(ResourceCache::get_retention_stats().retained_count == 0);
+	CHECK(ObjectDB::get_instance(loaded_id) == nullptr);
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
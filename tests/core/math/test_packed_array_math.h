@@ -0,0 +1,88 @@
+/**************************************************************************/
+/*  test_packed_array_math.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#ifndef TEST_PACKED_ARRAY_MATH_H
+#define TEST_PACKED_ARRAY_MATH_H
+
+#include "core/math/packed_array_math.h"
+#include "core/math/random_number_generator.h"
+#include "core/templates/local_vector.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestPackedArrayMath {
+
+TEST_CASE("[PackedArrayMath] Dot product of small arrays") {
+	const float a[7] = { 1, 2, 3, 4, 5, 6, 7 };
+	const float b[7] = { 7, 6, 5, 4, 3, 2, 1 };
+
+	// Small integers are exact in float, so every size matches the exact sum.
+	CHECK(PackedArrayMath::dot(a, b, 0) == 0.0);
+	CHECK(PackedArrayMath::dot(a, b, 1) == 7.0);
+	CHECK(PackedArrayMath::dot(a, b, 3) == 34.0);
+	CHECK(PackedArrayMath::dot(a, b, 4) == 50.0);
+	CHECK(PackedArrayMath::dot(a, b, 7) == 84.0);
+}
+
+TEST_CASE("[PackedArrayMath] Dot product rounding doesn't depend on SIMD") {
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(4242);
+
+	// Not a multiple of 4, so the last elements go through the scalar path.
+	const int64_t count = 10007;
+	LocalVector<float> a;
+	LocalVector<float> b;
+	a.resize(count);
+	b.resize(count);
+	for (int64_t i = 0; i < count; i++) {
+		// Positive values, so the sum doesn't cancel out and the relative error stays small.
+		a[i] = rng->randf_range(0.5, 2.0);
+		b[i] = rng->randf_range(0.5, 2.0);
+	}
+
+	// Same definition as the implementation: element `i` goes to float lane `i % 4`.
+	float lanes[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	double exact = 0.0;
+	for (int64_t i = 0; i < count; i++) {
+		lanes[i % 4] += a[i] * b[i];
+		exact += (double)a[i] * (double)b[i];
+	}
+	const double expected = (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+	const double result = PackedArrayMath::dot(a.ptr(), b.ptr(), count);
+	// Only differs if the compiler fuses multiplications and additions differently.
+	CHECK(result == doctest::Approx(expected).epsilon(1e-6));
+	// Single-precision accumulation stays close to the double-precision sum.
+	CHECK(result == doctest::Approx(exact).epsilon(1e-5));
+}
+
+} // namespace TestPackedArrayMath
+
+#endif // TEST_PACKED_ARRAY_MATH_H
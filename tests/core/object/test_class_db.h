@@ -895,6 +895,34 @@ TEST_SUITE("[ClassDB]") {
 			}
 		}
 	}
+
+	TEST_CASE("[ClassDB] Method lookup includes inherited methods") {
+		MethodBind *reference = ClassDB::get_method("RefCounted", "reference");
+		MethodBind *get_class = ClassDB::get_method("Object", "get_class");
+		REQUIRE(reference != nullptr);
+		REQUIRE(get_class != nullptr);
+
+		CHECK(ClassDB::get_method("RefCounted", "get_class") == get_class);
+		CHECK(ClassDB::get_method("Resource", "reference") == reference);
+		CHECK(ClassDB::get_method("Object", "reference") == nullptr);
+		CHECK(ClassDB::get_method("RefCounted", "this_method_does_not_exist") == nullptr);
+		CHECK(ClassDB::get_method("ThisClassDoesNotExist", "get_class") == nullptr);
+
+		ClassDB::MethodCache cache;
+		CHECK(ClassDB::get_method_cached("Resource", "get_class", cache) == get_class);
+		CHECK(cache.method == get_class);
+		CHECK(ClassDB::get_method_cached("Resource", "get_class", cache) == get_class);
+
+		// A different name on the same cache must not return the cached method.
+		CHECK(ClassDB::get_method_cached("Resource", "reference", cache) == reference);
+		// Failed lookups are not cached.
+		CHECK(ClassDB::get_method_cached("Resource", "this_method_does_not_exist", cache) == nullptr);
+		CHECK(cache.method == reference);
+
+		CHECK(ClassDB::get_method_cached("Resource", "get_class") == get_class);
+		CHECK(ClassDB::get_method_cached("Resource", "reference") == reference);
+		CHECK(ClassDB::get_method_cached("Object", "reference") == nullptr);
+	}
 }
 } // namespace TestClassDB
 
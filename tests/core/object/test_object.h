@@ -324,6 +324,16 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+static int signal_call_count = 0;
+
+static void signal_increment_by_one() {
+	signal_call_count += 1;
+}
+
+static void signal_increment_by_ten() {
+	signal_call_count += 10;
+}
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -442,6 +452,76 @@ TEST_CASE("[Object] Signals") {
 		SIGNAL_UNWATCH(&object, "my_custom_signal");
 	}
 
+	SUBCASE("Emitting should see connections added and removed between emissions") {
+		signal_call_count = 0;
+		object.connect("my_custom_signal", callable_mp_static(&signal_increment_by_one));
+		object.emit_signal("my_custom_signal");
+		CHECK(signal_call_count == 1);
+
+		object.connect("my_custom_signal", callable_mp_static(&signal_increment_by_ten));
+		object.emit_signal("my_custom_signal");
+		CHECK(signal_call_count == 12);
+
+		object.disconnect("my_custom_signal", callable_mp_static(&signal_increment_by_one));
+		object.emit_signal("my_custom_signal");
+		CHECK(signal_call_count == 22);
+
+		object.disconnect("my_custom_signal", callable_mp_static(&signal_increment_by_ten));
+		object.emit_signal("my_custom_signal");
+		CHECK(signal_call_count == 22);
+	}
+
+	SUBCASE("Signal handles should follow connections and signal changes") {
+		signal_call_count = 0;
+		Object::SignalHandle handle("my_custom_signal");
+		CHECK(object.emit_signal(handle) == OK);
+
+		object.connect("my_custom_signal", callable_mp_static(&signal_increment_by_one));
+		CHECK(object.emit_signal(handle) == OK);
+		CHECK(signal_call_count == 1);
+
+		// Another object resolves the name again.
+		Object other;
+		other.add_user_signal(MethodInfo("my_custom_signal"));
+		other.connect("my_custom_signal", callable_mp_static(&signal_increment_by_ten));
+		CHECK(other.emit_signal(handle) == OK);
+		CHECK(signal_call_count == 11);
+		CHECK(object.emit_signal(handle) == OK);
+		CHECK(signal_call_count == 12);
+		object.disconnect("my_custom_signal", callable_mp_static(&signal_increment_by_one));
+
+		// Built-in signals are removed from the object with their last connection.
+		Object::SignalHandle builtin_handle("script_changed");
+		CHECK(object.emit_signal(builtin_handle) == ERR_UNAVAILABLE);
+		object.connect("script_changed", callable_mp_static(&signal_increment_by_one));
+		CHECK(object.emit_signal(builtin_handle) == OK);
+		CHECK(signal_call_count == 13);
+		object.disconnect("script_changed", callable_mp_static(&signal_increment_by_one));
+		CHECK(object.emit_signal(builtin_handle) == ERR_UNAVAILABLE);
+		object.connect("script_changed", callable_mp_static(&signal_increment_by_ten));
+		CHECK(object.emit_signal(builtin_handle) == OK);
+		CHECK(signal_call_count == 23);
+		object.disconnect("script_changed", callable_mp_static(&signal_increment_by_ten));
+
+		ERR_PRINT_OFF;
+		Object::SignalHandle missing_handle("some_signal");
+		CHECK(object.emit_signal(missing_handle) == ERR_UNAVAILABLE);
+		ERR_PRINT_ON;
+	}
+
+	SUBCASE("One-shot connections should only be called once") {
+		signal_call_count = 0;
+		object.connect("my_custom_signal", callable_mp_static(&signal_increment_by_one), Object::CONNECT_ONE_SHOT);
+		object.connect("my_custom_signal", callable_mp_static(&signal_increment_by_ten));
+		object.emit_signal("my_custom_signal");
+		CHECK(signal_call_count == 11);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp_static(&signal_increment_by_one)));
+
+		object.emit_signal("my_custom_signal");
+		CHECK(signal_call_count == 21);
+		object.disconnect("my_custom_signal", callable_mp_static(&signal_increment_by_ten));
+	}
+
 	SUBCASE("Connecting and then disconnecting many signals should not leave anything behind") {
 		List<Object::Connection> signal_connections;
 		Object targets[100];
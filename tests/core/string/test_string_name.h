@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName a = "test_string_name_interning";
+	const StringName b = String("test_string_name_interning");
+	const StringName c = StringName::search("test_string_name_interning");
+
+	CHECK(a == b);
+	CHECK(a == c);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a.hash() == String("test_string_name_interning").hash());
+
+	CHECK(StringName::search("test_string_name_never_interned") == StringName());
+	CHECK(StringName().is_empty());
+	CHECK(StringName("").data_unique_pointer() == nullptr);
+}
+
+static const int CONCURRENT_NAMES = 256;
+static LocalVector<const void *> concurrent_pointers;
+
+static void concurrent_intern(void *p_arg, uint32_t p_index) {
+	const int name_index = p_index % CONCURRENT_NAMES;
+	const String name = "test_string_name_concurrent_" + itos(name_index);
+
+	// Churn through names that get created and released on every iteration,
+	// which exercises insertion and removal from different threads at once.
+	bool churn_ok = true;
+	for (int i = 0; i < 16; i++) {
+		const String transient_name = name + "_" + itos(i);
+		StringName transient = transient_name;
+		StringName copy = transient;
+		churn_ok &= copy == transient && transient == transient_name;
+	}
+
+	const StringName interned = name;
+	concurrent_pointers[p_index] = churn_ok ? interned.data_unique_pointer() : nullptr;
+}
+
+TEST_CASE("[StringName] Concurrent interning and release") {
+	Vector<StringName> kept;
+	kept.resize(CONCURRENT_NAMES);
+	for (int i = 0; i < CONCURRENT_NAMES; i++) {
+		kept.write[i] = StringName("test_string_name_concurrent_" + itos(i));
+	}
+
+	const int count = CONCURRENT_NAMES * 16;
+	concurrent_pointers.clear();
+	concurrent_pointers.resize(count);
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(concurrent_intern, (void *)kept.ptr(), count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	bool all_interned = true;
+	for (int i = 0; i < count; i++) {
+		// Reduce number of check messages.
+		all_interned &= concurrent_pointers[i] == kept[i % CONCURRENT_NAMES].data_unique_pointer();
+	}
+	CHECK_MESSAGE(all_interned, "Names interned concurrently should resolve to the already interned data.");
+
+	for (int i = 0; i < 16; i++) {
+		CHECK(StringName::search("test_string_name_concurrent_0_" + itos(i)) == StringName());
+	}
+}
+
+static void contended_intern(void *p_arg, uint32_t p_index) {
+	const String *names = (const String *)p_arg;
+	for (int i = 0; i < 64; i++) {
+		const StringName name = names[(p_index + i) % CONCURRENT_NAMES];
+		const StringName copy = name;
+		ERR_FAIL_COND(copy != name);
+	}
+}
+
+TEST_CASE("[StringName][Benchmark] Contended interning" * doctest::skip()) {
+	// Run with `--test --no-skip --test-case="*Benchmark*"`.
+	Vector<String> names;
+	Vector<StringName> kept;
+	for (int i = 0; i < CONCURRENT_NAMES; i++) {
+		names.push_back("test_string_name_contended_" + itos(i));
+		kept.push_back(names[i]);
+	}
+
+	const int count = CONCURRENT_NAMES * 256;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		contended_intern((void *)names.ptr(), i);
+	}
+	const uint64_t single_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(contended_intern, (void *)names.ptr(), count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	const uint64_t threaded_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	print_line(vformat("%d interns: %d usec on one thread, %d usec on %d worker threads.", count * 64, single_usec, threaded_usec, WorkerThreadPool::get_singleton()->get_thread_count()));
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
@@ -0,0 +1,267 @@
+/**************************************************************************/
+/*  test_a_hash_map.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_A_HASH_MAP_H
+#define TEST_A_HASH_MAP_H
+
+#include "core/os/os.h"
+#include "core/templates/a_hash_map.h"
+#include "core/templates/hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAHashMap {
+
+TEST_CASE("[AHashMap] Insert element") {
+	AHashMap<int, int> map;
+	AHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[AHashMap] Overwrite element") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[AHashMap] Erase via element") {
+	AHashMap<int, int> map;
+	AHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[AHashMap] Erase via key") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.erase(42);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[AHashMap] Size") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 84);
+	map.insert(123, 84);
+	map.insert(0, 84);
+	map.insert(123485, 84);
+
+	CHECK(map.size() == 4);
+}
+
+TEST_CASE("[AHashMap] Iteration") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(0, 12934));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == 4);
+}
+
+TEST_CASE("[AHashMap] Const iteration") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+
+	const AHashMap<int, int> const_map = map;
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(0, 12934));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : const_map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == 4);
+}
+
+TEST_CASE("[AHashMap] Erase keeps elements dense") {
+	AHashMap<int, int> map;
+	map.insert(1, 10);
+	map.insert(2, 20);
+	map.insert(3, 30);
+
+	map.erase(1);
+
+	// The last element takes the place of the erased one.
+	CHECK(map.size() == 2);
+	CHECK(map.get_by_index(0).key == 3);
+	CHECK(map.get_by_index(1).key == 2);
+	CHECK(map[2] == 20);
+	CHECK(map[3] == 30);
+}
+
+TEST_CASE("[AHashMap] Grow, erase and reinsert many elements") {
+	AHashMap<String, int> map;
+	const int count = 10000;
+	for (int i = 0; i < count; i++) {
+		map.insert(itos(i), i);
+	}
+	CHECK(map.size() == count);
+
+	for (int i = 0; i < count; i += 2) {
+		CHECK(map.erase(itos(i)));
+	}
+	CHECK(map.size() == count / 2);
+
+	bool all_found = true;
+	for (int i = 0; i < count; i++) {
+		// Reduce number of check messages.
+		const int *value = map.getptr(itos(i));
+		all_found &= (i % 2 == 0) ? value == nullptr : (value != nullptr && *value == i);
+	}
+	CHECK(all_found);
+
+	for (int i = 0; i < count; i += 2) {
+		map[itos(i)] = i;
+	}
+	CHECK(map.size() == count);
+
+	int sum = 0;
+	for (const KeyValue<String, int> &E : map) {
+		sum += E.value;
+	}
+	CHECK(sum == count * (count - 1) / 2);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.has("1"));
+}
+
+TEST_CASE("[AHashMap] Reserve") {
+	AHashMap<int, int> map;
+	map.reserve(1000);
+	const uint32_t capacity = map.get_capacity();
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, i);
+	}
+	CHECK(map.get_capacity() == capacity);
+}
+
+template <typename TMap>
+static void benchmark_map(const char *p_name, const Vector<StringName> &p_keys, const Vector<StringName> &p_missing) {
+	// Enough maps for about a million operations per step, each step timed over all of them.
+	const int rounds = MAX(1, (1 << 20) / p_keys.size());
+	TMap *maps = memnew_arr(TMap, rounds);
+	int64_t checksum = 0;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (int i = 0; i < p_keys.size(); i++) {
+			maps[round].insert(p_keys[i], i);
+		}
+	}
+	const uint64_t insert_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (const StringName &key : p_keys) {
+			checksum += *maps[round].getptr(key);
+		}
+	}
+	const uint64_t hit_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (const StringName &key : p_missing) {
+			checksum += maps[round].has(key);
+		}
+	}
+	const uint64_t miss_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (const KeyValue<StringName, int> &E : maps[round]) {
+			checksum += E.value;
+		}
+	}
+	const uint64_t iterate_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (const StringName &key : p_keys) {
+			maps[round].erase(key);
+		}
+	}
+	const uint64_t erase_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	memdelete_arr(maps);
+	print_line(vformat("%s, %d keys x %d maps: insert %d usec, hit %d usec, miss %d usec, iterate %d usec, erase %d usec (checksum %d).", p_name, p_keys.size(), rounds, insert_usec, hit_usec, miss_usec, iterate_usec, erase_usec, checksum));
+}
+
+TEST_CASE("[AHashMap][Benchmark] Against HashMap" * doctest::skip()) {
+	// Run with `--test --no-skip --test-case="*Benchmark*"`.
+	// StringName keys, like the signal and method tables.
+	for (int count : { 16, 256, 65536 }) {
+		Vector<StringName> keys;
+		Vector<StringName> missing;
+		for (int i = 0; i < count; i++) {
+			keys.push_back(StringName("benchmark_key_" + itos(i)));
+			missing.push_back(StringName("benchmark_missing_" + itos(i)));
+		}
+		benchmark_map<HashMap<StringName, int>>("HashMap", keys, missing);
+		benchmark_map<AHashMap<StringName, int>>("AHashMap", keys, missing);
+	}
+}
+
+} // namespace TestAHashMap
+
+#endif // TEST_A_HASH_MAP_H
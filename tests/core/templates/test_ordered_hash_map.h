@@ -0,0 +1,236 @@
+/**************************************************************************/
+/*  test_ordered_hash_map.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ORDERED_HASH_MAP_H
+#define TEST_ORDERED_HASH_MAP_H
+
+#include "core/templates/ordered_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestOrderedHashMap {
+
+TEST_CASE("[OrderedHashMap] Insert element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[OrderedHashMap] Overwrite element") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[OrderedHashMap] Erase via element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[OrderedHashMap] Erase keeps insertion order") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.erase(123);
+	map.insert(7, 14);
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(0, 12934));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+	expected.push_back(Pair<int, int>(7, 14));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		CHECK(map.get_by_index(idx).key == E.key);
+		++idx;
+	}
+	CHECK(idx == 4);
+	CHECK(map.last()->key == 7);
+}
+
+TEST_CASE("[OrderedHashMap] Const iteration") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+
+	const OrderedHashMap<int, int> const_map = map;
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(0, 12934));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : const_map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == 4);
+}
+
+TEST_CASE("[OrderedHashMap] Erase most elements and compact") {
+	OrderedHashMap<String, int> map;
+	const int count = 1000;
+	for (int i = 0; i < count; i++) {
+		map.insert(itos(i), i);
+	}
+	for (int i = 0; i < count; i++) {
+		if (i % 10 != 0) {
+			map.erase(itos(i));
+		}
+	}
+	CHECK(map.size() == count / 10);
+
+	int expected = 0;
+	bool in_order = true;
+	for (const KeyValue<String, int> &E : map) {
+		// Reduce number of check messages.
+		in_order &= E.value == expected && E.key == itos(expected);
+		expected += 10;
+	}
+	CHECK(in_order);
+	CHECK(map.get_by_index(5).value == 50);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.has("0"));
+	CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("[OrderedHashMap] Storage shrinks after erasing most elements") {
+	OrderedHashMap<int, int> map;
+	for (int i = 0; i < 4096; i++) {
+		map.insert(i, i);
+	}
+	const uint32_t capacity = map.get_capacity();
+
+	// Erase from the front, so no tombstone is at the end of the array.
+	for (int i = 0; i < 4000; i++) {
+		map.erase(i);
+	}
+	CHECK(map.size() == 96);
+	CHECK(map.get_capacity() < capacity);
+
+	bool all_found = true;
+	for (int i = 4000; i < 4096; i++) {
+		// Reduce number of check messages.
+		const int *value = map.getptr(i);
+		all_found &= value != nullptr && *value == i;
+		all_found &= map.get_by_index(i - 4000).key == i;
+	}
+	CHECK(all_found);
+	CHECK(map.begin()->key == 4000);
+	CHECK(map.last()->key == 4095);
+}
+
+TEST_CASE("[OrderedHashMap] Erase from the end") {
+	OrderedHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i);
+	}
+	map.erase(50);
+	for (int i = 99; i > 50; i--) {
+		map.erase(i);
+	}
+	CHECK(map.size() == 50);
+	CHECK(map.last()->key == 49);
+	CHECK(map.get_by_index(49).key == 49);
+
+	map.insert(1000, 1000);
+	CHECK(map.last()->key == 1000);
+	CHECK(map.get_by_index(50).key == 1000);
+
+	for (int i = 0; i < 50; i++) {
+		map.erase(i);
+	}
+	map.erase(1000);
+	CHECK(map.is_empty());
+	CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("[OrderedHashMap] Sort") {
+	OrderedHashMap<int, int> map;
+	const int count = 1000;
+	for (int i = 0; i < count; i++) {
+		// Visits every key below `count` once, in a scrambled order.
+		const int key = (i * 617) % count;
+		map.insert(key, key * 2);
+	}
+	for (int i = 0; i < count; i += 3) {
+		map.erase(i);
+	}
+
+	struct Less {
+		bool operator()(int p_a, int p_b) const { return p_a < p_b; }
+	};
+	map.sort_custom<Less>();
+
+	int previous = -1;
+	bool sorted = true;
+	int index = 0;
+	for (const KeyValue<int, int> &E : map) {
+		// Reduce number of check messages.
+		sorted &= E.key > previous && E.key % 3 != 0 && E.value == E.key * 2;
+		sorted &= map.get_by_index(index++).key == E.key;
+		previous = E.key;
+	}
+	CHECK(sorted);
+	CHECK(index == (int)map.size());
+
+	bool all_found = true;
+	for (int i = 0; i < count; i++) {
+		all_found &= map.has(i) == (i % 3 != 0);
+	}
+	CHECK(all_found);
+}
+
+} // namespace TestOrderedHashMap
+
+#endif // TEST_ORDERED_HASH_MAP_H
@@ -536,6 +536,50 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Order is kept after erasing and reinserting") {
+	Dictionary d;
+	for (int i = 0; i < 100; i++) {
+		d[i] = i * 2;
+	}
+	for (int i = 0; i < 100; i += 3) {
+		d.erase(i);
+	}
+	d[0] = "readded";
+
+	Array keys;
+	for (int i = 0; i < 100; i++) {
+		if (i % 3 != 0) {
+			keys.append(i);
+		}
+	}
+	keys.append(0);
+
+	CHECK_EQ(d.keys(), keys);
+	CHECK_EQ(d.get_key_at_index(0), Variant(1));
+	CHECK_EQ(d.get_value_at_index(0), Variant(2));
+	CHECK_EQ(d.get_key_at_index(d.size() - 1), Variant(0));
+	CHECK_EQ(d.get_value_at_index(d.size() - 1), Variant("readded"));
+	CHECK_EQ(d.get_key_at_index(d.size()), Variant());
+
+	// Erasing most entries compacts the storage without changing the order.
+	for (int i = 1; i < 95; i++) {
+		d.erase(i);
+	}
+	keys.clear();
+	for (int i = 95; i < 100; i++) {
+		if (i % 3 != 0) {
+			keys.append(i);
+		}
+	}
+	keys.append(0);
+	CHECK_EQ(d.keys(), keys);
+	CHECK_EQ(d[97], Variant(194));
+
+	d.sort();
+	CHECK_EQ(d.get_key_at_index(0), Variant(0));
+	CHECK_EQ(d.get_key_at_index(1), Variant(95));
+}
+
 TEST_CASE("[Dictionary] Typed copying") {
 	TypedDictionary<int, int> d1;
 	d1[0] = 1;
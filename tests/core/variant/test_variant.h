@@ -31,6 +31,8 @@
 #ifndef TEST_VARIANT_H
 #define TEST_VARIANT_H
 
+#include "core/io/file_access_memory.h"
+#include "core/os/os.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
@@ -1755,6 +1757,106 @@ TEST_CASE("[Variant] Writer and parser array") {
 	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Parser packed arrays") {
+	VariantParser::StreamString ss;
+	String errs;
+	int line = 1;
+	Variant parsed;
+
+	ss.s = "PackedFloat32Array(0.5, -2,\n\t1e3 ; comment\n, inf, -1.25e-2)";
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	PackedFloat32Array floats = parsed;
+	REQUIRE(floats.size() == 5);
+	CHECK(floats[0] == 0.5f);
+	CHECK(floats[1] == -2.0f);
+	CHECK(floats[2] == 1000.0f);
+	CHECK(Math::is_inf(floats[3]));
+	CHECK(floats[4] == doctest::Approx(-0.0125f));
+	CHECK(line == 3);
+
+	VariantParser::StreamString iss;
+	iss.s = "PackedInt32Array(1, 2.75, -3)";
+	CHECK(VariantParser::parse(&iss, parsed, errs, line) == OK);
+	CHECK(parsed == Variant(PackedInt32Array({ 1, 2, -3 })));
+
+	VariantParser::StreamString ess;
+	ess.s = "PackedFloat64Array()";
+	CHECK(VariantParser::parse(&ess, parsed, errs, line) == OK);
+	CHECK(PackedFloat64Array(parsed).is_empty());
+
+	VariantParser::StreamString tss;
+	tss.s = "PackedFloat64Array(1, )";
+	CHECK(VariantParser::parse(&tss, parsed, errs, line) == ERR_PARSE_ERROR);
+
+	VariantParser::StreamString mss;
+	mss.s = "PackedFloat64Array(1 2)";
+	CHECK(VariantParser::parse(&mss, parsed, errs, line) == ERR_PARSE_ERROR);
+}
+
+TEST_CASE("[Variant] Parser UTF-8 strings") {
+	// Raw UTF-8 text, plus escaped code points which are not UTF-8 encoded in the file.
+	const char *source = "\"h\xC3\xA9llo \\u00e9 \\U01F600 \\\"\"";
+	Ref<FileAccessMemory> fa;
+	fa.instantiate();
+	REQUIRE(fa->open_custom((const uint8_t *)source, strlen(source)) == OK);
+
+	VariantParser::StreamFile stream;
+	stream.f = fa;
+	String errs;
+	int line = 1;
+	Variant parsed;
+	CHECK(VariantParser::parse(&stream, parsed, errs, line) == OK);
+	CHECK(parsed == Variant(String::utf8("h\xC3\xA9llo \xC3\xA9 \xF0\x9F\x98\x80 \"")));
+}
+
+static void benchmark_parse(const char *p_name, const Variant &p_value) {
+	String text;
+	VariantWriter::write_to_string(p_value, text);
+	const CharString utf8 = text.utf8();
+
+	// Parsed from a file, as when loading text resources.
+	const int rounds = 10;
+	uint64_t usec = 0;
+	for (int i = 0; i < rounds; i++) {
+		Ref<FileAccessMemory> fa;
+		fa.instantiate();
+		REQUIRE(fa->open_custom((const uint8_t *)utf8.get_data(), utf8.length()) == OK);
+		VariantParser::StreamFile stream;
+		stream.f = fa;
+		String errs;
+		int line = 1;
+		Variant parsed;
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		REQUIRE(VariantParser::parse(&stream, parsed, errs, line) == OK);
+		usec += OS::get_singleton()->get_ticks_usec() - begin;
+	}
+
+	print_line(vformat("%s: %d bytes parsed in %d usec (%.1f MB/s).", p_name, utf8.length(), usec / rounds, utf8.length() * rounds / (double)MAX(usec, (uint64_t)1)));
+}
+
+TEST_CASE("[Variant][Benchmark] Parser" * doctest::skip()) {
+	// Run with `--test --no-skip --test-case="*Benchmark*"`.
+	const int count = 100000;
+
+	PackedVector3Array vertices;
+	vertices.resize(count);
+	PackedInt32Array indices;
+	indices.resize(count);
+	for (int i = 0; i < count; i++) {
+		vertices.write[i] = Vector3(i * 0.25, -i * 0.5, i * 0.125);
+		indices.write[i] = i * 3;
+	}
+	benchmark_parse("PackedVector3Array", vertices);
+	benchmark_parse("PackedInt32Array", indices);
+
+	Array strings;
+	for (int i = 0; i < count / 10; i++) {
+		strings.push_back(vformat(U"Some translated text %d, with \"quotes\" and \u00e9 accents.", i));
+	}
+	benchmark_parse("Array of strings", strings);
+}
+
 TEST_CASE("[Variant] Writer recursive array") {
 	// There is no way to accurately represent a recursive array,
 	// the only thing we can do is make sure the writer doesn't blow up
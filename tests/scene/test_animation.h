@@ -31,9 +31,13 @@
 #ifndef TEST_ANIMATION_H
 #define TEST_ANIMATION_H
 
+#include "core/io/resource_format_binary.h"
+#include "core/io/resource_loader.h"
+#include "core/io/resource_saver.h"
 #include "scene/resources/animation.h"
 
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 namespace TestAnimation {
 
@@ -309,6 +313,74 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Lazy loading from binary resources") {
+	// Enough keys for the track data to be worth deferring.
+	const int key_count = 5000;
+	Ref<Animation> animation = memnew(Animation);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Enemy"));
+	for (int i = 0; i < key_count; i++) {
+		animation->position_track_insert_key(track_index, i * 0.01, Vector3(i, 0, 0));
+	}
+	animation->set_length(key_count * 0.01);
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_meta("animation", animation);
+	const String save_path = TestUtils::get_temp_path("lazy_animation.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	ResourceFormatLoaderBinary::set_lazy_sub_resources(true);
+	const uint32_t pending_count = Resource::get_lazy_payloads_pending_count();
+	const uint64_t pending_size = Resource::get_lazy_payloads_pending_size();
+
+	Ref<Resource> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_REPLACE);
+	REQUIRE(loaded.is_valid());
+	Ref<Animation> loaded_animation = loaded->get_meta("animation");
+	REQUIRE(loaded_animation.is_valid());
+	CHECK(loaded_animation->has_lazy_payload());
+	CHECK(Resource::get_lazy_payloads_pending_count() == pending_count + 1);
+	CHECK(Resource::get_lazy_payloads_pending_size() > pending_size + key_count * sizeof(Vector3));
+
+	// First use reads the track data.
+	CHECK(loaded_animation->get_track_count() == 1);
+	CHECK_FALSE(loaded_animation->has_lazy_payload());
+	CHECK(Resource::get_lazy_payloads_pending_count() == pending_count);
+	CHECK(Resource::get_lazy_payloads_pending_size() == pending_size);
+	CHECK(loaded_animation->track_get_key_count(0) == key_count);
+	CHECK(loaded_animation->get_length() == doctest::Approx(key_count * 0.01));
+	Vector3 position;
+	CHECK(loaded_animation->position_track_get_key(0, key_count - 1, &position) == OK);
+	CHECK(position.is_equal_approx(Vector3(key_count - 1, 0, 0)));
+
+	// Per-track accessors read the track data too.
+	loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_REPLACE);
+	REQUIRE(loaded.is_valid());
+	loaded_animation = loaded->get_meta("animation");
+	REQUIRE(loaded_animation.is_valid());
+	CHECK(loaded_animation->has_lazy_payload());
+	CHECK(loaded_animation->track_get_path(0) == NodePath("Enemy"));
+	CHECK_FALSE(loaded_animation->has_lazy_payload());
+
+	loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_REPLACE);
+	REQUIRE(loaded.is_valid());
+	loaded_animation = loaded->get_meta("animation");
+	REQUIRE(loaded_animation.is_valid());
+	CHECK(loaded_animation->has_lazy_payload());
+	CHECK(loaded_animation->position_track_interpolate(0, 1.005).is_equal_approx(Vector3(100.5, 0, 0)));
+	CHECK_FALSE(loaded_animation->has_lazy_payload());
+
+	// Payloads freed without being used are accounted for too.
+	loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_REPLACE);
+	REQUIRE(loaded.is_valid());
+	CHECK(Resource::get_lazy_payloads_pending_count() == pending_count + 1);
+	loaded_animation.unref();
+	loaded.unref();
+	CHECK(Resource::get_lazy_payloads_pending_count() == pending_count);
+	CHECK(Resource::get_lazy_payloads_pending_size() == pending_size);
+
+	ResourceFormatLoaderBinary::set_lazy_sub_resources(false);
+}
+
 } // namespace TestAnimation
 
 #endif // TEST_ANIMATION_H
@@ -81,6 +81,8 @@ TEST_CASE("[SceneTree][ImageTexture] set_size_override") {
 	image_texture->set_size_override(Size2i(32, 16));
 	CHECK(image_texture->get_width() == 32);
 	CHECK(image_texture->get_height() == 16);
+	// Memory is still that of the image, in its actual format.
+	CHECK(image_texture->get_memory_usage_estimate() == 16 * 8 * 3);
 }
 
 TEST_CASE("[SceneTree][ImageTexture] is_pixel_opaque") {